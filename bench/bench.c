@@ -0,0 +1,527 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bme69x.h"
+#include "mock.h"
+
+/***********************************************************************/
+/*                         Macros                                      */
+/***********************************************************************/
+
+/* Number of calls of the configuration and read out APIs */
+#define N_CALLS        UINT32_C(1000)
+
+/* Number of calls of bme69x_init */
+#define N_INIT         UINT32_C(100)
+
+/* Number of calls of bme69x_selftest_check */
+#define N_SELFTEST     UINT32_C(3)
+
+/* Number of samples compensated */
+#define N_SAMPLES      UINT32_C(100000)
+
+/* Samples per bme69x_compensate_batch call */
+#define BATCH_LEN      UINT32_C(256)
+
+/* Length of the heater profiles */
+#define PROFILE_LEN    UINT8_C(10)
+
+/***********************************************************************/
+/*                         Measurement                                 */
+/***********************************************************************/
+
+struct bench_bus
+{
+    const char *name;
+    uint8_t intf;
+    uint32_t hz;
+};
+
+/* Bus traffic, virtual time and wall time summed over the measured calls */
+struct bench_acc
+{
+    struct bme69x_mock_stats stats;
+    uint64_t vt_ns;
+    uint64_t wall_ns;
+    uint32_t calls;
+
+    /* Snapshot at the start of the current call */
+    struct bme69x_mock_stats start;
+    uint64_t start_vt;
+    uint64_t start_wall;
+};
+
+static bool csv_output;
+
+/* Set once a benchmark ended on a result other than BME69X_OK, the exit status of the run */
+static bool bench_failed;
+
+static uint64_t wall_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+static void acc_reset(struct bench_acc *acc)
+{
+    memset(acc, 0, sizeof(*acc));
+}
+
+static void acc_begin(struct bench_acc *acc, const struct bme69x_mock *mock)
+{
+    acc->start = mock->stats;
+    acc->start_vt = mock->now_ns;
+    acc->start_wall = wall_now_ns();
+}
+
+static void acc_end(struct bench_acc *acc, const struct bme69x_mock *mock, uint32_t calls)
+{
+    acc->wall_ns += wall_now_ns() - acc->start_wall;
+    acc->vt_ns += mock->now_ns - acc->start_vt;
+    acc->stats.n_reads += mock->stats.n_reads - acc->start.n_reads;
+    acc->stats.n_writes += mock->stats.n_writes - acc->start.n_writes;
+    acc->stats.bytes_read += mock->stats.bytes_read - acc->start.bytes_read;
+    acc->stats.bytes_written += mock->stats.bytes_written - acc->start.bytes_written;
+    acc->stats.n_page_switches += mock->stats.n_page_switches - acc->start.n_page_switches;
+    acc->stats.bus_ns += mock->stats.bus_ns - acc->start.bus_ns;
+    acc->calls += calls;
+}
+
+static void print_header(void)
+{
+    if (csv_output)
+    {
+        printf("bench,bus,calls,txn_per_call,bytes_read_per_call,bytes_written_per_call,page_switches_per_call,"
+               "bus_us_per_call,wall_ns_per_call,calls_per_s,vt_calls_per_s,rslt\n");
+    }
+    else
+    {
+        printf("%-26s %-8s %7s %8s %8s %8s %7s %10s %11s %11s %9s %5s\n",
+               "Bench",
+               "Bus",
+               "Calls",
+               "Txn",
+               "Read B",
+               "Write B",
+               "Pages",
+               "Bus us",
+               "Wall ns",
+               "Calls/s",
+               "VT/s",
+               "Rslt");
+    }
+}
+
+static void report(const char *name, const char *bus, const struct bench_acc *acc, int8_t rslt)
+{
+    double calls = (acc->calls > 0) ? (double)acc->calls : 1.0;
+    double wall_s = (double)acc->wall_ns / 1e9;
+    double vt_s = (double)acc->vt_ns / 1e9;
+    double per_s = (wall_s > 0) ? (calls / wall_s) : 0;
+    double vt_per_s = (vt_s > 0) ? (calls / vt_s) : 0;
+
+    if (rslt != BME69X_OK)
+    {
+        bench_failed = true;
+    }
+
+    printf(csv_output ? "%s,%s,%lu,%.2f,%.2f,%.2f,%.2f,%.2f,%.1f,%.0f,%.2f,%d\n" :
+           "%-26s %-8s %7lu %8.2f %8.2f %8.2f %7.2f %10.2f %11.1f %11.0f %9.2f %5d\n",
+           name,
+           bus,
+           (long unsigned int)acc->calls,
+           (double)(acc->stats.n_reads + acc->stats.n_writes) / calls,
+           (double)acc->stats.bytes_read / calls,
+           (double)acc->stats.bytes_written / calls,
+           (double)acc->stats.n_page_switches / calls,
+           (double)acc->stats.bus_ns / 1e3 / calls,
+           (double)acc->wall_ns / calls,
+           per_s,
+           vt_per_s,
+           rslt);
+}
+
+/***********************************************************************/
+/*                         Benchmarks                                  */
+/***********************************************************************/
+
+static void set_conf(struct bme69x_conf *conf)
+{
+    conf->filter = BME69X_FILTER_OFF;
+    conf->odr = BME69X_ODR_NONE;
+    conf->os_hum = BME69X_OS_1X;
+    conf->os_pres = BME69X_OS_16X;
+    conf->os_temp = BME69X_OS_2X;
+}
+
+static void set_heatr_conf(struct bme69x_heatr_conf *heatr_conf, uint16_t *temp_prof, uint16_t *dur_prof)
+{
+    uint8_t i;
+
+    for (i = 0; i < PROFILE_LEN; i++)
+    {
+        temp_prof[i] = (uint16_t)(200 + (i * 15));
+        dur_prof[i] = 5;
+    }
+
+    heatr_conf->enable = BME69X_ENABLE;
+    heatr_conf->heatr_temp = 300;
+    heatr_conf->heatr_dur = 100;
+    heatr_conf->heatr_temp_prof = temp_prof;
+    heatr_conf->heatr_dur_prof = dur_prof;
+    heatr_conf->profile_len = PROFILE_LEN;
+    heatr_conf->shared_heatr_dur = 100;
+}
+
+/* Reads a continuous mode for N_CALLS periods, measuring bme69x_get_data only */
+static int8_t bench_continuous(const char *name,
+                               const struct bench_bus *bus,
+                               uint8_t op_mode,
+                               struct bme69x_conf *conf,
+                               struct bme69x_heatr_conf *heatr_conf,
+                               struct bme69x_mock *mock,
+                               struct bme69x_dev *bme)
+{
+    struct bench_acc acc;
+    struct bme69x_data data[3];
+    uint32_t period;
+    uint8_t n_data;
+    int8_t rslt;
+    uint32_t i;
+
+    rslt = bme69x_set_op_mode(BME69X_SLEEP_MODE, bme);
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_set_heatr_conf(op_mode, heatr_conf, bme);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_set_op_mode(op_mode, bme);
+    }
+
+    period = bme69x_get_meas_dur(op_mode, conf, bme);
+    period += (op_mode == BME69X_PARALLEL_MODE) ? (uint32_t)heatr_conf->shared_heatr_dur * 1000 :
+              (uint32_t)heatr_conf->heatr_dur_prof[0] * 1000;
+
+    acc_reset(&acc);
+    for (i = 0; (i < N_CALLS) && (rslt >= BME69X_OK); i++)
+    {
+        bme->delay_us(period, bme->intf_ptr);
+
+        acc_begin(&acc, mock);
+        rslt = bme69x_get_data(op_mode, data, &n_data, bme);
+        acc_end(&acc, mock, 1);
+    }
+
+    report(name, bus->name, &acc, rslt);
+
+    return rslt;
+}
+
+/* Selects the shadow register cache for the next benchmarks, the rows measured with it get a _shd suffix */
+static void set_shadow(struct bme69x_dev *bme, bool shadow)
+{
+    if (shadow)
+    {
+        bme->features |= BME69X_FEAT_SHADOW_REGS;
+    }
+    else
+    {
+        bme->features &= (uint8_t)~BME69X_FEAT_SHADOW_REGS;
+    }
+}
+
+/* Configures and reads the forced mode, the shadow register cache selected by set_shadow */
+static int8_t bench_forced(const struct bench_bus *bus,
+                           bool shadow,
+                           struct bme69x_conf *conf,
+                           struct bme69x_heatr_conf *heatr_conf,
+                           struct bme69x_mock *mock,
+                           struct bme69x_dev *bme)
+{
+    struct bench_acc acc;
+    struct bme69x_data data[3];
+    uint8_t n_data;
+    int8_t rslt = BME69X_OK;
+    uint32_t i;
+
+    acc_reset(&acc);
+    for (i = 0; (i < N_CALLS) && (rslt == BME69X_OK); i++)
+    {
+        acc_begin(&acc, mock);
+        rslt = bme69x_set_heatr_conf(BME69X_FORCED_MODE, heatr_conf, bme);
+        acc_end(&acc, mock, 1);
+    }
+
+    report(shadow ? "set_heatr_conf_forced_shd" : "set_heatr_conf_forced", bus->name, &acc, rslt);
+
+    /* Forced mode read out alone, then the whole trigger, wait and read cycle */
+    acc_reset(&acc);
+    for (i = 0; (i < N_CALLS) && (rslt >= BME69X_OK); i++)
+    {
+        rslt = bme69x_set_op_mode(BME69X_FORCED_MODE, bme);
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_wait_data(BME69X_FORCED_MODE, conf, heatr_conf, bme);
+        }
+
+        acc_begin(&acc, mock);
+        rslt = bme69x_get_data(BME69X_FORCED_MODE, data, &n_data, bme);
+        acc_end(&acc, mock, 1);
+    }
+
+    report(shadow ? "get_data_forced_shd" : "get_data_forced", bus->name, &acc, rslt);
+
+    acc_reset(&acc);
+    acc_begin(&acc, mock);
+    for (i = 0; (i < N_CALLS) && (rslt >= BME69X_OK); i++)
+    {
+        rslt = bme69x_set_op_mode(BME69X_FORCED_MODE, bme);
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_wait_data(BME69X_FORCED_MODE, conf, heatr_conf, bme);
+        }
+
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_get_data(BME69X_FORCED_MODE, data, &n_data, bme);
+        }
+    }
+
+    acc_end(&acc, mock, i);
+    report(shadow ? "forced_cycle_shd" : "forced_cycle", bus->name, &acc, rslt);
+
+    return rslt;
+}
+
+static void bench_bus(const struct bench_bus *bus)
+{
+    struct bme69x_mock mock;
+    struct bme69x_dev bme;
+    struct bme69x_conf conf;
+    struct bme69x_heatr_conf heatr_conf;
+    struct bme69x_txn txn;
+    struct bme69x_warm_blob blob;
+    struct bench_acc acc;
+    uint16_t temp_prof[PROFILE_LEN];
+    uint16_t dur_prof[PROFILE_LEN];
+    uint8_t shadow;
+    int8_t rslt = BME69X_OK;
+    uint32_t i;
+
+    memset(&bme, 0, sizeof(bme));
+    bme69x_mock_init(&mock, bus->intf, bus->hz);
+    bme69x_mock_attach(&mock, &bme);
+    set_conf(&conf);
+    set_heatr_conf(&heatr_conf, temp_prof, dur_prof);
+
+    acc_reset(&acc);
+    for (i = 0; (i < N_INIT) && (rslt == BME69X_OK); i++)
+    {
+        acc_begin(&acc, &mock);
+        rslt = bme69x_init(&bme);
+        acc_end(&acc, &mock, 1);
+    }
+
+    report("init", bus->name, &acc, rslt);
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_warm_save(&blob, &bme);
+    }
+
+    acc_reset(&acc);
+    for (i = 0; (i < N_INIT) && (rslt == BME69X_OK); i++)
+    {
+        acc_begin(&acc, &mock);
+        rslt = bme69x_init_warm(&bme, &blob);
+        acc_end(&acc, &mock, 1);
+    }
+
+    report("init_warm", bus->name, &acc, rslt);
+
+    acc_reset(&acc);
+    for (i = 0; (i < N_CALLS) && (rslt == BME69X_OK); i++)
+    {
+        acc_begin(&acc, &mock);
+        rslt = bme69x_set_conf(&conf, &bme);
+        acc_end(&acc, &mock, 1);
+    }
+
+    report("set_conf", bus->name, &acc, rslt);
+
+    acc_reset(&acc);
+    for (i = 0; (i < N_CALLS) && (rslt == BME69X_OK); i++)
+    {
+        acc_begin(&acc, &mock);
+        rslt = bme69x_set_heatr_conf(BME69X_PARALLEL_MODE, &heatr_conf, &bme);
+        acc_end(&acc, &mock, 1);
+    }
+
+    report("set_heatr_conf_parallel", bus->name, &acc, rslt);
+
+    /* The same configuration and heater profile, committed together */
+    acc_reset(&acc);
+    for (i = 0; (i < N_CALLS) && (rslt == BME69X_OK); i++)
+    {
+        acc_begin(&acc, &mock);
+        rslt = bme69x_txn_begin(&txn, &bme);
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_txn_set_conf(&conf, &txn);
+        }
+
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_txn_set_heatr_conf(BME69X_PARALLEL_MODE, &heatr_conf, &txn);
+        }
+
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_txn_commit(BME69X_SLEEP_MODE, &txn);
+        }
+
+        acc_end(&acc, &mock, 1);
+    }
+
+    report("txn_commit_parallel", bus->name, &acc, rslt);
+
+    for (shadow = 0; (shadow < 2) && (rslt >= BME69X_OK); shadow++)
+    {
+        set_shadow(&bme, shadow != 0);
+        rslt = bench_forced(bus, shadow != 0, &conf, &heatr_conf, &mock, &bme);
+    }
+
+    for (shadow = 0; (shadow < 2) && (rslt >= BME69X_OK); shadow++)
+    {
+        set_shadow(&bme, shadow != 0);
+        rslt = bench_continuous(shadow ? "get_data_parallel_shd" : "get_data_parallel",
+                                bus,
+                                BME69X_PARALLEL_MODE,
+                                &conf,
+                                &heatr_conf,
+                                &mock,
+                                &bme);
+    }
+
+    for (shadow = 0; (shadow < 2) && (rslt >= BME69X_OK); shadow++)
+    {
+        set_shadow(&bme, shadow != 0);
+        rslt = bench_continuous(shadow ? "get_data_sequential_shd" : "get_data_sequential",
+                                bus,
+                                BME69X_SEQUENTIAL_MODE,
+                                &conf,
+                                &heatr_conf,
+                                &mock,
+                                &bme);
+    }
+
+    set_shadow(&bme, false);
+
+    acc_reset(&acc);
+    for (i = 0; (i < N_SELFTEST) && (rslt == BME69X_OK); i++)
+    {
+        acc_begin(&acc, &mock);
+        rslt = bme69x_selftest_check(&bme);
+        acc_end(&acc, &mock, 1);
+    }
+
+    report("selftest_check", bus->name, &acc, rslt);
+}
+
+/* Host cost of the compensation, no bus involved */
+static void bench_compensate(void)
+{
+    static uint32_t temp_adc[BATCH_LEN], pres_adc[BATCH_LEN];
+    static uint16_t hum_adc[BATCH_LEN], gas_adc[BATCH_LEN];
+    static uint8_t gas_range[BATCH_LEN];
+    static struct bme69x_data data[BATCH_LEN];
+    struct bme69x_raw_batch batch = { temp_adc, pres_adc, hum_adc, gas_adc, gas_range };
+    struct bme69x_mock mock;
+    struct bme69x_dev bme;
+    struct bme69x_raw_field raw;
+    struct bench_acc acc;
+    int8_t rslt;
+    uint32_t i;
+
+    memset(&bme, 0, sizeof(bme));
+    bme69x_mock_init(&mock, BME69X_I2C_INTF, BME69X_MOCK_I2C_400K);
+    bme69x_mock_attach(&mock, &bme);
+    rslt = bme69x_init(&bme);
+
+    for (i = 0; i < BATCH_LEN; i++)
+    {
+        temp_adc[i] = UINT32_C(0xaa0000) + (i << 6);
+        pres_adc[i] = UINT32_C(0x5c0000) + (i << 6);
+        hum_adc[i] = (uint16_t)(0x6000 + i);
+        gas_adc[i] = (uint16_t)(0x100 + i);
+        gas_range[i] = (uint8_t)(i & BME69X_GAS_RANGE_MSK);
+    }
+
+    memset(&raw, 0, sizeof(raw));
+    acc_reset(&acc);
+    acc_begin(&acc, &mock);
+    for (i = 0; (i < N_SAMPLES) && (rslt == BME69X_OK); i++)
+    {
+        raw.temp_adc = temp_adc[i % BATCH_LEN];
+        raw.pres_adc = pres_adc[i % BATCH_LEN];
+        raw.hum_adc = hum_adc[i % BATCH_LEN];
+        raw.gas_adc = gas_adc[i % BATCH_LEN];
+        raw.gas_range = gas_range[i % BATCH_LEN];
+        rslt = bme69x_compensate(&bme.calib, &raw, &data[i % BATCH_LEN]);
+    }
+
+    acc_end(&acc, &mock, i);
+    report("compensate", "none", &acc, rslt);
+
+    acc_reset(&acc);
+    acc_begin(&acc, &mock);
+    for (i = 0; (i < (N_SAMPLES / BATCH_LEN)) && (rslt == BME69X_OK); i++)
+    {
+        rslt = bme69x_compensate_batch(&bme.calib, &batch, data, BATCH_LEN);
+    }
+
+    acc_end(&acc, &mock, i * BATCH_LEN);
+    report("compensate_batch", "none", &acc, rslt);
+}
+
+/***********************************************************************/
+/*                         Bench code                                  */
+/***********************************************************************/
+
+int main(int argc, char *argv[])
+{
+    static const struct bench_bus buses[] = {
+        { "i2c100k", BME69X_I2C_INTF, BME69X_MOCK_I2C_100K }, { "i2c400k", BME69X_I2C_INTF, BME69X_MOCK_I2C_400K },
+        { "spi1m", BME69X_SPI_INTF, BME69X_MOCK_SPI_1M }, { "spi10m", BME69X_SPI_INTF, BME69X_MOCK_SPI_10M }
+    };
+    uint8_t i;
+
+    /* -c prints comma separated values, to compare runs */
+    csv_output = (argc > 1) && (strcmp(argv[1], "-c") == 0);
+
+    print_header();
+
+    for (i = 0; i < (sizeof(buses) / sizeof(buses[0])); i++)
+    {
+        bench_bus(&buses[i]);
+    }
+
+    bench_compensate();
+
+    return bench_failed ? 1 : 0;
+}
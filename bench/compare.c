@@ -0,0 +1,571 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Compares the floating point and the fixed point compensation on one corpus of
+ * raw values. The program is built twice, once per variant. The first build
+ * compensates the corpus and writes a reference file holding the calibration
+ * coefficients, the raw values and its results; the second build compensates
+ * the same raw values and reports both costs and the largest deviations:
+ *
+ *   ./compare_fpu -w compare.ref [-f capture.bin]
+ *   ./compare_int -r compare.ref
+ *
+ * The reference file stores the structures as they are, it is only meant to be
+ * exchanged between builds of one host.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bme69x.h"
+#include "capture.h"
+#include "mock.h"
+
+/***********************************************************************/
+/*                         Macros                                      */
+/***********************************************************************/
+
+/* Number of synthetic samples, when no capture is given */
+#define N_SAMPLES      UINT32_C(100000)
+
+/* Number of timed passes over the corpus */
+#define N_PASSES       UINT32_C(10)
+
+/* Number of compared quantities */
+#define N_QTY          4
+
+/* Quantities, in the order of cmp_sample.value */
+#define QTY_TEMP       0
+#define QTY_PRES       1
+#define QTY_HUM        2
+#define QTY_GAS        3
+
+/* Identifies a reference file */
+#define CMP_MAGIC      "BME69XCM"
+
+/***********************************************************************/
+/*                         Corpus                                      */
+/***********************************************************************/
+
+struct cmp_header
+{
+    char magic[8];
+    uint32_t n_samples;
+
+    /* 1 if written by a floating point build */
+    uint32_t fpu;
+
+    /* Compensation cost of the writer */
+    double ns_per_sample;
+
+    uint8_t coeff[BME69X_LEN_COEFF_ALL];
+};
+
+/* Raw values and results of the writer in degree Celsius, Pascal, % and Ohm */
+struct cmp_sample
+{
+    uint32_t temp_adc;
+    uint32_t pres_adc;
+    uint16_t hum_adc;
+    uint16_t gas_adc;
+    uint8_t gas_range;
+    double value[N_QTY];
+};
+
+static const char *const qty_name[N_QTY] = { "temperature", "pressure", "humidity", "gas_resistance" };
+static const char *const qty_unit[N_QTY] = { "deg C", "Pa", "%", "ohm" };
+
+static uint64_t wall_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+/* One quantity of the compensated data, in the units of cmp_sample.value */
+static double get_value(const struct bme69x_data *data, uint8_t qty)
+{
+    double value;
+
+    switch (qty)
+    {
+        case QTY_TEMP:
+#ifdef BME69X_USE_FPU
+            value = data->temperature;
+#else
+            value = data->temperature / 100.0;
+#endif
+            break;
+        case QTY_PRES:
+            value = data->pressure;
+            break;
+        case QTY_HUM:
+#ifdef BME69X_USE_FPU
+            value = data->humidity;
+#else
+            value = data->humidity / 1000.0;
+#endif
+            break;
+        default:
+            value = data->gas_resistance;
+            break;
+    }
+
+    return value;
+}
+
+static void set_raw(struct bme69x_raw_field *raw, uint8_t qty, uint32_t adc)
+{
+    if (qty == QTY_TEMP)
+    {
+        raw->temp_adc = adc;
+    }
+    else if (qty == QTY_PRES)
+    {
+        raw->pres_adc = adc;
+    }
+    else
+    {
+        raw->hum_adc = (uint16_t)adc;
+    }
+}
+
+/*
+ * Raw value in [0, max] where a monotonic quantity reaches the target,
+ * the other raw values being those of base
+ */
+static uint32_t find_adc(const struct bme69x_calib_data *calib,
+                         const struct bme69x_raw_field *base,
+                         uint8_t qty,
+                         uint32_t max,
+                         double target)
+{
+    struct bme69x_raw_field raw = *base;
+    struct bme69x_data data;
+    uint32_t lo = 0, hi = max, mid;
+    double at_max;
+    int rising;
+
+    set_raw(&raw, qty, max);
+    (void)bme69x_compensate(calib, &raw, &data);
+    at_max = get_value(&data, qty);
+    set_raw(&raw, qty, 0);
+    (void)bme69x_compensate(calib, &raw, &data);
+    rising = at_max > get_value(&data, qty);
+
+    while (lo < hi)
+    {
+        mid = lo + ((hi - lo) / 2);
+        set_raw(&raw, qty, mid);
+        (void)bme69x_compensate(calib, &raw, &data);
+        if (rising ? (get_value(&data, qty) >= target) : (get_value(&data, qty) <= target))
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+
+    return lo;
+}
+
+static uint32_t lcg_next(uint32_t *state)
+{
+    *state = (*state * UINT32_C(1664525)) + UINT32_C(1013904223);
+
+    return *state >> 8;
+}
+
+static uint32_t in_band(uint32_t *state, uint32_t a, uint32_t b)
+{
+    uint32_t lo = (a < b) ? a : b;
+    uint32_t hi = (a < b) ? b : a;
+
+    return lo + (lcg_next(state) % (hi - lo + 1));
+}
+
+/*
+ * Deterministic sweep over the operating range of the calibration: -40 to
+ * 85 deg C, 300 to 1100 hPa, 0 to 100 % and every gas ADC value and range
+ */
+static void build_synthetic(const struct bme69x_calib_data *calib, struct cmp_sample *samples, uint32_t n_samples)
+{
+    struct bme69x_raw_field raw;
+    uint32_t t_band[2], p_band[2], h_band[2];
+    uint32_t state = 1;
+    uint32_t i;
+
+    memset(&raw, 0, sizeof(raw));
+    t_band[0] = find_adc(calib, &raw, QTY_TEMP, UINT32_C(0xffffff), -40.0);
+    t_band[1] = find_adc(calib, &raw, QTY_TEMP, UINT32_C(0xffffff), 85.0);
+
+    /* Pressure and humidity bands at room temperature */
+    raw.temp_adc = find_adc(calib, &raw, QTY_TEMP, UINT32_C(0xffffff), 25.0);
+    p_band[0] = find_adc(calib, &raw, QTY_PRES, UINT32_C(0xffffff), 30000.0);
+    p_band[1] = find_adc(calib, &raw, QTY_PRES, UINT32_C(0xffffff), 110000.0);
+    h_band[0] = find_adc(calib, &raw, QTY_HUM, UINT32_C(0xffff), 0.0);
+    h_band[1] = find_adc(calib, &raw, QTY_HUM, UINT32_C(0xffff), 100.0);
+
+    for (i = 0; i < n_samples; i++)
+    {
+        samples[i].temp_adc = in_band(&state, t_band[0], t_band[1]);
+        samples[i].pres_adc = in_band(&state, p_band[0], p_band[1]);
+        samples[i].hum_adc = (uint16_t)in_band(&state, h_band[0], h_band[1]);
+        samples[i].gas_adc = (uint16_t)(i % 1024);
+        samples[i].gas_range = (uint8_t)((i / 1024) & BME69X_GAS_RANGE_MSK);
+    }
+}
+
+/* Data records of a capture, key records are skipped */
+static uint32_t build_capture(struct bme69x_capture_reader *reader, struct cmp_sample *samples)
+{
+    struct bme69x_raw_field raw;
+    uint32_t n_samples = 0;
+    uint32_t i;
+
+    for (i = 0; i < reader->n_records; i++)
+    {
+        if (bme69x_capture_get_raw(reader, i, &raw, NULL) == BME69X_OK)
+        {
+            samples[n_samples].temp_adc = raw.temp_adc;
+            samples[n_samples].pres_adc = raw.pres_adc;
+            samples[n_samples].hum_adc = raw.hum_adc;
+            samples[n_samples].gas_adc = raw.gas_adc;
+            samples[n_samples].gas_range = raw.gas_range;
+            n_samples++;
+        }
+    }
+
+    return n_samples;
+}
+
+/*
+ * Compensates the corpus N_PASSES times and returns the cost per sample in
+ * nanoseconds. The results of the last pass are stored in values.
+ */
+static double compensate_all(const struct bme69x_calib_data *calib,
+                             const struct cmp_sample *samples,
+                             uint32_t n_samples,
+                             double (*values)[N_QTY])
+{
+    static struct bme69x_data data[256];
+    struct bme69x_raw_field raw;
+    uint64_t start;
+    uint32_t pass, i;
+    uint8_t q;
+
+    memset(&raw, 0, sizeof(raw));
+    start = wall_now_ns();
+    for (pass = 0; pass < N_PASSES; pass++)
+    {
+        for (i = 0; i < n_samples; i++)
+        {
+            raw.temp_adc = samples[i].temp_adc;
+            raw.pres_adc = samples[i].pres_adc;
+            raw.hum_adc = samples[i].hum_adc;
+            raw.gas_adc = samples[i].gas_adc;
+            raw.gas_range = samples[i].gas_range;
+            (void)bme69x_compensate(calib, &raw, &data[i & 0xff]);
+        }
+    }
+
+    start = wall_now_ns() - start;
+
+    /* Untimed pass collecting the results */
+    for (i = 0; i < n_samples; i++)
+    {
+        raw.temp_adc = samples[i].temp_adc;
+        raw.pres_adc = samples[i].pres_adc;
+        raw.hum_adc = samples[i].hum_adc;
+        raw.gas_adc = samples[i].gas_adc;
+        raw.gas_range = samples[i].gas_range;
+        (void)bme69x_compensate(calib, &raw, &data[0]);
+        for (q = 0; q < N_QTY; q++)
+        {
+            values[i][q] = get_value(&data[0], q);
+        }
+    }
+
+    return (n_samples > 0) ? ((double)start / ((double)n_samples * N_PASSES)) : 0;
+}
+
+/***********************************************************************/
+/*                         Writer and reader                           */
+/***********************************************************************/
+
+static const char *variant_name(uint32_t fpu)
+{
+    return fpu ? "fpu" : "int";
+}
+
+static int write_reference(const char *path, const char *capture_path)
+{
+    struct bme69x_capture_reader reader;
+    struct bme69x_calib_data calib;
+    struct bme69x_mock mock;
+    struct bme69x_dev bme;
+    struct cmp_header hdr;
+    struct cmp_sample *samples;
+    double (*values)[N_QTY];
+    FILE *fp;
+    uint32_t i;
+    int8_t rslt;
+
+    memset(&bme, 0, sizeof(bme));
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, CMP_MAGIC, sizeof(hdr.magic));
+    memset(&reader, 0, sizeof(reader));
+
+    if (capture_path != NULL)
+    {
+        rslt = bme69x_capture_map(&reader, capture_path);
+        if (rslt != BME69X_OK)
+        {
+            fprintf(stderr, "%s: cannot map capture (%d)\n", capture_path, rslt);
+
+            return 1;
+        }
+
+        memcpy(hdr.coeff, bme69x_capture_coeff(&reader), sizeof(hdr.coeff));
+        hdr.n_samples = reader.n_records;
+    }
+    else
+    {
+        /* Calibration of the simulated sensor */
+        memset(&bme, 0, sizeof(bme));
+        bme69x_mock_init(&mock, BME69X_I2C_INTF, BME69X_MOCK_I2C_400K);
+        bme69x_mock_attach(&mock, &bme);
+        rslt = bme69x_init(&bme);
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_get_coeff(hdr.coeff, &bme);
+        }
+
+        if (rslt != BME69X_OK)
+        {
+            fprintf(stderr, "simulated sensor: %d\n", rslt);
+
+            return 1;
+        }
+
+        hdr.n_samples = N_SAMPLES;
+    }
+
+    (void)bme69x_parse_calib(hdr.coeff, &calib);
+
+    samples = calloc(hdr.n_samples + 1, sizeof(*samples));
+    values = calloc(hdr.n_samples + 1, sizeof(*values));
+    if ((samples == NULL) || (values == NULL))
+    {
+        free(samples);
+        free(values);
+        bme69x_capture_unmap(&reader);
+
+        return 1;
+    }
+
+    if (capture_path != NULL)
+    {
+        hdr.n_samples = build_capture(&reader, samples);
+        bme69x_capture_unmap(&reader);
+    }
+    else
+    {
+        build_synthetic(&calib, samples, hdr.n_samples);
+    }
+
+#ifdef BME69X_USE_FPU
+    hdr.fpu = 1;
+#endif
+    hdr.ns_per_sample = compensate_all(&calib, samples, hdr.n_samples, values);
+    for (i = 0; i < hdr.n_samples; i++)
+    {
+        memcpy(samples[i].value, values[i], sizeof(samples[i].value));
+    }
+
+    fp = fopen(path, "wb");
+    if ((fp == NULL) || (fwrite(&hdr, sizeof(hdr), 1, fp) != 1) ||
+        (fwrite(samples, sizeof(*samples), hdr.n_samples, fp) != hdr.n_samples))
+    {
+        fprintf(stderr, "%s: cannot write reference\n", path);
+        rslt = BME69X_E_COM_FAIL;
+    }
+
+    if ((fp != NULL) && (fclose(fp) != 0))
+    {
+        rslt = BME69X_E_COM_FAIL;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        printf("%s: %lu samples, %s compensation %.1f ns/sample\n",
+               path,
+               (long unsigned int)hdr.n_samples,
+               variant_name(hdr.fpu),
+               hdr.ns_per_sample);
+    }
+
+    free(samples);
+    free(values);
+
+    return (rslt == BME69X_OK) ? 0 : 1;
+}
+
+static int compare_reference(const char *path)
+{
+    struct bme69x_calib_data calib;
+    struct cmp_header hdr;
+    struct cmp_sample *samples = NULL;
+    double (*values)[N_QTY] = NULL;
+    double max_abs[N_QTY], sum_abs[N_QTY], max_rel[N_QTY];
+    uint32_t at_max[N_QTY];
+    double ns_per_sample, err, ref;
+    uint32_t fpu = 0;
+    FILE *fp;
+    uint32_t i;
+    uint8_t q;
+    int ok;
+
+    fp = fopen(path, "rb");
+    ok = (fp != NULL) && (fread(&hdr, sizeof(hdr), 1, fp) == 1) &&
+         (memcmp(hdr.magic, CMP_MAGIC, sizeof(hdr.magic)) == 0);
+    if (ok)
+    {
+        samples = calloc(hdr.n_samples + 1, sizeof(*samples));
+        values = calloc(hdr.n_samples + 1, sizeof(*values));
+        ok = (samples != NULL) && (values != NULL) &&
+             (fread(samples, sizeof(*samples), hdr.n_samples, fp) == hdr.n_samples);
+    }
+
+    if (fp != NULL)
+    {
+        (void)fclose(fp);
+    }
+
+    if (!ok)
+    {
+        fprintf(stderr, "%s: not a reference file, see -w\n", path);
+        free(samples);
+        free(values);
+
+        return 1;
+    }
+
+#ifdef BME69X_USE_FPU
+    fpu = 1;
+#endif
+    if (fpu == hdr.fpu)
+    {
+        fprintf(stderr, "%s: written by a %s build as well\n", path, variant_name(fpu));
+    }
+
+    (void)bme69x_parse_calib(hdr.coeff, &calib);
+    ns_per_sample = compensate_all(&calib, samples, hdr.n_samples, values);
+
+    for (q = 0; q < N_QTY; q++)
+    {
+        max_abs[q] = 0;
+        sum_abs[q] = 0;
+        max_rel[q] = 0;
+        at_max[q] = 0;
+    }
+
+    for (i = 0; i < hdr.n_samples; i++)
+    {
+        for (q = 0; q < N_QTY; q++)
+        {
+            ref = samples[i].value[q];
+            err = fabs(values[i][q] - ref);
+            sum_abs[q] += err;
+            if (err > max_abs[q])
+            {
+                max_abs[q] = err;
+                at_max[q] = i;
+            }
+
+            if ((ref != 0) && ((err / fabs(ref)) > max_rel[q]))
+            {
+                max_rel[q] = err / fabs(ref);
+            }
+        }
+    }
+
+    printf("%lu samples\n", (long unsigned int)hdr.n_samples);
+    printf("%-8s %12s\n", "Variant", "ns/sample");
+    printf("%-8s %12.1f\n", variant_name(hdr.fpu), hdr.ns_per_sample);
+    printf("%-8s %12.1f\n", variant_name(fpu), ns_per_sample);
+    printf("\n%-16s %-6s %12s %12s %12s %14s %14s\n",
+           "Quantity",
+           "Unit",
+           "Max abs",
+           "Mean abs",
+           "Max rel %",
+           variant_name(hdr.fpu),
+           variant_name(fpu));
+    for (q = 0; q < N_QTY; q++)
+    {
+        printf("%-16s %-6s %12.4f %12.4f %12.5f %14.4f %14.4f\n",
+               qty_name[q],
+               qty_unit[q],
+               max_abs[q],
+               (hdr.n_samples > 0) ? (sum_abs[q] / hdr.n_samples) : 0,
+               max_rel[q] * 100.0,
+               samples[at_max[q]].value[q],
+               values[at_max[q]][q]);
+    }
+
+    free(samples);
+    free(values);
+
+    return 0;
+}
+
+/***********************************************************************/
+/*                         Compare code                                */
+/***********************************************************************/
+
+int main(int argc, char *argv[])
+{
+    const char *capture_path = NULL;
+    const char *write_path = NULL;
+    const char *read_path = NULL;
+    int i;
+
+    for (i = 1; i < (argc - 1); i += 2)
+    {
+        if (strcmp(argv[i], "-w") == 0)
+        {
+            write_path = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-r") == 0)
+        {
+            read_path = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-f") == 0)
+        {
+            capture_path = argv[i + 1];
+        }
+    }
+
+    if ((write_path == NULL) == (read_path == NULL))
+    {
+        fprintf(stderr, "usage: %s -w reference [-f capture] | -r reference\n", argv[0]);
+
+        return 2;
+    }
+
+    return (write_path != NULL) ? write_reference(write_path, capture_path) : compare_reference(read_path);
+}
@@ -1,1801 +1,4717 @@
-/**
-* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
-*
-* BSD-3-Clause
-*
-* Redistribution and use in source and binary forms, with or without
-* modification, are permitted provided that the following conditions are met:
-*
-* 1. Redistributions of source code must retain the above copyright
-*    notice, this list of conditions and the following disclaimer.
-*
-* 2. Redistributions in binary form must reproduce the above copyright
-*    notice, this list of conditions and the following disclaimer in the
-*    documentation and/or other materials provided with the distribution.
-*
-* 3. Neither the name of the copyright holder nor the names of its
-*    contributors may be used to endorse or promote products derived from
-*    this software without specific prior written permission.
-*
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
-* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
-* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
-* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
-* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
-* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
-* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
-* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-* POSSIBILITY OF SUCH DAMAGE.
-*
-* @file       bme69x.c
-* @date       2025-07-15
-* @version    v1.0.3
-*
-*/
-
-#include "bme69x.h"
-#include <stdio.h>
-
-/* This internal API is used to read the calibration coefficients */
-static int8_t get_calib_data(struct bme69x_dev *dev);
-
-/* This internal API is used to read variant ID information register status */
-static int8_t read_variant_id(struct bme69x_dev *dev);
-
-/* This internal API is used to calculate the gas wait */
-static uint8_t calc_gas_wait(uint16_t dur);
-
-#ifndef BME69X_USE_FPU
-
-/* This internal API is used to calculate the temperature in integer */
-static int16_t calc_temperature(uint32_t temp_adc, struct bme69x_dev *dev, uint32_t *t_lin);
-
-/* This internal API is used to calculate the pressure in integer */
-static uint32_t calc_pressure(uint32_t pres_adc, uint32_t t_lin, const struct bme69x_dev *dev);
-
-/* This internal API is used to calculate the humidity in integer */
-static uint32_t calc_humidity(uint16_t hum_adc, int16_t comp_temperature, const struct bme69x_dev *dev);
-
-/* This internal API is used to calculate the gas resistance for BME69x variant */
-static uint32_t calc_gas_resistance(uint16_t gas_res_adc, uint8_t gas_range);
-
-/* This internal API is used to calculate the heater resistance using integer */
-static uint8_t calc_res_heat(uint16_t temp, const struct bme69x_dev *dev);
-
-#else
-
-/* This internal API is used to calculate the temperature value in float */
-static float calc_temperature(uint32_t temp_adc, const struct bme69x_dev *dev);
-
-/* This internal API is used to calculate the pressure value in float */
-static float calc_pressure(uint32_t pres_adc, float comp_temperature, const struct bme69x_dev *dev);
-
-/* This internal API is used to calculate the humidity value in float */
-static float calc_humidity(uint16_t hum_adc, float comp_temperature, const struct bme69x_dev *dev);
-
-/* This internal API is used to calculate the gas for BME69x variant in float */
-static float calc_gas_resistance(uint16_t gas_res_adc, uint8_t gas_range);
-
-/* This internal API is used to calculate the heater resistance value using float */
-static uint8_t calc_res_heat(uint16_t temp, const struct bme69x_dev *dev);
-
-#endif
-
-/* This internal API is used to read a single data of the sensor */
-static int8_t read_field_data(uint8_t index, struct bme69x_data *data, struct bme69x_dev *dev);
-
-/* This internal API is used to read all data fields of the sensor */
-static int8_t read_all_field_data(struct bme69x_data * const data[], struct bme69x_dev *dev);
-
-/* This internal API is used to switch between SPI memory pages */
-static int8_t set_mem_page(uint8_t reg_addr, struct bme69x_dev *dev);
-
-/* This internal API is used to get the current SPI memory page */
-static int8_t get_mem_page(struct bme69x_dev *dev);
-
-/* This internal API is used to check the bme69x_dev for null pointers */
-static int8_t null_ptr_check(const struct bme69x_dev *dev);
-
-/* This internal API is used to set heater configurations */
-static int8_t set_conf(const struct bme69x_heatr_conf *conf, uint8_t op_mode, uint8_t *nb_conv, struct bme69x_dev *dev);
-
-/* This internal API is used to limit the max value of a parameter */
-static int8_t boundary_check(uint8_t *value, uint8_t max, struct bme69x_dev *dev);
-
-/* This internal API is used to calculate the register value for
- * shared heater duration */
-static uint8_t calc_heatr_dur_shared(uint16_t dur);
-
-/* This internal API is used to swap two fields */
-static void swap_fields(uint8_t index1, uint8_t index2, struct bme69x_data *field[]);
-
-/* This internal API is used sort the sensor data */
-static void sort_sensor_data(uint8_t low_index, uint8_t high_index, struct bme69x_data *field[]);
-
-/*
- * @brief       Function to analyze the sensor data
- *
- * @param[in]   data    Array of measurement data
- * @param[in]   n_meas  Number of measurements
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t analyze_sensor_data(const struct bme69x_data *data, uint8_t n_meas);
-
-/******************************************************************************************/
-/*                                 Global API definitions                                 */
-/******************************************************************************************/
-
-/* @brief This API reads the chip-id of the sensor which is the first step to
-* verify the sensor and also calibrates the sensor
-* As this API is the entry point, call this API before using other APIs.
-*/
-int8_t bme69x_init(struct bme69x_dev *dev)
-{
-    int8_t rslt;
-
-    (void) bme69x_soft_reset(dev);
-
-    rslt = bme69x_get_regs(BME69X_REG_CHIP_ID, &dev->chip_id, 1, dev);
-
-    if (rslt == BME69X_OK)
-    {
-        if (dev->chip_id == BME69X_CHIP_ID)
-        {
-            /* Read Variant ID */
-            rslt = read_variant_id(dev);
-
-            if (rslt == BME69X_OK)
-            {
-                /* Get the Calibration data */
-                rslt = get_calib_data(dev);
-            }
-        }
-        else
-        {
-            rslt = BME69X_E_DEV_NOT_FOUND;
-        }
-    }
-
-    return rslt;
-}
-
-/*
- * @brief This API writes the given data to the register address of the sensor
- */
-int8_t bme69x_set_regs(const uint8_t *reg_addr, const uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-
-    /* Length of the temporary buffer is 2*(length of register)*/
-    uint8_t tmp_buff[BME69X_LEN_INTERLEAVE_BUFF] = { 0 };
-    uint16_t index;
-
-    /* Check for null pointer in the device structure*/
-    rslt = null_ptr_check(dev);
-    if ((rslt == BME69X_OK) && reg_addr && reg_data)
-    {
-        if ((len > 0) && (len <= (BME69X_LEN_INTERLEAVE_BUFF / 2)))
-        {
-            /* Interleave the 2 arrays */
-            for (index = 0; index < len; index++)
-            {
-                if (dev->intf == BME69X_SPI_INTF)
-                {
-                    /* Set the memory page */
-                    rslt = set_mem_page(reg_addr[index], dev);
-                    tmp_buff[(2 * index)] = reg_addr[index] & BME69X_SPI_WR_MSK;
-                }
-                else
-                {
-                    tmp_buff[(2 * index)] = reg_addr[index];
-                }
-
-                tmp_buff[(2 * index) + 1] = reg_data[index];
-            }
-
-            /* Write the interleaved array */
-            if (rslt == BME69X_OK)
-            {
-                dev->intf_rslt = dev->write(tmp_buff[0], &tmp_buff[1], (2 * len) - 1, dev->intf_ptr);
-                if (dev->intf_rslt != 0)
-                {
-                    rslt = BME69X_E_COM_FAIL;
-                }
-            }
-        }
-        else
-        {
-            rslt = BME69X_E_INVALID_LENGTH;
-        }
-    }
-    else
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-/*
- * @brief This API reads the data from the given register address of sensor.
- */
-int8_t bme69x_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-
-    /* Check for null pointer in the device structure*/
-    rslt = null_ptr_check(dev);
-    if ((rslt == BME69X_OK) && reg_data)
-    {
-        if (dev->intf == BME69X_SPI_INTF)
-        {
-            /* Set the memory page */
-            rslt = set_mem_page(reg_addr, dev);
-            if (rslt == BME69X_OK)
-            {
-                reg_addr = reg_addr | BME69X_SPI_RD_MSK;
-            }
-        }
-
-        dev->intf_rslt = dev->read(reg_addr, reg_data, len, dev->intf_ptr);
-        if (dev->intf_rslt != 0)
-        {
-            rslt = BME69X_E_COM_FAIL;
-        }
-    }
-    else
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-/*
- * @brief This API soft-resets the sensor.
- */
-int8_t bme69x_soft_reset(struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t reg_addr = BME69X_REG_SOFT_RESET;
-
-    /* 0xb6 is the soft reset command */
-    uint8_t soft_rst_cmd = BME69X_SOFT_RESET_CMD;
-
-    /* Check for null pointer in the device structure*/
-    rslt = null_ptr_check(dev);
-    if (rslt == BME69X_OK)
-    {
-        if (dev->intf == BME69X_SPI_INTF)
-        {
-            rslt = get_mem_page(dev);
-        }
-
-        /* Reset the device */
-        if (rslt == BME69X_OK)
-        {
-            rslt = bme69x_set_regs(&reg_addr, &soft_rst_cmd, 1, dev);
-
-            if (rslt == BME69X_OK)
-            {
-                /* Wait for 5ms */
-                dev->delay_us(BME69X_PERIOD_RESET, dev->intf_ptr);
-
-                /* After reset get the memory page */
-                if (dev->intf == BME69X_SPI_INTF)
-                {
-                    rslt = get_mem_page(dev);
-                }
-            }
-        }
-    }
-
-    return rslt;
-}
-
-/*
- * @brief This API is used to set the oversampling, filter and odr configuration
- */
-int8_t bme69x_set_conf(struct bme69x_conf *conf, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t odr20 = 0, odr3 = 1;
-    uint8_t current_op_mode;
-
-    /* Register data starting from BME69X_REG_CTRL_GAS_1(0x71) up to BME69X_REG_CONFIG(0x75) */
-    uint8_t reg_array[BME69X_LEN_CONFIG] = { 0x71, 0x72, 0x73, 0x74, 0x75 };
-    uint8_t data_array[BME69X_LEN_CONFIG] = { 0 };
-
-    rslt = bme69x_get_op_mode(&current_op_mode, dev);
-    if (rslt == BME69X_OK)
-    {
-        /* Configure only in the sleep mode */
-        rslt = bme69x_set_op_mode(BME69X_SLEEP_MODE, dev);
-    }
-
-    if (conf == NULL)
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-    else if (rslt == BME69X_OK)
-    {
-        /* Read the whole configuration and write it back once later */
-        rslt = bme69x_get_regs(reg_array[0], data_array, BME69X_LEN_CONFIG, dev);
-        dev->info_msg = BME69X_OK;
-        if (rslt == BME69X_OK)
-        {
-            rslt = boundary_check(&conf->filter, BME69X_FILTER_SIZE_127, dev);
-        }
-
-        if (rslt == BME69X_OK)
-        {
-            rslt = boundary_check(&conf->os_temp, BME69X_OS_16X, dev);
-        }
-
-        if (rslt == BME69X_OK)
-        {
-            rslt = boundary_check(&conf->os_pres, BME69X_OS_16X, dev);
-        }
-
-        if (rslt == BME69X_OK)
-        {
-            rslt = boundary_check(&conf->os_hum, BME69X_OS_16X, dev);
-        }
-
-        if (rslt == BME69X_OK)
-        {
-            rslt = boundary_check(&conf->odr, BME69X_ODR_NONE, dev);
-        }
-
-        if (rslt == BME69X_OK)
-        {
-            data_array[4] = BME69X_SET_BITS(data_array[4], BME69X_FILTER, conf->filter);
-            data_array[3] = BME69X_SET_BITS(data_array[3], BME69X_OST, conf->os_temp);
-            data_array[3] = BME69X_SET_BITS(data_array[3], BME69X_OSP, conf->os_pres);
-            data_array[1] = BME69X_SET_BITS_POS_0(data_array[1], BME69X_OSH, conf->os_hum);
-            if (conf->odr != BME69X_ODR_NONE)
-            {
-                odr20 = conf->odr;
-                odr3 = 0;
-            }
-
-            data_array[4] = BME69X_SET_BITS(data_array[4], BME69X_ODR20, odr20);
-            data_array[0] = BME69X_SET_BITS(data_array[0], BME69X_ODR3, odr3);
-        }
-    }
-
-    if (rslt == BME69X_OK)
-    {
-        rslt = bme69x_set_regs(reg_array, data_array, BME69X_LEN_CONFIG, dev);
-    }
-
-    if ((current_op_mode != BME69X_SLEEP_MODE) && (rslt == BME69X_OK))
-    {
-        rslt = bme69x_set_op_mode(current_op_mode, dev);
-    }
-
-    return rslt;
-}
-
-/*
- * @brief This API is used to get the oversampling, filter and odr
- */
-int8_t bme69x_get_conf(struct bme69x_conf *conf, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-
-    /* starting address of the register array for burst read*/
-    uint8_t reg_addr = BME69X_REG_CTRL_GAS_1;
-    uint8_t data_array[BME69X_LEN_CONFIG];
-
-    rslt = bme69x_get_regs(reg_addr, data_array, 5, dev);
-    if (!conf)
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-    else if (rslt == BME69X_OK)
-    {
-        conf->os_hum = BME69X_GET_BITS_POS_0(data_array[1], BME69X_OSH);
-        conf->filter = BME69X_GET_BITS(data_array[4], BME69X_FILTER);
-        conf->os_temp = BME69X_GET_BITS(data_array[3], BME69X_OST);
-        conf->os_pres = BME69X_GET_BITS(data_array[3], BME69X_OSP);
-        if (BME69X_GET_BITS(data_array[0], BME69X_ODR3))
-        {
-            conf->odr = BME69X_ODR_NONE;
-        }
-        else
-        {
-            conf->odr = BME69X_GET_BITS(data_array[4], BME69X_ODR20);
-        }
-    }
-
-    return rslt;
-}
-
-/*
- * @brief This API is used to set the operation mode of the sensor
- */
-int8_t bme69x_set_op_mode(const uint8_t op_mode, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t tmp_pow_mode;
-    uint8_t pow_mode = 0;
-    uint8_t reg_addr = BME69X_REG_CTRL_MEAS;
-
-    /* Call until in sleep */
-    do
-    {
-        rslt = bme69x_get_regs(BME69X_REG_CTRL_MEAS, &tmp_pow_mode, 1, dev);
-        if (rslt == BME69X_OK)
-        {
-            /* Put to sleep before changing mode */
-            pow_mode = (tmp_pow_mode & BME69X_MODE_MSK);
-            if (pow_mode != BME69X_SLEEP_MODE)
-            {
-                tmp_pow_mode &= ~BME69X_MODE_MSK; /* Set to sleep */
-                rslt = bme69x_set_regs(&reg_addr, &tmp_pow_mode, 1, dev);
-                dev->delay_us(BME69X_PERIOD_POLL, dev->intf_ptr);
-            }
-        }
-    } while ((pow_mode != BME69X_SLEEP_MODE) && (rslt == BME69X_OK));
-
-    /* Already in sleep */
-    if ((op_mode != BME69X_SLEEP_MODE) && (rslt == BME69X_OK))
-    {
-        tmp_pow_mode = (tmp_pow_mode & ~BME69X_MODE_MSK) | (op_mode & BME69X_MODE_MSK);
-        rslt = bme69x_set_regs(&reg_addr, &tmp_pow_mode, 1, dev);
-    }
-
-    return rslt;
-}
-
-/*
- * @brief This API is used to get the operation mode of the sensor.
- */
-int8_t bme69x_get_op_mode(uint8_t *op_mode, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t mode;
-
-    if (op_mode)
-    {
-        rslt = bme69x_get_regs(BME69X_REG_CTRL_MEAS, &mode, 1, dev);
-
-        /* Masking the other register bit info*/
-        *op_mode = mode & BME69X_MODE_MSK;
-    }
-    else
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-/*
- * @brief This API is used to get the remaining duration that can be used for heating.
- */
-uint32_t bme69x_get_meas_dur(const uint8_t op_mode, struct bme69x_conf *conf, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint32_t meas_dur = 0; /* Calculate in us */
-    uint32_t meas_cycles;
-    uint8_t os_to_meas_cycles[6] = { 0, 1, 2, 4, 8, 16 };
-
-    if (conf != NULL)
-    {
-        /* Boundary check for temperature oversampling */
-        rslt = boundary_check(&conf->os_temp, BME69X_OS_16X, dev);
-
-        if (rslt == BME69X_OK)
-        {
-            /* Boundary check for pressure oversampling */
-            rslt = boundary_check(&conf->os_pres, BME69X_OS_16X, dev);
-        }
-
-        if (rslt == BME69X_OK)
-        {
-            /* Boundary check for humidity oversampling */
-            rslt = boundary_check(&conf->os_hum, BME69X_OS_16X, dev);
-        }
-
-        if (rslt == BME69X_OK)
-        {
-            meas_cycles = os_to_meas_cycles[conf->os_temp];
-            meas_cycles += os_to_meas_cycles[conf->os_pres];
-            meas_cycles += os_to_meas_cycles[conf->os_hum];
-
-            /* TPH measurement duration */
-            meas_dur = meas_cycles * UINT32_C(1963);
-            meas_dur += UINT32_C(477 * 4); /* TPH switching duration */
-            meas_dur += UINT32_C(477 * 5); /* Gas measurement duration */
-
-            if (op_mode != BME69X_PARALLEL_MODE)
-            {
-                meas_dur += UINT32_C(1000); /* Wake up duration of 1ms */
-            }
-        }
-    }
-
-    return meas_dur;
-}
-
-/*
- * @brief This API reads the pressure, temperature and humidity and gas data
- * from the sensor, compensates the data and store it in the bme69x_data
- * structure instance passed by the user.
- */
-int8_t bme69x_get_data(uint8_t op_mode, struct bme69x_data *data, uint8_t *n_data, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t i = 0, j = 0, new_fields = 0;
-    struct bme69x_data *field_ptr[3] = { 0 };
-    struct bme69x_data field_data[3] = { { 0 } };
-
-    field_ptr[0] = &field_data[0];
-    field_ptr[1] = &field_data[1];
-    field_ptr[2] = &field_data[2];
-
-    rslt = null_ptr_check(dev);
-    if ((rslt == BME69X_OK) && (data != NULL))
-    {
-        /* Reading the sensor data in forced mode only */
-        if (op_mode == BME69X_FORCED_MODE)
-        {
-            rslt = read_field_data(0, data, dev);
-            if (rslt == BME69X_OK)
-            {
-                if (data->status & BME69X_NEW_DATA_MSK)
-                {
-                    new_fields = 1;
-                }
-                else
-                {
-                    new_fields = 0;
-                    rslt = BME69X_W_NO_NEW_DATA;
-                }
-            }
-        }
-        else if ((op_mode == BME69X_PARALLEL_MODE) || (op_mode == BME69X_SEQUENTIAL_MODE))
-        {
-            /* Read the 3 fields and count the number of new data fields */
-            rslt = read_all_field_data(field_ptr, dev);
-
-            new_fields = 0;
-            for (i = 0; (i < 3) && (rslt == BME69X_OK); i++)
-            {
-                if (field_ptr[i]->status & BME69X_NEW_DATA_MSK)
-                {
-                    new_fields++;
-                }
-            }
-
-            /* Sort the sensor data in parallel & sequential modes*/
-            for (i = 0; (i < 2) && (rslt == BME69X_OK); i++)
-            {
-                for (j = i + 1; j < 3; j++)
-                {
-                    sort_sensor_data(i, j, field_ptr);
-                }
-            }
-
-            /* Copy the sorted data */
-            for (i = 0; ((i < 3) && (rslt == BME69X_OK)); i++)
-            {
-                data[i] = *field_ptr[i];
-            }
-
-            if (new_fields == 0)
-            {
-                rslt = BME69X_W_NO_NEW_DATA;
-            }
-        }
-        else
-        {
-            rslt = BME69X_W_DEFINE_OP_MODE;
-        }
-
-        if (n_data == NULL)
-        {
-            rslt = BME69X_E_NULL_PTR;
-        }
-        else
-        {
-            *n_data = new_fields;
-        }
-    }
-    else
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-/*
- * @brief This API is used to set the gas configuration of the sensor.
- */
-int8_t bme69x_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t nb_conv = 0;
-    uint8_t hctrl, run_gas = 0;
-    uint8_t ctrl_gas_data[2];
-    uint8_t ctrl_gas_addr[2] = { BME69X_REG_CTRL_GAS_0, BME69X_REG_CTRL_GAS_1 };
-
-    if (conf != NULL)
-    {
-        rslt = bme69x_set_op_mode(BME69X_SLEEP_MODE, dev);
-        if (rslt == BME69X_OK)
-        {
-            rslt = set_conf(conf, op_mode, &nb_conv, dev);
-        }
-
-        if (rslt == BME69X_OK)
-        {
-            rslt = bme69x_get_regs(BME69X_REG_CTRL_GAS_0, ctrl_gas_data, 2, dev);
-            if (rslt == BME69X_OK)
-            {
-                if (conf->enable == BME69X_ENABLE)
-                {
-                    hctrl = BME69X_ENABLE_HEATER;
-                    run_gas = BME69X_ENABLE_GAS_MEAS;
-
-                }
-                else
-                {
-                    hctrl = BME69X_DISABLE_HEATER;
-                    run_gas = BME69X_DISABLE_GAS_MEAS;
-                }
-
-                ctrl_gas_data[0] = BME69X_SET_BITS(ctrl_gas_data[0], BME69X_HCTRL, hctrl);
-                ctrl_gas_data[1] = BME69X_SET_BITS_POS_0(ctrl_gas_data[1], BME69X_NBCONV, nb_conv);
-                ctrl_gas_data[1] = BME69X_SET_BITS(ctrl_gas_data[1], BME69X_RUN_GAS, run_gas);
-
-                rslt = bme69x_set_regs(ctrl_gas_addr, ctrl_gas_data, 2, dev);
-            }
-        }
-    }
-    else
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This API is used to get the gas configuration of the sensor.
- */
-int8_t bme69x_get_heatr_conf(const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev)
-{
-    int8_t rslt = BME69X_OK;
-    uint8_t data_array[10] = { 0 };
-    uint8_t i;
-
-    if ((conf != NULL) && (conf->heatr_dur_prof != NULL) && (conf->heatr_temp_prof != NULL))
-    {
-        /* FIXME: Add conversion to deg C and ms and add the other parameters */
-        rslt = bme69x_get_regs(BME69X_REG_RES_HEAT0, data_array, 10, dev);
-
-        if (rslt == BME69X_OK)
-        {
-            for (i = 0; i < conf->profile_len; i++)
-            {
-                conf->heatr_temp_prof[i] = data_array[i];
-            }
-
-            rslt = bme69x_get_regs(BME69X_REG_GAS_WAIT0, data_array, 10, dev);
-
-            if (rslt == BME69X_OK)
-            {
-                for (i = 0; i < conf->profile_len; i++)
-                {
-                    conf->heatr_dur_prof[i] = data_array[i];
-                }
-            }
-        }
-    }
-    else
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-/*
- * @brief This API performs Self-test of low and high gas variants of BME69X
- */
-int8_t bme69x_selftest_check(const struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t n_fields;
-    uint8_t i = 0;
-    struct bme69x_data data[BME69X_N_MEAS] = { { 0 } };
-    struct bme69x_dev t_dev;
-    struct bme69x_conf conf;
-    struct bme69x_heatr_conf heatr_conf;
-
-    rslt = null_ptr_check(dev);
-
-    if (rslt == BME69X_OK)
-    {
-        /* Copy required parameters from reference bme69x_dev struct */
-        t_dev.amb_temp = 25;
-        t_dev.read = dev->read;
-        t_dev.write = dev->write;
-        t_dev.intf = dev->intf;
-        t_dev.delay_us = dev->delay_us;
-        t_dev.intf_ptr = dev->intf_ptr;
-
-        rslt = bme69x_init(&t_dev);
-    }
-
-    if (rslt == BME69X_OK)
-    {
-        /* Set the temperature, pressure and humidity & filter settings */
-        conf.os_hum = BME69X_OS_1X;
-        conf.os_pres = BME69X_OS_16X;
-        conf.os_temp = BME69X_OS_2X;
-
-        /* Set the remaining gas sensor settings and link the heating profile */
-        heatr_conf.enable = BME69X_ENABLE;
-        heatr_conf.heatr_dur = BME69X_HEATR_DUR1;
-        heatr_conf.heatr_temp = BME69X_HIGH_TEMP;
-        rslt = bme69x_set_heatr_conf(BME69X_FORCED_MODE, &heatr_conf, &t_dev);
-        if (rslt == BME69X_OK)
-        {
-            rslt = bme69x_set_conf(&conf, &t_dev);
-            if (rslt == BME69X_OK)
-            {
-                rslt = bme69x_set_op_mode(BME69X_FORCED_MODE, &t_dev); /* Trigger a measurement */
-                if (rslt == BME69X_OK)
-                {
-                    /* Wait for the measurement to complete */
-                    t_dev.delay_us(BME69X_HEATR_DUR1_DELAY, t_dev.intf_ptr);
-                    rslt = bme69x_get_data(BME69X_FORCED_MODE, &data[0], &n_fields, &t_dev);
-                    if (rslt == BME69X_OK)
-                    {
-                        if ((data[0].idac != 0x00) && (data[0].idac != 0xFF) &&
-                            (data[0].status & BME69X_GASM_VALID_MSK))
-                        {
-                            rslt = BME69X_OK;
-                        }
-                        else
-                        {
-                            rslt = BME69X_E_SELF_TEST;
-                        }
-                    }
-                }
-            }
-        }
-
-        heatr_conf.heatr_dur = BME69X_HEATR_DUR2;
-        while ((rslt == BME69X_OK) && (i < BME69X_N_MEAS))
-        {
-            if (i % 2 == 0)
-            {
-                heatr_conf.heatr_temp = BME69X_HIGH_TEMP; /* Higher temperature */
-            }
-            else
-            {
-                heatr_conf.heatr_temp = BME69X_LOW_TEMP; /* Lower temperature */
-            }
-
-            rslt = bme69x_set_heatr_conf(BME69X_FORCED_MODE, &heatr_conf, &t_dev);
-            if (rslt == BME69X_OK)
-            {
-                rslt = bme69x_set_conf(&conf, &t_dev);
-                if (rslt == BME69X_OK)
-                {
-                    rslt = bme69x_set_op_mode(BME69X_FORCED_MODE, &t_dev); /* Trigger a measurement */
-                    if (rslt == BME69X_OK)
-                    {
-                        /* Wait for the measurement to complete */
-                        t_dev.delay_us(BME69X_HEATR_DUR2_DELAY, t_dev.intf_ptr);
-                        rslt = bme69x_get_data(BME69X_FORCED_MODE, &data[i], &n_fields, &t_dev);
-                    }
-                }
-            }
-
-            i++;
-        }
-
-        if (rslt == BME69X_OK)
-        {
-            rslt = analyze_sensor_data(data, BME69X_N_MEAS);
-        }
-    }
-
-    return rslt;
-}
-
-/*****************************INTERNAL APIs***********************************************/
-#ifndef BME69X_USE_FPU
-
-/* @brief This internal API is used to calculate the temperature value. */
-static int16_t calc_temperature(uint32_t temp_adc, struct bme69x_dev *dev, uint32_t *t_lin)
-{
-    int64_t partial_data1;
-    int64_t partial_data2;
-    int64_t partial_data3;
-    int64_t partial_data4;
-    int64_t partial_data5;
-    int64_t partial_data6;
-    int64_t tem_comp;
-
-    partial_data1 = (int64_t)(temp_adc - (256U * dev->calib.par_t1));
-    partial_data2 = (int64_t)(partial_data1 * (int64_t)dev->calib.par_t2);
-    partial_data3 = (int64_t)(partial_data1 * partial_data1);
-    partial_data4 = (int64_t)(partial_data3 * (int64_t)dev->calib.par_t3);
-    partial_data5 = (int64_t)((int64_t)(partial_data2 * 262144UL) + partial_data4);
-    partial_data6 = (int64_t)(partial_data5 / 4294967296ULL);
-    *t_lin = (uint32_t)partial_data6;
-    tem_comp = (int64_t)((partial_data6 * 25U) / 16384UL);
-
-    return (int16_t)(tem_comp);
-}
-
-/* @brief This internal API is used to calculate the pressure value. */
-static uint32_t calc_pressure(uint32_t pres_adc, uint32_t t_lin, const struct bme69x_dev *dev)
-{
-    int64_t partial_data1;
-    int64_t partial_data2;
-    int64_t partial_data3;
-    int64_t partial_data4;
-    int64_t partial_data5;
-    int64_t partial_data6;
-    int64_t offset;
-    int64_t sensitivity;
-    int64_t press_comp;
-    int64_t t_lin_64;
-
-    t_lin_64 = (int64_t)t_lin;
-
-    partial_data1 = t_lin_64 * t_lin_64;
-    partial_data2 = partial_data1 / 64;
-    partial_data3 = partial_data2 * t_lin_64 / 256;
-    partial_data4 = dev->calib.par_p4 * partial_data3 / 32;
-    partial_data5 = dev->calib.par_p3 * partial_data1 * 16;
-    partial_data6 = dev->calib.par_p2 * t_lin_64 * (1 << 22);
-
-    offset = dev->calib.par_p1 * ((int64_t)1 << 47) + partial_data4 + partial_data5 + partial_data6;
-    partial_data2 = (dev->calib.par_p8 * partial_data3) / (1 << 5);
-    partial_data4 = dev->calib.par_p7 * partial_data1 * (1 << 2);
-
-    partial_data5 = (dev->calib.par_p6 - 16384) * t_lin_64 * (1 << 21);
-    sensitivity = (dev->calib.par_p5 - 16384) * ((int64_t)1 << 46) + partial_data2 + partial_data4 + partial_data5;
-    partial_data1 = sensitivity / (1 << 24) * pres_adc;
-
-    partial_data2 = dev->calib.par_p10 * t_lin_64;
-    partial_data3 = partial_data2 + dev->calib.par_p9 * (1 << 16);
-    partial_data4 = partial_data3 * pres_adc / (1 << 13);
-    partial_data5 = (pres_adc * partial_data4 / 10) / (1 << 9);
-    partial_data5 = partial_data5 * 10;
-    partial_data6 = pres_adc * pres_adc;
-
-    partial_data2 = dev->calib.par_p11 * partial_data6 / (1 << 16);
-    partial_data3 = partial_data2 * pres_adc / (1 << 7);
-    partial_data4 = offset / 4 + partial_data1 + partial_data5 + partial_data3;
-
-    press_comp = (partial_data4 / ((int64_t)1 << 40)) * 25;
-
-    return (uint32_t)(press_comp / 100);
-}
-
-/* This internal API is used to calculate the humidity in integer */
-static uint32_t calc_humidity(uint16_t hum_adc, int16_t comp_temperature, const struct bme69x_dev *dev)
-{
-    uint32_t hum_comp;
-    int64_t hum_64 = hum_adc;
-    int64_t t_comp = comp_temperature;
-    int64_t t_fine = (t_comp * 256 - 128) / 5;
-    int64_t var_H = t_fine - 76800UL;
-
-    var_H =
-        (((((hum_64 * 16384UL) - (dev->calib.par_h1 * 1048576UL) - (dev->calib.par_h2 * var_H)) + 16384UL) / 32768UL) *
-         ((((((var_H * dev->calib.par_h4) / 1024UL) * ((var_H * dev->calib.par_h3) / 2048UL + 32768UL)) / 1024UL) +
-           2097152ULL) * dev->calib.par_h5 + 8192UL) / 16384UL);
-
-    var_H = var_H - (((((var_H / 32768UL) * (var_H / 32768UL)) / 128UL) * dev->calib.par_h6) / 16UL);
-
-    if (var_H < 0)
-    {
-        var_H = 0;
-    }
-
-    if (var_H > 419430400)
-    {
-        var_H = 419430400;
-    }
-
-    hum_comp = (uint32_t)(var_H / 4096UL);
-
-    return hum_comp;
-}
-
-/* This internal API is used to calculate the gas resistance */
-static uint32_t calc_gas_resistance(uint16_t gas_res_adc, uint8_t gas_range)
-{
-    uint32_t calc_gas_res;
-    uint32_t var1 = UINT32_C(262144) >> gas_range;
-    int32_t var2 = (int32_t)gas_res_adc - INT32_C(512);
-
-    var2 *= INT32_C(3);
-    var2 = INT32_C(4096) + var2;
-
-    /* multiplying 10000 then dividing then multiplying by 100 instead of multiplying by 1000000 to prevent overflow */
-    calc_gas_res = (UINT32_C(10000) * var1) / (uint32_t)var2;
-    calc_gas_res = calc_gas_res * 100;
-
-    return calc_gas_res;
-}
-
-/* This internal API is used to calculate the heater resistance value using integer */
-static uint8_t calc_res_heat(uint16_t temp, const struct bme69x_dev *dev)
-{
-    uint8_t heatr_res;
-    int32_t var1;
-    int32_t var2;
-    int32_t var3;
-    int32_t var4;
-    int32_t var5;
-    int32_t heatr_res_x100;
-
-    if (temp > 400) /* Cap temperature */
-    {
-        temp = 400;
-    }
-
-    var1 = (((int32_t)dev->amb_temp * dev->calib.par_g3) / 1000U) * 256; /* par_g1 */
-    var2 = (dev->calib.par_g1 + 784) * (((((dev->calib.par_g2 + 154009UL) * temp * 5) / 100) + 3276800ULL) / 10); /* par_g2,
-                                                                                                                   * par_g3 */
-    var3 = var1 + (var2 >> 1);
-    var4 = (var3 / (dev->calib.res_heat_range + 4));
-    var5 = (131 * dev->calib.res_heat_val) + 65536UL;
-    heatr_res_x100 = (int32_t)(((var4 / var5) - 250) * 34);
-    heatr_res = (uint8_t)((heatr_res_x100 + 50) / 100);
-
-    return heatr_res;
-}
-
-#else
-
-/* @brief This internal API is used to calculate the temperature value. */
-static float calc_temperature(uint32_t temp_adc, const struct bme69x_dev *dev)
-{
-    int32_t do1, cf;
-    double dtk1, dtk2, temp1, temp2;
-    double calc_temp;
-
-    do1 = (int32_t)dev->calib.par_t1 << 8;
-    dtk1 = (double)dev->calib.par_t2 / (double)(1ULL << 30);
-    dtk2 = (double)dev->calib.par_t3 / (double)(1ULL << 48);
-
-    cf = temp_adc - do1;
-    temp1 = (double)(cf * dtk1);
-    temp2 = (double)cf * (double)cf * dtk2;
-
-    calc_temp = temp1 + temp2;
-
-    return (float)calc_temp;
-}
-
-/* @brief This internal API is used to calculate the pressure value. */
-static float calc_pressure(uint32_t pres_adc, float comp_temperature, const struct bme69x_dev *dev)
-{
-    uint32_t o;
-    double tk10, tk20, tk30;
-    double s;
-    double tk1s, tk2s, tk3s;
-    double nls, tknls, nls3;
-    double calc_pres, tmp1, tmp2, tmp3, tmp4;
-
-    o = (uint32_t)dev->calib.par_p1 * (uint32_t)(1ULL << 3);
-    tk10 = (double)dev->calib.par_p2 / (double)(1ULL << 6);
-    tk20 = (double)dev->calib.par_p3 / (double)(1ULL << 8);
-    tk30 = (double)dev->calib.par_p4 / (double)(1ULL << 15);
-
-    s = ((double)dev->calib.par_p5 - (double)(1ULL << 14)) / (double)(1ULL << 20);
-    tk1s = ((double)dev->calib.par_p6 - (double)(1ULL << 14)) / (double)(1ULL << 29);
-    tk2s = (double)dev->calib.par_p7 / (double)(1ULL << 32);
-    tk3s = (double)dev->calib.par_p8 / (double)(1ULL << 37);
-
-    nls = (double)dev->calib.par_p9 / (double)(1ULL << 48);
-    tknls = (double)dev->calib.par_p10 / (double)(1ULL << 48);
-
-    /*
-     * NLS3 = par_p11 / 2^65
-     * 2^65 is exceeding the width of 'double' datatype and hence we splitted into two factors since A^(x+y) = A^x * A^y
-     */
-    nls3 = (double)dev->calib.par_p11 / ((double)(1ULL << 35) * (double)(1ULL << 30));
-
-    tmp1 = (double)o + (tk10 * comp_temperature) + (tk20 * comp_temperature * comp_temperature) +
-           (tk30 * comp_temperature * comp_temperature * comp_temperature);
-
-    tmp2 = (double)pres_adc *
-           ((double)s + (tk1s * comp_temperature) + (tk2s * comp_temperature * comp_temperature) +
-            (tk3s * comp_temperature * comp_temperature * comp_temperature));
-
-    tmp3 = (double)pres_adc * (double)pres_adc * (nls + (tknls * comp_temperature));
-    tmp4 = (double)pres_adc * (double)pres_adc * (double)pres_adc * nls3;
-
-    calc_pres = tmp1 + tmp2 + tmp3 + tmp4;
-
-    return (float)calc_pres;
-}
-
-/* This internal API is used to calculate the humidity in integer */
-static float calc_humidity(uint16_t hum_adc, float comp_temperature, const struct bme69x_dev *dev)
-{
-    double oh, tk10h, sh;
-    double tk1sh, tk2sh, hlin2;
-    double hoff, hsens;
-    double temp_comp, calc_hum, hum_float_val;
-    int32_t hum_int_val;
-
-    temp_comp = (comp_temperature * 5120) - 76800;
-
-    oh = (double)dev->calib.par_h1 * (double)(1ULL << 6);
-    sh = (double)dev->calib.par_h5 / (double)(1ULL << 16);
-    tk10h = (double)dev->calib.par_h2 / (double)(1ULL << 14);
-    tk1sh = (double)dev->calib.par_h4 / (double)(1ULL << 26);
-    tk2sh = (double)dev->calib.par_h3 / (double)(1ULL << 26);
-    hlin2 = (double)dev->calib.par_h6 / (double)(1ULL << 19);
-
-    hoff = (double)hum_adc - (oh + tk10h * temp_comp);
-    hsens = hoff * sh * (1 + (tk1sh * temp_comp) + (tk1sh * tk2sh * temp_comp * temp_comp));
-    hum_float_val = hsens * (1 - hlin2 * hsens);
-
-    /* Avoid direct floating-point comparison by using integer scaling */
-    hum_int_val = (int32_t)(hum_float_val * 1000.0f);
-
-    if (hum_int_val >= 100000)
-    {
-        hum_float_val = 100.0;
-    }
-    else if (hum_int_val < 0)
-    {
-        hum_float_val = 0.0;
-    }
-
-    calc_hum = hum_float_val;
-
-    return (float)calc_hum;
-}
-
-/* This internal API is used to calculate the gas resistance value for BME69x variant in float */
-static float calc_gas_resistance(uint16_t gas_res_adc, uint8_t gas_range)
-{
-    float calc_gas_res;
-
-    uint32_t var1 = UINT32_C(262144) >> gas_range;
-    int32_t var2 = (int32_t)gas_res_adc - INT32_C(512);
-
-    var2 *= INT32_C(3);
-    var2 = INT32_C(4096) + var2;
-
-    calc_gas_res = 1000000.0f * (float)var1 / (float)var2;
-
-    return calc_gas_res;
-}
-
-/* This internal API is used to calculate the heater resistance value using float */
-static uint8_t calc_res_heat(uint16_t temp, const struct bme69x_dev *dev)
-{
-    float var1;
-    float var2;
-    float var3;
-    float var4;
-    float var5;
-    uint8_t res_heat;
-
-    if (temp > 400) /* Cap temperature */
-    {
-        temp = 400;
-    }
-
-    var1 = (((float)dev->calib.par_g1 / (16.0f)) + 49.0f);
-    var2 = ((((float)dev->calib.par_g2 / (32768.0f)) * (0.0005f)) + 0.00235f);
-    var3 = ((float)dev->calib.par_g3 / (1024.0f));
-    var4 = (var1 * (1.0f + (var2 * (float)temp)));
-    var5 = (var4 + (var3 * (float)dev->amb_temp));
-    res_heat =
-        (uint8_t)(3.4f *
-                  ((var5 * (4 / (4 + (float)dev->calib.res_heat_range)) *
-                    (1 / (1 + ((float)dev->calib.res_heat_val * 0.002f)))) -
-                   25));
-
-    return res_heat;
-}
-
-#endif
-
-/* This internal API is used to calculate the gas wait */
-static uint8_t calc_gas_wait(uint16_t dur)
-{
-    uint8_t factor = 0;
-    uint8_t durval;
-
-    if (dur >= 0xfc0)
-    {
-        durval = 0xff; /* Max duration*/
-    }
-    else
-    {
-        while (dur > 0x3F)
-        {
-            dur = dur / 4;
-            factor += 1;
-        }
-
-        durval = (uint8_t)(dur + (factor * 64));
-    }
-
-    return durval;
-}
-
-/* This internal API is used to read a single data of the sensor */
-static int8_t read_field_data(uint8_t index, struct bme69x_data *data, struct bme69x_dev *dev)
-{
-    int8_t rslt = BME69X_OK;
-    uint8_t buff[BME69X_LEN_FIELD] = { 0 };
-    uint8_t gas_range;
-    uint32_t adc_temp;
-    uint32_t adc_pres;
-    volatile uint16_t adc_hum;
-    uint16_t adc_gas_res;
-    uint8_t tries = 5;
-
-    while ((tries) && (rslt == BME69X_OK))
-    {
-        rslt = bme69x_get_regs(((uint8_t)(BME69X_REG_FIELD0 + (index * BME69X_LEN_FIELD_OFFSET))),
-                               buff,
-                               (uint16_t)BME69X_LEN_FIELD,
-                               dev);
-        if (!data)
-        {
-            rslt = BME69X_E_NULL_PTR;
-            break;
-        }
-
-        data->status = buff[0] & BME69X_NEW_DATA_MSK;
-        data->gas_index = buff[0] & BME69X_GAS_INDEX_MSK;
-        data->meas_index = buff[1];
-
-        /* read the raw data from the sensor */
-        adc_pres = (uint32_t)(((uint32_t)buff[2] << 16) | ((uint32_t)buff[3] << 8) | ((uint32_t)buff[4]));
-        adc_temp = (uint32_t)(((uint32_t)buff[5] << 16) | ((uint32_t)buff[6] << 8) | ((uint32_t)buff[7]));
-        adc_hum = (uint16_t)(((uint32_t)buff[8] << 8) | (uint32_t)buff[9]);
-        adc_gas_res = ((uint16_t)buff[15] << 2) | ((uint16_t)buff[16] >> 6);
-
-        gas_range = buff[16] & BME69X_GAS_RANGE_MSK;
-
-        data->status |= buff[16] & BME69X_GASM_VALID_MSK;
-        data->status |= buff[16] & BME69X_HEAT_STAB_MSK;
-
-        if ((data->status & BME69X_NEW_DATA_MSK) && (rslt == BME69X_OK))
-        {
-            rslt = bme69x_get_regs(BME69X_REG_RES_HEAT0 + data->gas_index, &data->res_heat, 1, dev);
-            if (rslt == BME69X_OK)
-            {
-                rslt = bme69x_get_regs(BME69X_REG_IDAC_HEAT0 + data->gas_index, &data->idac, 1, dev);
-            }
-
-            if (rslt == BME69X_OK)
-            {
-                rslt = bme69x_get_regs(BME69X_REG_GAS_WAIT0 + data->gas_index, &data->gas_wait, 1, dev);
-            }
-
-            if (rslt == BME69X_OK)
-            {
-#ifndef BME69X_USE_FPU
-                data->temperature = calc_temperature(adc_temp, dev, &data->t_lin);
-                data->pressure = calc_pressure(adc_pres, data->t_lin, dev);
-#else
-                data->temperature = calc_temperature(adc_temp, dev);
-                data->pressure = calc_pressure(adc_pres, data->temperature, dev);
-#endif
-                data->humidity = calc_humidity(adc_hum, data->temperature, dev);
-                data->gas_resistance = calc_gas_resistance(adc_gas_res, gas_range);
-
-                break;
-            }
-        }
-
-        if (rslt == BME69X_OK)
-        {
-            dev->delay_us(BME69X_PERIOD_POLL, dev->intf_ptr);
-        }
-
-        tries--;
-    }
-
-    return rslt;
-}
-
-/* This internal API is used to read all data fields of the sensor */
-static int8_t read_all_field_data(struct bme69x_data * const data[], struct bme69x_dev *dev)
-{
-    int8_t rslt = BME69X_OK;
-    uint8_t buff[BME69X_LEN_FIELD * 3] = { 0 };
-    uint8_t gas_range;
-    uint32_t adc_temp;
-    uint32_t adc_pres;
-    uint16_t adc_hum;
-    uint16_t adc_gas_res;
-    uint8_t off;
-    uint8_t set_val[30] = { 0 }; /* idac, res_heat, gas_wait */
-    uint8_t i;
-
-    if (!data[0] && !data[1] && !data[2])
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-
-    if (rslt == BME69X_OK)
-    {
-        rslt = bme69x_get_regs(BME69X_REG_FIELD0, buff, (uint32_t) BME69X_LEN_FIELD * 3, dev);
-    }
-
-    if (rslt == BME69X_OK)
-    {
-        rslt = bme69x_get_regs(BME69X_REG_IDAC_HEAT0, set_val, 30, dev);
-    }
-
-    for (i = 0; ((i < 3) && (rslt == BME69X_OK)); i++)
-    {
-        off = (uint8_t)(i * BME69X_LEN_FIELD);
-        data[i]->status = buff[off] & BME69X_NEW_DATA_MSK;
-        data[i]->gas_index = buff[off] & BME69X_GAS_INDEX_MSK;
-        data[i]->meas_index = buff[off + 1];
-
-        /* read the raw data from the sensor */
-        adc_pres =
-            (uint32_t)(((uint32_t) buff[off + 2] << 16) | ((uint32_t) buff[off + 3] << 8) | ((uint32_t) buff[off + 4]));
-        adc_temp =
-            (uint32_t)(((uint32_t) buff[off + 5] << 16) | ((uint32_t) buff[off + 6] << 8) | ((uint32_t) buff[off + 7]));
-        adc_hum = (uint16_t) (((uint32_t) buff[off + 8] * 256) | (uint32_t) buff[off + 9]);
-        adc_gas_res = ((uint16_t)buff[off + 15] << 2) | ((uint16_t)buff[off + 16] >> 6);
-        gas_range = buff[off + 16] & BME69X_GAS_RANGE_MSK;
-
-        data[i]->status |= buff[off + 16] & BME69X_GASM_VALID_MSK;
-        data[i]->status |= buff[off + 16] & BME69X_HEAT_STAB_MSK;
-
-        data[i]->idac = set_val[data[i]->gas_index];
-        data[i]->res_heat = set_val[10 + data[i]->gas_index];
-        data[i]->gas_wait = set_val[20 + data[i]->gas_index];
-
-#ifndef BME69X_USE_FPU
-
-        /*
-         * Fixed point calculation needs t_lin for pressure calculation
-         * t_lin is calculated during temperature calculation
-         */
-        data[i]->temperature = calc_temperature(adc_temp, dev, &data[i]->t_lin);
-        data[i]->pressure = calc_pressure(adc_pres, data[i]->t_lin, dev);
-#else
-        data[i]->temperature = calc_temperature(adc_temp, dev);
-        data[i]->pressure = calc_pressure(adc_pres, data[i]->temperature, dev);
-#endif
-        data[i]->humidity = calc_humidity(adc_hum, data[i]->temperature, dev);
-        data[i]->gas_resistance = calc_gas_resistance(adc_gas_res, gas_range);
-    }
-
-    return rslt;
-}
-
-/* This internal API is used to switch between SPI memory pages */
-static int8_t set_mem_page(uint8_t reg_addr, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t reg;
-    uint8_t mem_page;
-
-    /* Check for null pointers in the device structure*/
-    rslt = null_ptr_check(dev);
-    if (rslt == BME69X_OK)
-    {
-        if (reg_addr > 0x7f)
-        {
-            mem_page = BME69X_MEM_PAGE1;
-        }
-        else
-        {
-            mem_page = BME69X_MEM_PAGE0;
-        }
-
-        if (mem_page != dev->mem_page)
-        {
-            dev->mem_page = mem_page;
-            dev->intf_rslt = dev->read(BME69X_REG_MEM_PAGE | BME69X_SPI_RD_MSK, &reg, 1, dev->intf_ptr);
-            if (dev->intf_rslt != 0)
-            {
-                rslt = BME69X_E_COM_FAIL;
-            }
-
-            if (rslt == BME69X_OK)
-            {
-                reg = reg & (~BME69X_MEM_PAGE_MSK);
-                reg = reg | (dev->mem_page & BME69X_MEM_PAGE_MSK);
-                dev->intf_rslt = dev->write(BME69X_REG_MEM_PAGE & BME69X_SPI_WR_MSK, &reg, 1, dev->intf_ptr);
-                if (dev->intf_rslt != 0)
-                {
-                    rslt = BME69X_E_COM_FAIL;
-                }
-            }
-        }
-    }
-
-    return rslt;
-}
-
-/* This internal API is used to get the current SPI memory page */
-static int8_t get_mem_page(struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t reg;
-
-    /* Check for null pointer in the device structure*/
-    rslt = null_ptr_check(dev);
-    if (rslt == BME69X_OK)
-    {
-        dev->intf_rslt = dev->read(BME69X_REG_MEM_PAGE | BME69X_SPI_RD_MSK, &reg, 1, dev->intf_ptr);
-        if (dev->intf_rslt != 0)
-        {
-            rslt = BME69X_E_COM_FAIL;
-        }
-        else
-        {
-            dev->mem_page = reg & BME69X_MEM_PAGE_MSK;
-        }
-    }
-
-    return rslt;
-}
-
-/* This internal API is used to limit the max value of a parameter */
-static int8_t boundary_check(uint8_t *value, uint8_t max, struct bme69x_dev *dev)
-{
-    int8_t rslt;
-
-    rslt = null_ptr_check(dev);
-    if ((value != NULL) && (rslt == BME69X_OK))
-    {
-        /* Check if value is above maximum value */
-        if (*value > max)
-        {
-            /* Auto correct the invalid value to maximum value */
-            *value = max;
-            dev->info_msg |= BME69X_I_PARAM_CORR;
-        }
-    }
-    else
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-/* This internal API is used to check the bme69x_dev for null pointers */
-static int8_t null_ptr_check(const struct bme69x_dev *dev)
-{
-    int8_t rslt = BME69X_OK;
-
-    if ((dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL))
-    {
-        /* Device structure pointer is not valid */
-        rslt = BME69X_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-/* This internal API is used to set heater configurations */
-static int8_t set_conf(const struct bme69x_heatr_conf *conf, uint8_t op_mode, uint8_t *nb_conv, struct bme69x_dev *dev)
-{
-    int8_t rslt = BME69X_OK;
-    uint8_t i;
-    uint8_t shared_dur;
-    uint8_t write_len = 0;
-    uint8_t heater_dur_shared_addr = BME69X_REG_SHD_HEATR_DUR;
-    uint8_t rh_reg_addr[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-    uint8_t rh_reg_data[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-    uint8_t gw_reg_addr[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-    uint8_t gw_reg_data[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-
-    switch (op_mode)
-    {
-        case BME69X_FORCED_MODE:
-            rh_reg_addr[0] = BME69X_REG_RES_HEAT0;
-            rh_reg_data[0] = calc_res_heat(conf->heatr_temp, dev);
-            gw_reg_addr[0] = BME69X_REG_GAS_WAIT0;
-            gw_reg_data[0] = calc_gas_wait(conf->heatr_dur);
-            (*nb_conv) = 0;
-            write_len = 1;
-            break;
-        case BME69X_SEQUENTIAL_MODE:
-            if ((!conf->heatr_dur_prof) || (!conf->heatr_temp_prof))
-            {
-                rslt = BME69X_E_NULL_PTR;
-                break;
-            }
-
-            for (i = 0; i < conf->profile_len; i++)
-            {
-                rh_reg_addr[i] = BME69X_REG_RES_HEAT0 + i;
-                rh_reg_data[i] = calc_res_heat(conf->heatr_temp_prof[i], dev);
-                gw_reg_addr[i] = BME69X_REG_GAS_WAIT0 + i;
-                gw_reg_data[i] = calc_gas_wait(conf->heatr_dur_prof[i]);
-            }
-
-            (*nb_conv) = conf->profile_len;
-            write_len = conf->profile_len;
-            break;
-        case BME69X_PARALLEL_MODE:
-            if ((!conf->heatr_dur_prof) || (!conf->heatr_temp_prof))
-            {
-                rslt = BME69X_E_NULL_PTR;
-                break;
-            }
-
-            if (conf->shared_heatr_dur == 0)
-            {
-                rslt = BME69X_W_DEFINE_SHD_HEATR_DUR;
-            }
-
-            for (i = 0; i < conf->profile_len; i++)
-            {
-                rh_reg_addr[i] = BME69X_REG_RES_HEAT0 + i;
-                rh_reg_data[i] = calc_res_heat(conf->heatr_temp_prof[i], dev);
-                gw_reg_addr[i] = BME69X_REG_GAS_WAIT0 + i;
-                gw_reg_data[i] = (uint8_t) conf->heatr_dur_prof[i];
-            }
-
-            (*nb_conv) = conf->profile_len;
-            write_len = conf->profile_len;
-            shared_dur = calc_heatr_dur_shared(conf->shared_heatr_dur);
-            if (rslt == BME69X_OK)
-            {
-                rslt = bme69x_set_regs(&heater_dur_shared_addr, &shared_dur, 1, dev);
-            }
-
-            break;
-        default:
-            rslt = BME69X_W_DEFINE_OP_MODE;
-    }
-
-    if (rslt == BME69X_OK)
-    {
-        rslt = bme69x_set_regs(rh_reg_addr, rh_reg_data, write_len, dev);
-    }
-
-    if (rslt == BME69X_OK)
-    {
-        rslt = bme69x_set_regs(gw_reg_addr, gw_reg_data, write_len, dev);
-    }
-
-    return rslt;
-}
-
-/* This internal API is used to calculate the register value for
- * shared heater duration */
-static uint8_t calc_heatr_dur_shared(uint16_t dur)
-{
-    uint8_t factor = 0;
-    uint8_t heatdurval;
-
-    if (dur >= 0x783)
-    {
-        heatdurval = 0xff; /* Max duration */
-    }
-    else
-    {
-        /* Step size of 0.477ms */
-        dur = (uint16_t)(((uint32_t)dur * 1000) / 477);
-        while (dur > 0x3F)
-        {
-            dur = dur >> 2;
-            factor += 1;
-        }
-
-        heatdurval = (uint8_t)(dur + (factor * 64));
-    }
-
-    return heatdurval;
-}
-
-/* This internal API is used sort the sensor data */
-static void sort_sensor_data(uint8_t low_index, uint8_t high_index, struct bme69x_data *field[])
-{
-    int16_t meas_index1;
-    int16_t meas_index2;
-
-    meas_index1 = (int16_t)field[low_index]->meas_index;
-    meas_index2 = (int16_t)field[high_index]->meas_index;
-    if ((field[low_index]->status & BME69X_NEW_DATA_MSK) && (field[high_index]->status & BME69X_NEW_DATA_MSK))
-    {
-        int16_t diff = meas_index2 - meas_index1;
-        if (((diff > -3) && (diff < 0)) || (diff > 2))
-        {
-            swap_fields(low_index, high_index, field);
-        }
-    }
-    else if (field[high_index]->status & BME69X_NEW_DATA_MSK)
-    {
-        swap_fields(low_index, high_index, field);
-    }
-
-    /* Sorting field data
-     *
-     * The 3 fields are filled in a fixed order with data in an incrementing
-     * 8-bit sub-measurement index which looks like
-     * Field index | Sub-meas index
-     *      0      |        0
-     *      1      |        1
-     *      2      |        2
-     *      0      |        3
-     *      1      |        4
-     *      2      |        5
-     *      ...
-     *      0      |        252
-     *      1      |        253
-     *      2      |        254
-     *      0      |        255
-     *      1      |        0
-     *      2      |        1
-     *
-     * The fields are sorted in a way so as to always deal with only a snapshot
-     * of comparing 2 fields at a time. The order being
-     * field0 & field1
-     * field0 & field2
-     * field1 & field2
-     * Here the oldest data should be in field0 while the newest is in field2.
-     * In the following documentation, field0's position would referred to as
-     * the lowest and field2 as the highest.
-     *
-     * In order to sort we have to consider the following cases,
-     *
-     * Case A: No fields have new data
-     *     Then do not sort, as this data has already been read.
-     *
-     * Case B: Higher field has new data
-     *     Then the new field get's the lowest position.
-     *
-     * Case C: Both fields have new data
-     *     We have to put the oldest sample in the lowest position. Since the
-     *     sub-meas index contains in essence the age of the sample, we calculate
-     *     the difference between the higher field and the lower field.
-     *     Here we have 3 sub-cases,
-     *     Case 1: Regular read without overwrite
-     *         Field index | Sub-meas index
-     *              0      |        3
-     *              1      |        4
-     *
-     *         Field index | Sub-meas index
-     *              0      |        3
-     *              2      |        5
-     *
-     *         The difference is always <= 2. There is no need to swap as the
-     *         oldest sample is already in the lowest position.
-     *
-     *     Case 2: Regular read with an overflow and without an overwrite
-     *         Field index | Sub-meas index
-     *              0      |        255
-     *              1      |        0
-     *
-     *         Field index | Sub-meas index
-     *              0      |        254
-     *              2      |        0
-     *
-     *         The difference is always <= -3. There is no need to swap as the
-     *         oldest sample is already in the lowest position.
-     *
-     *     Case 3: Regular read with overwrite
-     *         Field index | Sub-meas index
-     *              0      |        6
-     *              1      |        4
-     *
-     *         Field index | Sub-meas index
-     *              0      |        6
-     *              2      |        5
-     *
-     *         The difference is always > -3. There is a need to swap as the
-     *         oldest sample is not in the lowest position.
-     *
-     *     Case 4: Regular read with overwrite and overflow
-     *         Field index | Sub-meas index
-     *              0      |        0
-     *              1      |        254
-     *
-     *         Field index | Sub-meas index
-     *              0      |        0
-     *              2      |        255
-     *
-     *         The difference is always > 2. There is a need to swap as the
-     *         oldest sample is not in the lowest position.
-     *
-     * To summarize, we have to swap when
-     *     - The higher field has new data and the lower field does not.
-     *     - If both fields have new data, then the difference of sub-meas index
-     *         between the higher field and the lower field creates the
-     *         following condition for swapping.
-     *         - (diff > -3) && (diff < 0), combination of cases 1, 2, and 3.
-     *         - diff > 2, case 4.
-     *
-     *     Here the limits of -3 and 2 derive from the fact that there are 3 fields.
-     *     These values decrease or increase respectively if the number of fields increases.
-     */
-}
-
-/* This internal API is used sort the sensor data */
-static void swap_fields(uint8_t index1, uint8_t index2, struct bme69x_data *field[])
-{
-    struct bme69x_data *temp;
-
-    temp = field[index1];
-    field[index1] = field[index2];
-    field[index2] = temp;
-}
-
-/* This Function is to analyze the sensor data */
-static int8_t analyze_sensor_data(const struct bme69x_data *data, uint8_t n_meas)
-{
-    int8_t rslt = BME69X_OK;
-    uint8_t self_test_failed = 0, i;
-    uint32_t cent_res = 0;
-
-    if ((data[0].temperature < BME69X_MIN_TEMPERATURE) || (data[0].temperature > BME69X_MAX_TEMPERATURE))
-    {
-        self_test_failed++;
-    }
-
-    if ((data[0].pressure < BME69X_MIN_PRESSURE) || (data[0].pressure > BME69X_MAX_PRESSURE))
-    {
-        self_test_failed++;
-    }
-
-    if ((data[0].humidity < BME69X_MIN_HUMIDITY) || (data[0].humidity > BME69X_MAX_HUMIDITY))
-    {
-        self_test_failed++;
-    }
-
-    for (i = 0; i < n_meas; i++) /* Every gas measurement should be valid */
-    {
-        if (!(data[i].status & BME69X_GASM_VALID_MSK))
-        {
-            self_test_failed++;
-        }
-    }
-
-    if (n_meas >= 6)
-    {
-        cent_res = (uint32_t)((5 * (data[3].gas_resistance + data[5].gas_resistance)) / (2 * data[4].gas_resistance));
-    }
-
-    if (cent_res < 6)
-    {
-        self_test_failed++;
-    }
-
-    if (self_test_failed)
-    {
-        rslt = BME69X_E_SELF_TEST;
-    }
-
-    return rslt;
-}
-
-/* This internal API is used to read the calibration coefficients */
-static int8_t get_calib_data(struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t coeff_array[BME69X_LEN_COEFF_ALL];
-
-    rslt = bme69x_get_regs(BME69X_REG_COEFF1, coeff_array, BME69X_LEN_COEFF1, dev);
-    if (rslt == BME69X_OK)
-    {
-        rslt = bme69x_get_regs(BME69X_REG_COEFF2, &coeff_array[BME69X_LEN_COEFF1], BME69X_LEN_COEFF2, dev);
-    }
-
-    if (rslt == BME69X_OK)
-    {
-        rslt = bme69x_get_regs(BME69X_REG_COEFF3,
-                               &coeff_array[BME69X_LEN_COEFF1 + BME69X_LEN_COEFF2],
-                               BME69X_LEN_COEFF3,
-                               dev);
-    }
-
-    if (rslt == BME69X_OK)
-    {
-        /* Temperature related coefficients */
-        dev->calib.par_t1 =
-            (uint16_t)(BME69X_CONCAT_BYTES(coeff_array[BME69X_IDX_DO_C_MSB], coeff_array[BME69X_IDX_DO_C_LSB]));
-        dev->calib.par_t2 =
-            (uint16_t)(BME69X_CONCAT_BYTES(coeff_array[BME69X_IDX_DTK1_C_MSB], coeff_array[BME69X_IDX_DTK1_C_LSB]));
-        dev->calib.par_t3 = (int8_t)(coeff_array[BME69X_IDX_DTK2_C]);
-
-        /* Pressure related coefficients */
-        dev->calib.par_p5 =
-            (int16_t)(BME69X_CONCAT_BYTES(coeff_array[BME69X_IDX_S_C_MSB], coeff_array[BME69X_IDX_S_C_LSB]));
-        dev->calib.par_p6 =
-            (int16_t)(BME69X_CONCAT_BYTES(coeff_array[BME69X_IDX_TK1S_C_MSB], coeff_array[BME69X_IDX_TK1S_C_LSB]));
-        dev->calib.par_p7 = (int8_t)coeff_array[BME69X_IDX_TK2S_C];
-        dev->calib.par_p8 = (int8_t)coeff_array[BME69X_IDX_TK3S_C];
-
-        dev->calib.par_p1 =
-            (int16_t)(BME69X_CONCAT_BYTES(coeff_array[BME69X_IDX_O_C_MSB], coeff_array[BME69X_IDX_O_C_LSB]));
-        dev->calib.par_p2 =
-            (uint16_t)(BME69X_CONCAT_BYTES(coeff_array[BME69X_IDX_TK10_C_MSB], coeff_array[BME69X_IDX_TK10_C_LSB]));
-        dev->calib.par_p3 = (int8_t)(coeff_array[BME69X_IDX_TK20_C]);
-        dev->calib.par_p4 = (int8_t)(coeff_array[BME69X_IDX_TK30_C]);
-
-        dev->calib.par_p9 =
-            (int16_t)(BME69X_CONCAT_BYTES(coeff_array[BME69X_IDX_NLS_C_MSB], coeff_array[BME69X_IDX_NLS_C_LSB]));
-        dev->calib.par_p10 = (int8_t)(coeff_array[BME69X_IDX_TKNLS_C]);
-        dev->calib.par_p11 = (int8_t)(coeff_array[BME69X_IDX_NLS3_C]);
-
-        /* Humidity related coefficients */
-        dev->calib.par_h5 =
-            (int16_t)(((int16_t)coeff_array[BME69X_IDX_S_H_MSB] << 4) | (coeff_array[BME69X_IDX_S_H_LSB] >> 4));
-
-        if (dev->calib.par_h5 > 2047)
-        {
-            /* Convert to negative value */
-            dev->calib.par_h5 = (int16_t)(dev->calib.par_h5 - 4096);
-        }
-
-        dev->calib.par_h1 =
-            (int16_t)(((int16_t)coeff_array[BME69X_IDX_O_H_MSB] << 4) | (coeff_array[BME69X_IDX_O_H_LSB] & 0x0F));
-
-        /* Check if the value is above 2047 */
-        if (dev->calib.par_h1 > 2047)
-        {
-            /* Convert to negative value */
-            dev->calib.par_h1 = (int16_t)(dev->calib.par_h1 - 4096);
-        }
-
-        dev->calib.par_h2 = (int8_t)coeff_array[BME69X_IDX_TK10H_C];
-        dev->calib.par_h4 = (int8_t)coeff_array[BME69X_IDX_par_h4];
-        dev->calib.par_h3 = (uint8_t)coeff_array[BME69X_IDX_par_h3];
-        dev->calib.par_h6 = (uint8_t)coeff_array[BME69X_IDX_HLIN2_C];
-
-        /* Gas heater related coefficients */
-        dev->calib.par_g1 = (int8_t)coeff_array[BME69X_IDX_RO_C];
-        dev->calib.par_g2 =
-            (int16_t)(BME69X_CONCAT_BYTES(coeff_array[BME69X_IDX_TKR_C_MSB], coeff_array[BME69X_IDX_TKR_C_LSB]));
-        dev->calib.par_g3 = (int8_t)coeff_array[BME69X_IDX_T_AMB_COMP];
-
-        /* Other coefficients */
-        dev->calib.res_heat_range = ((coeff_array[BME69X_IDX_RES_HEAT_RANGE] & BME69X_RHRANGE_MSK) >> 4);
-        dev->calib.res_heat_val = (int8_t)coeff_array[BME69X_IDX_RES_HEAT_VAL];
-        dev->calib.range_sw_err = ((int8_t)(coeff_array[BME69X_IDX_RANGE_SW_ERR] & BME69X_RSERROR_MSK)) / 16;
-    }
-
-    return rslt;
-}
-
-/* This internal API is used to read variant ID information from the register */
-static int8_t read_variant_id(struct bme69x_dev *dev)
-{
-    int8_t rslt;
-    uint8_t reg_data = 0;
-
-    /* Read variant ID information register */
-    rslt = bme69x_get_regs(BME69X_REG_VARIANT_ID, &reg_data, 1, dev);
-
-    if (rslt == BME69X_OK)
-    {
-        dev->variant_id = reg_data;
-    }
-
-    return rslt;
-}
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bme69x.c
+* @date       2025-07-15
+* @version    v1.0.3
+*
+*/
+
+#include "bme69x.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Ordering of the ring indices, plain volatile accesses on single core targets without GNU atomics */
+#if defined(__GNUC__)
+#define BME69X_LOAD_ACQUIRE(ptr)        __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define BME69X_STORE_RELEASE(ptr, val)  __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#else
+#define BME69X_LOAD_ACQUIRE(ptr)        (*(ptr))
+#define BME69X_STORE_RELEASE(ptr, val)  (*(ptr) = (val))
+#endif
+
+/* Interface of a device, a constant in single interface builds */
+#if defined(BME69X_ONLY_I2C)
+#define BME69X_IS_SPI(dev)                 ((void)(dev), 0)
+#elif defined(BME69X_ONLY_SPI)
+#define BME69X_IS_SPI(dev)                 ((void)(dev), 1)
+#else
+#define BME69X_IS_SPI(dev)                 ((dev)->intf == BME69X_SPI_INTF)
+#endif
+
+/* Parallel and sequential mode, never selected in forced mode only builds */
+#ifdef BME69X_ONLY_FORCED
+#define BME69X_IS_MULTI_FIELD(mode)        0
+#else
+#define BME69X_IS_MULTI_FIELD(mode)        (((mode) == BME69X_PARALLEL_MODE) || ((mode) == BME69X_SEQUENTIAL_MODE))
+#endif
+
+/* Operation modes of the build */
+#define BME69X_IS_MODE(mode)               (((mode) == BME69X_SLEEP_MODE) || ((mode) == BME69X_FORCED_MODE) || \
+                                            BME69X_IS_MULTI_FIELD(mode))
+
+/* Transport of a device, the bme69x_dev function pointers unless a fixed one is named by BME69X_INTF_HEADER */
+#ifdef BME69X_INTF_HEADER
+#include BME69X_INTF_HEADER
+#endif
+
+#ifndef BME69X_INTF_READ
+#define BME69X_INTF_READ(dev, reg_addr, reg_data, len)   (dev)->read((reg_addr), (reg_data), (len), (dev)->intf_ptr)
+#endif
+
+#ifndef BME69X_INTF_WRITE
+#define BME69X_INTF_WRITE(dev, reg_addr, reg_data, len)  (dev)->write((reg_addr), (reg_data), (len), (dev)->intf_ptr)
+#endif
+
+#ifndef BME69X_INTF_DELAY_US
+#define BME69X_INTF_DELAY_US(dev, period)                (dev)->delay_us((period), (dev)->intf_ptr)
+#endif
+
+#ifndef BME69X_INTF_TIME_NS
+#define BME69X_INTF_TIME_NS(dev)                         ((((dev)->features & BME69X_FEAT_TIMESTAMP) && \
+                                                           ((dev)->get_time_ns != NULL)) ? \
+                                                          (dev)->get_time_ns((dev)->intf_ptr) : 0)
+#endif
+
+/* Hot path counters, compiled out unless BME69X_ENABLE_STATS is defined */
+#ifdef BME69X_ENABLE_STATS
+#define BME69X_STATS_ADD(dev, counter, n)  ((dev)->stats.counter += (n))
+#else
+#define BME69X_STATS_ADD(dev, counter, n)  ((void)0)
+#endif
+
+/* Heater resistance of a temperature, taken from the table of the device when BME69X_USE_HEATR_LUT is defined */
+#ifdef BME69X_USE_HEATR_LUT
+#define BME69X_RES_HEAT(temp, amb_term, dev) \
+    ((void)(amb_term), \
+     (dev)->heatr_lut.res_heat[((temp) < BME69X_LEN_HEATR_LUT) ? (temp) : (BME69X_LEN_HEATR_LUT - 1)])
+#define BME69X_HEATR_LUT_UPDATE(dev)          update_heatr_lut(dev)
+#else
+#define BME69X_RES_HEAT(temp, amb_term, dev)  calc_res_heat((temp), (amb_term), (dev))
+#define BME69X_HEATR_LUT_UPDATE(dev)          ((void)0)
+#endif
+
+/* Folds one member of a warm start blob into its checksum, the padding bytes around it are left out */
+#define BME69X_WARM_HASH(hash, member)  ((hash) = fnv1a((hash), (const uint8_t *)&(member), sizeof(member)))
+
+/* Steps of an asynchronous operation */
+#define BME69X_ASYNC_DONE        UINT8_C(0)
+#define BME69X_ASYNC_FIELD_READ  UINT8_C(1)
+#define BME69X_ASYNC_FIELD_DONE  UINT8_C(2)
+#define BME69X_ASYNC_HEATR_READ  UINT8_C(3)
+#define BME69X_ASYNC_HEATR_DONE  UINT8_C(4)
+#define BME69X_ASYNC_SLEEP_READ  UINT8_C(5)
+#define BME69X_ASYNC_SLEEP_DONE  UINT8_C(6)
+#define BME69X_ASYNC_SLEEP_WAIT  UINT8_C(7)
+#define BME69X_ASYNC_CONF        UINT8_C(8)
+#define BME69X_ASYNC_CONF_WRITE  UINT8_C(9)
+#define BME69X_ASYNC_GAS_READ    UINT8_C(10)
+#define BME69X_ASYNC_GAS_DONE    UINT8_C(11)
+
+/* Steps of the SPI memory page switch preceding a transfer */
+#define BME69X_ASYNC_PAGE_READ   UINT8_C(1)
+#define BME69X_ASYNC_PAGE_WRITE  UINT8_C(2)
+
+/* Vectorized float kernels: SSE2 with AVX2 run-time dispatch on x86-64, NEON on AArch64 */
+#if defined(BME69X_USE_SIMD) && defined(BME69X_USE_FPU) && defined(__GNUC__)
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define BME69X_SIMD_X86
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define BME69X_SIMD_NEON
+#endif
+#endif
+
+
+/* This internal API is used to read the calibration coefficients */
+static int8_t get_calib_data(struct bme69x_dev *dev);
+
+/* This internal API is used to read variant ID information register status */
+static int8_t read_variant_id(struct bme69x_dev *dev);
+
+#ifndef BME69X_ONLY_FORCED
+
+/* This internal API is used to compute the heater registers of the next slot reload of a sequential pipeline */
+static void seq_stage(struct bme69x_seq *seq);
+
+/* This internal API is used to move a sequential pipeline to its next step, reloading the slot left */
+static int8_t seq_advance(struct bme69x_seq *seq);
+#endif
+
+/* This internal API is used to clear the features and the statistics of a device being initialized */
+static void clear_dev_state(struct bme69x_dev *dev);
+
+/* This internal API is used to check the chip ID and read the variant ID and the calibration data */
+static int8_t read_identity(struct bme69x_dev *dev);
+
+/* This internal API is used to fold bytes into an FNV-1a hash */
+static uint32_t fnv1a(uint32_t hash, const uint8_t *byte, size_t len);
+
+/* This internal API is used to compute the checksum of a warm start blob */
+static uint32_t warm_checksum(const struct bme69x_warm_blob *blob);
+
+/* This internal API is used to fill a warm start blob from an initialized device */
+static void warm_fill(struct bme69x_warm_blob *blob, const uint8_t *unique_id, const struct bme69x_dev *dev);
+
+/* This internal API is used to calculate the gas wait */
+static uint8_t calc_gas_wait(uint16_t dur);
+
+#ifndef BME69X_USE_FPU
+
+/* This internal API is used to calculate the temperature in integer */
+static int16_t calc_temperature(uint32_t temp_adc, const struct bme69x_calib_data *calib, uint32_t *t_lin);
+
+/* This internal API is used to calculate the pressure in integer */
+static uint32_t calc_pressure(uint32_t pres_adc, uint32_t t_lin, const struct bme69x_calib_data *calib);
+
+/* This internal API is used to calculate the humidity in integer */
+static uint32_t calc_humidity(uint16_t hum_adc, int16_t comp_temperature, const struct bme69x_calib_data *calib);
+
+/* This internal API is used to calculate the gas resistance for BME69x variant */
+static uint32_t calc_gas_resistance(uint16_t gas_res_adc, uint8_t gas_range);
+
+/* This internal API is used to calculate the heater resistance using integer */
+static uint8_t calc_res_heat(uint16_t temp, int32_t amb_term, const struct bme69x_dev *dev);
+
+/* This internal API is used to calculate the ambient temperature term of the heater resistance in integer */
+static int32_t calc_res_heat_amb(const struct bme69x_dev *dev);
+
+#else
+
+/* This internal API is used to calculate the temperature value in float */
+static float calc_temperature(uint32_t temp_adc, const struct bme69x_calib_data *calib);
+
+/* This internal API is used to calculate the pressure value in float */
+static float calc_pressure(uint32_t pres_adc, float comp_temperature, const struct bme69x_calib_data *calib);
+
+/* This internal API is used to calculate the humidity value in float */
+static float calc_humidity(uint16_t hum_adc, float comp_temperature, const struct bme69x_calib_data *calib);
+
+/* This internal API is used to calculate the gas for BME69x variant in float */
+static float calc_gas_resistance(uint16_t gas_res_adc, uint8_t gas_range);
+
+/* This internal API is used to calculate the heater resistance value using float */
+static uint8_t calc_res_heat(uint16_t temp, float amb_term, const struct bme69x_dev *dev);
+
+/* This internal API is used to calculate the ambient temperature term of the heater resistance in float */
+static float calc_res_heat_amb(const struct bme69x_dev *dev);
+
+#endif
+
+#ifdef BME69X_USE_HEATR_LUT
+
+/* This internal API is used to rebuild the heater resistance table when the ambient temperature changed */
+static void update_heatr_lut(struct bme69x_dev *dev);
+#endif
+
+/* This internal API is used to compensate the raw data of one field */
+static void compensate_data(const struct bme69x_calib_data *calib,
+                            uint32_t temp_adc,
+                            uint32_t pres_adc,
+                            uint16_t hum_adc,
+                            uint16_t gas_res_adc,
+                            uint8_t gas_range,
+                            struct bme69x_data *data);
+
+#ifdef BME69X_SIMD_X86
+
+/* This internal API is used to compensate temperature and pressure two samples at a time using SSE2 */
+static uint32_t simd_comp_sse2(const struct bme69x_calib_derived *c,
+                               const struct bme69x_raw_batch *raw,
+                               struct bme69x_data *data,
+                               uint32_t n);
+
+/* This internal API is used to compensate temperature and pressure four samples at a time using AVX2 */
+static uint32_t simd_comp_avx2(const struct bme69x_calib_derived *c,
+                               const struct bme69x_raw_batch *raw,
+                               struct bme69x_data *data,
+                               uint32_t n);
+
+#endif
+
+#ifdef BME69X_SIMD_NEON
+
+/* This internal API is used to compensate temperature and pressure two samples at a time using NEON */
+static uint32_t simd_comp_neon(const struct bme69x_calib_derived *c,
+                               const struct bme69x_raw_batch *raw,
+                               struct bme69x_data *data,
+                               uint32_t n);
+
+#endif
+
+/* This internal API is used to read a single data of the sensor */
+static int8_t read_field_data(uint8_t index, struct bme69x_data *data, struct bme69x_dev *dev);
+
+/* This internal API is used to read all data fields of the sensor */
+static int8_t read_all_field_data(struct bme69x_data *data, uint8_t *n_new, struct bme69x_dev *dev);
+
+/* This internal API is used to switch between SPI memory pages */
+static int8_t set_mem_page(uint8_t reg_addr, struct bme69x_dev *dev);
+
+/* This internal API is used to get the current SPI memory page */
+static int8_t get_mem_page(struct bme69x_dev *dev);
+
+/* This internal API is used to check the bme69x_dev for null pointers */
+static int8_t null_ptr_check(const struct bme69x_dev *dev);
+
+/* This internal API is used to get the index of a register in the shadow register cache */
+static int8_t shadow_index(uint8_t reg_addr);
+
+/* This internal API is used to update the shadow register cache with the register values read or written */
+static void shadow_update(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev);
+
+/* This internal API is used to copy registers from the shadow register cache, when enabled and valid */
+static uint8_t shadow_hit(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, const struct bme69x_dev *dev);
+
+/* This internal API is used to read registers, from the shadow register cache when enabled and valid */
+static int8_t get_regs_cached(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev);
+
+/* This internal API is used to set heater configurations */
+static int8_t set_conf(const struct bme69x_heatr_conf *conf, uint8_t op_mode, uint8_t *nb_conv, struct bme69x_dev *dev);
+
+/* This internal API is used to calculate the heater registers of a configuration */
+static int8_t calc_heatr_regs(const struct bme69x_heatr_conf *conf,
+                              uint8_t op_mode,
+                              uint8_t *nb_conv,
+                              uint8_t *reg_addr,
+                              uint8_t *reg_data,
+                              uint8_t *n_regs,
+                              struct bme69x_dev *dev);
+
+/* This internal API is used to get the number of register pairs written by one burst */
+static uint8_t write_chunk_len(const uint8_t *reg_addr, uint8_t len);
+
+/* This internal API is used to set the control gas registers of a heater configuration */
+static void calc_ctrl_gas(const struct bme69x_heatr_conf *conf, uint8_t nb_conv, uint8_t *ctrl_gas_data);
+
+/* This internal API is used to set the oversampling, filter and odr bits of the registers
+ * BME69X_REG_CTRL_GAS_1 up to BME69X_REG_CONFIG */
+static int8_t calc_conf(struct bme69x_conf *conf, uint8_t *data_array, struct bme69x_dev *dev);
+
+/* This internal API is used to limit the max value of a parameter */
+static int8_t boundary_check(uint8_t *value, uint8_t max, struct bme69x_dev *dev);
+
+#ifndef BME69X_ONLY_FORCED
+
+/* This internal API is used to calculate the register value for
+ * shared heater duration */
+static uint8_t calc_heatr_dur_shared(uint16_t dur);
+#endif
+
+/* This internal API is used to read consecutive fields, wrapping from the last field to the first one */
+static int8_t read_fields(uint8_t first, uint8_t count, struct bme69x_raw_field *raw, struct bme69x_dev *dev);
+
+/* This internal API is used to fill the heater values of the fields from their gas index */
+static int8_t set_field_heatr(struct bme69x_raw_field *raw, uint8_t count, struct bme69x_dev *dev);
+
+/* This internal API is used to order the fields, the oldest new data first */
+static uint8_t order_fields(const struct bme69x_raw_field *raw, uint8_t count, uint8_t *order);
+
+/* This internal API is used to fill the heater values of the fields from the heater registers */
+static void fill_field_heatr(struct bme69x_raw_field *raw, uint8_t count, const uint8_t *set_val);
+
+/* This internal API is used to submit the bus transfer of an asynchronous operation */
+static int8_t async_issue(struct bme69x_async *op);
+
+/* This internal API is used to submit the requested transfer of an asynchronous operation, in bus addressing */
+static int8_t async_issue_req(struct bme69x_async *op);
+
+/* This internal API is used to submit the write of the SPI memory page of the requested register */
+static int8_t async_page_write(struct bme69x_async *op);
+
+/* This internal API is used to submit the requested transfer, switching the SPI memory page first when needed */
+static int8_t async_request(struct bme69x_async *op, uint8_t next_step);
+
+/* This internal API is used to submit a register read of an asynchronous operation */
+static int8_t async_read(struct bme69x_async *op, uint8_t reg_addr, uint8_t *reg_data, uint32_t len, uint8_t next_step);
+
+/* This internal API is used to submit the next burst of the register pairs of an asynchronous operation */
+static int8_t async_write(struct bme69x_async *op, uint8_t next_step);
+
+/* This internal API is used to submit a wait of an asynchronous operation */
+static int8_t async_wait(struct bme69x_async *op, uint32_t period, uint8_t next_step);
+
+/* This internal API is used to account for a completed transfer of an asynchronous operation */
+static int8_t async_xfer_done(struct bme69x_async *op);
+
+/* This internal API is used to compensate the fields read by an asynchronous bme69x_get_data */
+static int8_t async_data_done(struct bme69x_async *op);
+
+/* This internal API is used to run the steps of an asynchronous operation until a transfer is submitted */
+static int8_t async_step(struct bme69x_async *op);
+
+/* This internal API is used to check an asynchronous operation before starting it */
+static int8_t async_check(const struct bme69x_async *op);
+
+/*
+ * @brief       Function to analyze the sensor data
+ *
+ * @param[in]   data    Array of measurement data
+ * @param[in]   n_meas  Number of measurements
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t analyze_sensor_data(const struct bme69x_data *data, uint8_t n_meas);
+
+/* This internal API is used to configure and trigger a self-test measurement, round 0 being the gas valid check */
+static int8_t selftest_trigger(struct bme69x_selftest *test, uint8_t round);
+
+/* This internal API is used to read a self-test measurement */
+static int8_t selftest_read(struct bme69x_selftest *test, uint8_t round);
+
+/******************************************************************************************/
+/*                                 Global API definitions                                 */
+/******************************************************************************************/
+
+/* @brief This API reads the chip-id of the sensor which is the first step to
+* verify the sensor and also calibrates the sensor
+* As this API is the entry point, call this API before using other APIs.
+*/
+int8_t bme69x_init(struct bme69x_dev *dev)
+{
+    int8_t rslt;
+
+    if (dev != NULL)
+    {
+        clear_dev_state(dev);
+    }
+
+    (void) bme69x_soft_reset(dev);
+
+    rslt = read_identity(dev);
+
+    return rslt;
+}
+
+/*
+ * @brief This API initializes the sensor from a warm start blob, reading the
+ * unique ID only, or fully when the blob does not match the sensor
+ */
+int8_t bme69x_init_warm(struct bme69x_dev *dev, struct bme69x_warm_blob *blob)
+{
+    int8_t rslt;
+    uint8_t unique_id[BME69X_LEN_UNIQUE_ID];
+    uint8_t match;
+    uint8_t i;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && (blob == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        clear_dev_state(dev);
+        (void) bme69x_soft_reset(dev);
+
+        /* The unique ID is the only read of a warm start */
+        rslt = bme69x_get_regs(BME69X_REG_UNIQUE_ID, unique_id, BME69X_LEN_UNIQUE_ID, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        match = (blob->format == BME69X_WARM_FORMAT) && (blob->checksum == warm_checksum(blob)) &&
+                (blob->chip_id == BME69X_CHIP_ID);
+        for (i = 0; match && (i < BME69X_LEN_UNIQUE_ID); i++)
+        {
+            match = (blob->unique_id[i] == unique_id[i]);
+        }
+
+        if (match)
+        {
+            dev->chip_id = blob->chip_id;
+            dev->variant_id = blob->variant_id;
+            dev->calib = blob->calib;
+        }
+        else
+        {
+            /* Another sensor, another build or a damaged blob */
+            rslt = read_identity(dev);
+            if (rslt == BME69X_OK)
+            {
+                warm_fill(blob, unique_id, dev);
+                rslt = BME69X_W_WARM_MISS;
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API saves the identity and the calibration of an initialized
+ * sensor into a warm start blob
+ */
+int8_t bme69x_warm_save(struct bme69x_warm_blob *blob, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t unique_id[BME69X_LEN_UNIQUE_ID];
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && (blob == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_get_regs(BME69X_REG_UNIQUE_ID, unique_id, BME69X_LEN_UNIQUE_ID, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        warm_fill(blob, unique_id, dev);
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API writes the given data to the register address of the sensor
+ */
+int8_t bme69x_set_regs(const uint8_t *reg_addr, const uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+
+    /* Length of the temporary buffer is 2*(length of register)*/
+    uint8_t tmp_buff[BME69X_LEN_INTERLEAVE_BUFF] = { 0 };
+    uint16_t index;
+
+    /* Check for null pointer in the device structure*/
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && reg_addr && reg_data)
+    {
+        if ((len > 0) && (len <= (BME69X_LEN_INTERLEAVE_BUFF / 2)))
+        {
+            /* Interleave the 2 arrays */
+            for (index = 0; index < len; index++)
+            {
+                if (BME69X_IS_SPI(dev))
+                {
+                    /* Set the memory page */
+                    rslt = set_mem_page(reg_addr[index], dev);
+                    tmp_buff[(2 * index)] = reg_addr[index] & BME69X_SPI_WR_MSK;
+                }
+                else
+                {
+                    tmp_buff[(2 * index)] = reg_addr[index];
+                }
+
+                tmp_buff[(2 * index) + 1] = reg_data[index];
+            }
+
+            /* Write the interleaved array */
+            if (rslt == BME69X_OK)
+            {
+                dev->intf_rslt = BME69X_INTF_WRITE(dev, tmp_buff[0], &tmp_buff[1], (2 * len) - 1);
+                BME69X_STATS_ADD(dev, n_writes, 1);
+                BME69X_STATS_ADD(dev, bytes_written, 2 * len);
+                if (dev->intf_rslt != 0)
+                {
+                    BME69X_STATS_ADD(dev, n_bus_errors, 1);
+                    rslt = BME69X_E_COM_FAIL;
+                }
+                else
+                {
+                    /* Write-through of the shadow register cache */
+                    for (index = 0; index < len; index++)
+                    {
+                        shadow_update(reg_addr[index], &reg_data[index], 1, dev);
+                    }
+                }
+            }
+        }
+        else
+        {
+            rslt = BME69X_E_INVALID_LENGTH;
+        }
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API reads the data from the given register address of sensor.
+ */
+int8_t bme69x_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t intf_addr = reg_addr;
+
+    /* Check for null pointer in the device structure*/
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && reg_data)
+    {
+        if (BME69X_IS_SPI(dev))
+        {
+            /* Set the memory page */
+            rslt = set_mem_page(reg_addr, dev);
+            if (rslt == BME69X_OK)
+            {
+                intf_addr = reg_addr | BME69X_SPI_RD_MSK;
+            }
+        }
+
+        dev->intf_rslt = BME69X_INTF_READ(dev, intf_addr, reg_data, len);
+        BME69X_STATS_ADD(dev, n_reads, 1);
+        BME69X_STATS_ADD(dev, bytes_read, len);
+        if (dev->intf_rslt != 0)
+        {
+            BME69X_STATS_ADD(dev, n_bus_errors, 1);
+            rslt = BME69X_E_COM_FAIL;
+        }
+        else
+        {
+            shadow_update(reg_addr, reg_data, len, dev);
+        }
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API soft-resets the sensor.
+ */
+int8_t bme69x_soft_reset(struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t reg_addr = BME69X_REG_SOFT_RESET;
+
+    /* 0xb6 is the soft reset command */
+    uint8_t soft_rst_cmd = BME69X_SOFT_RESET_CMD;
+
+    /* Check for null pointer in the device structure*/
+    rslt = null_ptr_check(dev);
+    if (rslt == BME69X_OK)
+    {
+        dev->shadow.valid = 0;
+
+        if (BME69X_IS_SPI(dev))
+        {
+            rslt = get_mem_page(dev);
+        }
+
+        /* Reset the device */
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_set_regs(&reg_addr, &soft_rst_cmd, 1, dev);
+
+            if (rslt == BME69X_OK)
+            {
+                /* The reset restores the default register values */
+                dev->shadow.valid = 0;
+
+                /* Wait for 5ms */
+                BME69X_INTF_DELAY_US(dev, BME69X_PERIOD_RESET);
+                BME69X_STATS_ADD(dev, delay_us, BME69X_PERIOD_RESET);
+
+                /* After reset get the memory page */
+                if (BME69X_IS_SPI(dev))
+                {
+                    rslt = get_mem_page(dev);
+                }
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API is used to set the oversampling, filter and odr configuration
+ */
+int8_t bme69x_set_conf(struct bme69x_conf *conf, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t current_op_mode;
+
+    /* Register data starting from BME69X_REG_CTRL_GAS_1(0x71) up to BME69X_REG_CONFIG(0x75) */
+    uint8_t reg_array[BME69X_LEN_CONFIG] = { 0x71, 0x72, 0x73, 0x74, 0x75 };
+    uint8_t data_array[BME69X_LEN_CONFIG] = { 0 };
+
+    rslt = bme69x_get_op_mode(&current_op_mode, dev);
+    if (rslt == BME69X_OK)
+    {
+        /* Configure only in the sleep mode */
+        rslt = bme69x_set_op_mode(BME69X_SLEEP_MODE, dev);
+    }
+
+    if (conf == NULL)
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+    else if (rslt == BME69X_OK)
+    {
+        /* Read the whole configuration and write it back once later */
+        rslt = get_regs_cached(reg_array[0], data_array, BME69X_LEN_CONFIG, dev);
+        dev->info_msg = BME69X_OK;
+        if (rslt == BME69X_OK)
+        {
+            rslt = calc_conf(conf, data_array, dev);
+        }
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_set_regs(reg_array, data_array, BME69X_LEN_CONFIG, dev);
+    }
+
+    if ((current_op_mode != BME69X_SLEEP_MODE) && (rslt == BME69X_OK))
+    {
+        rslt = bme69x_set_op_mode(current_op_mode, dev);
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API is used to get the oversampling, filter and odr
+ */
+int8_t bme69x_get_conf(struct bme69x_conf *conf, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+
+    /* starting address of the register array for burst read*/
+    uint8_t reg_addr = BME69X_REG_CTRL_GAS_1;
+    uint8_t data_array[BME69X_LEN_CONFIG];
+
+    rslt = get_regs_cached(reg_addr, data_array, 5, dev);
+    if (!conf)
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+    else if (rslt == BME69X_OK)
+    {
+        conf->os_hum = BME69X_GET_BITS_POS_0(data_array[1], BME69X_OSH);
+        conf->filter = BME69X_GET_BITS(data_array[4], BME69X_FILTER);
+        conf->os_temp = BME69X_GET_BITS(data_array[3], BME69X_OST);
+        conf->os_pres = BME69X_GET_BITS(data_array[3], BME69X_OSP);
+        if (BME69X_GET_BITS(data_array[0], BME69X_ODR3))
+        {
+            conf->odr = BME69X_ODR_NONE;
+        }
+        else
+        {
+            conf->odr = BME69X_GET_BITS(data_array[4], BME69X_ODR20);
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API is used to set the operation mode of the sensor
+ */
+int8_t bme69x_set_op_mode(const uint8_t op_mode, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t tmp_pow_mode;
+    uint8_t pow_mode = 0;
+    uint8_t reg_addr = BME69X_REG_CTRL_MEAS;
+
+    /* Only the first poll can be served from the shadow register cache */
+    rslt = get_regs_cached(BME69X_REG_CTRL_MEAS, &tmp_pow_mode, 1, dev);
+
+#ifdef BME69X_ONLY_FORCED
+
+    /* The parallel and sequential modes are not built in */
+    if ((rslt == BME69X_OK) && !BME69X_IS_MODE(op_mode))
+    {
+        rslt = BME69X_W_DEFINE_OP_MODE;
+    }
+#endif
+
+    /* Call until in sleep */
+    while (rslt == BME69X_OK)
+    {
+        /* Put to sleep before changing mode */
+        pow_mode = (tmp_pow_mode & BME69X_MODE_MSK);
+        if (pow_mode == BME69X_SLEEP_MODE)
+        {
+            break;
+        }
+
+        tmp_pow_mode &= ~BME69X_MODE_MSK; /* Set to sleep */
+        rslt = bme69x_set_regs(&reg_addr, &tmp_pow_mode, 1, dev);
+        BME69X_INTF_DELAY_US(dev, BME69X_PERIOD_POLL);
+        BME69X_STATS_ADD(dev, delay_us, BME69X_PERIOD_POLL);
+        BME69X_STATS_ADD(dev, n_retries, 1);
+
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_get_regs(BME69X_REG_CTRL_MEAS, &tmp_pow_mode, 1, dev);
+        }
+    }
+
+    /* Already in sleep */
+    if ((op_mode != BME69X_SLEEP_MODE) && (rslt == BME69X_OK))
+    {
+        tmp_pow_mode = (tmp_pow_mode & ~BME69X_MODE_MSK) | (op_mode & BME69X_MODE_MSK);
+        rslt = bme69x_set_regs(&reg_addr, &tmp_pow_mode, 1, dev);
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API is used to get the operation mode of the sensor.
+ */
+int8_t bme69x_get_op_mode(uint8_t *op_mode, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t mode;
+
+    if (op_mode)
+    {
+        rslt = get_regs_cached(BME69X_REG_CTRL_MEAS, &mode, 1, dev);
+
+        /* Masking the other register bit info*/
+        *op_mode = mode & BME69X_MODE_MSK;
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API is used to get the remaining duration that can be used for heating.
+ */
+uint32_t bme69x_get_meas_dur(const uint8_t op_mode, struct bme69x_conf *conf, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint32_t meas_dur = 0; /* Calculate in us */
+    uint32_t meas_cycles;
+    uint8_t os_to_meas_cycles[6] = { 0, 1, 2, 4, 8, 16 };
+
+    if (conf != NULL)
+    {
+        /* Boundary check for temperature oversampling */
+        rslt = boundary_check(&conf->os_temp, BME69X_OS_16X, dev);
+
+        if (rslt == BME69X_OK)
+        {
+            /* Boundary check for pressure oversampling */
+            rslt = boundary_check(&conf->os_pres, BME69X_OS_16X, dev);
+        }
+
+        if (rslt == BME69X_OK)
+        {
+            /* Boundary check for humidity oversampling */
+            rslt = boundary_check(&conf->os_hum, BME69X_OS_16X, dev);
+        }
+
+        if (rslt == BME69X_OK)
+        {
+            meas_cycles = os_to_meas_cycles[conf->os_temp];
+            meas_cycles += os_to_meas_cycles[conf->os_pres];
+            meas_cycles += os_to_meas_cycles[conf->os_hum];
+
+            /* TPH measurement duration */
+            meas_dur = meas_cycles * UINT32_C(1963);
+            meas_dur += UINT32_C(477 * 4); /* TPH switching duration */
+            meas_dur += UINT32_C(477 * 5); /* Gas measurement duration */
+
+            if (op_mode != BME69X_PARALLEL_MODE)
+            {
+                meas_dur += UINT32_C(1000); /* Wake up duration of 1ms */
+            }
+        }
+    }
+
+    return meas_dur;
+}
+
+/*
+ * @brief This API reads the pressure, temperature and humidity and gas data
+ * from the sensor, compensates the data and store it in the bme69x_data
+ * structure instance passed by the user.
+ */
+int8_t bme69x_get_data(uint8_t op_mode, struct bme69x_data *data, uint8_t *n_data, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t new_fields = 0;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && (data != NULL))
+    {
+        /* Reading the sensor data in forced mode only */
+        if (op_mode == BME69X_FORCED_MODE)
+        {
+            rslt = read_field_data(0, data, dev);
+            if (rslt == BME69X_OK)
+            {
+                if (data->status & BME69X_NEW_DATA_MSK)
+                {
+                    new_fields = 1;
+
+                    /* The sensor returns to sleep once the forced measurement is done */
+                    dev->shadow.regs[shadow_index(BME69X_REG_CTRL_MEAS)] &= (uint8_t)~BME69X_MODE_MSK;
+                }
+                else
+                {
+                    new_fields = 0;
+                    rslt = BME69X_W_NO_NEW_DATA;
+                }
+            }
+        }
+        else if (BME69X_IS_MULTI_FIELD(op_mode))
+        {
+            /* Read the 3 fields, the new data fields come first and from the oldest */
+            new_fields = 0;
+            rslt = read_all_field_data(data, &new_fields, dev);
+
+            if ((rslt == BME69X_OK) && (new_fields == 0))
+            {
+                rslt = BME69X_W_NO_NEW_DATA;
+            }
+        }
+        else
+        {
+            rslt = BME69X_W_DEFINE_OP_MODE;
+        }
+
+        if (n_data == NULL)
+        {
+            rslt = BME69X_E_NULL_PTR;
+        }
+        else
+        {
+            *n_data = new_fields;
+        }
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API parses the registers of one data field into raw values.
+ */
+int8_t bme69x_parse_field(const uint8_t *field, struct bme69x_raw_field *raw)
+{
+    int8_t rslt = BME69X_OK;
+
+    if ((field != NULL) && (raw != NULL))
+    {
+        raw->status = field[0] & BME69X_NEW_DATA_MSK;
+        raw->gas_index = field[0] & BME69X_GAS_INDEX_MSK;
+        raw->meas_index = field[1];
+
+        /* read the raw data from the sensor */
+        raw->pres_adc = (uint32_t)(((uint32_t)field[2] << 16) | ((uint32_t)field[3] << 8) | ((uint32_t)field[4]));
+        raw->temp_adc = (uint32_t)(((uint32_t)field[5] << 16) | ((uint32_t)field[6] << 8) | ((uint32_t)field[7]));
+        raw->hum_adc = (uint16_t)(((uint32_t)field[8] << 8) | (uint32_t)field[9]);
+        raw->gas_adc = ((uint16_t)field[15] << 2) | ((uint16_t)field[16] >> 6);
+        raw->gas_range = field[16] & BME69X_GAS_RANGE_MSK;
+
+        raw->status |= field[16] & BME69X_GASM_VALID_MSK;
+        raw->status |= field[16] & BME69X_HEAT_STAB_MSK;
+
+        raw->res_heat = 0;
+        raw->idac = 0;
+        raw->gas_wait = 0;
+        raw->timestamp = 0;
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API compensates the raw data of one field. It only reads the
+ * calibration coefficients, so it can run concurrently on one calibration.
+ */
+int8_t bme69x_compensate(const struct bme69x_calib_data *calib,
+                         const struct bme69x_raw_field *raw,
+                         struct bme69x_data *data)
+{
+    int8_t rslt = BME69X_OK;
+
+    if ((calib != NULL) && (raw != NULL) && (data != NULL))
+    {
+        data->status = raw->status;
+        data->gas_index = raw->gas_index;
+        data->meas_index = raw->meas_index;
+        data->res_heat = raw->res_heat;
+        data->idac = raw->idac;
+        data->gas_wait = raw->gas_wait;
+        data->timestamp = raw->timestamp;
+
+        compensate_data(calib, raw->temp_adc, raw->pres_adc, raw->hum_adc, raw->gas_adc, raw->gas_range, data);
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API reads the calibration coefficient registers as they are.
+ */
+int8_t bme69x_get_coeff(uint8_t *coeff, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && (coeff == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_get_regs(BME69X_REG_COEFF1, coeff, BME69X_LEN_COEFF1, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_get_regs(BME69X_REG_COEFF2, &coeff[BME69X_LEN_COEFF1], BME69X_LEN_COEFF2, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_get_regs(BME69X_REG_COEFF3,
+                               &coeff[BME69X_LEN_COEFF1 + BME69X_LEN_COEFF2],
+                               BME69X_LEN_COEFF3,
+                               dev);
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API parses the calibration coefficient registers into a
+ * calibration block.
+ */
+int8_t bme69x_parse_calib(const uint8_t *coeff, struct bme69x_calib_data *calib)
+{
+    int8_t rslt = BME69X_OK;
+
+    if ((coeff == NULL) || (calib == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        /* Temperature related coefficients */
+        calib->par_t1 =
+            (uint16_t)(BME69X_CONCAT_BYTES(coeff[BME69X_IDX_DO_C_MSB], coeff[BME69X_IDX_DO_C_LSB]));
+        calib->par_t2 =
+            (uint16_t)(BME69X_CONCAT_BYTES(coeff[BME69X_IDX_DTK1_C_MSB], coeff[BME69X_IDX_DTK1_C_LSB]));
+        calib->par_t3 = (int8_t)(coeff[BME69X_IDX_DTK2_C]);
+
+        /* Pressure related coefficients */
+        calib->par_p5 =
+            (int16_t)(BME69X_CONCAT_BYTES(coeff[BME69X_IDX_S_C_MSB], coeff[BME69X_IDX_S_C_LSB]));
+        calib->par_p6 =
+            (int16_t)(BME69X_CONCAT_BYTES(coeff[BME69X_IDX_TK1S_C_MSB], coeff[BME69X_IDX_TK1S_C_LSB]));
+        calib->par_p7 = (int8_t)coeff[BME69X_IDX_TK2S_C];
+        calib->par_p8 = (int8_t)coeff[BME69X_IDX_TK3S_C];
+
+        calib->par_p1 =
+            (int16_t)(BME69X_CONCAT_BYTES(coeff[BME69X_IDX_O_C_MSB], coeff[BME69X_IDX_O_C_LSB]));
+        calib->par_p2 =
+            (uint16_t)(BME69X_CONCAT_BYTES(coeff[BME69X_IDX_TK10_C_MSB], coeff[BME69X_IDX_TK10_C_LSB]));
+        calib->par_p3 = (int8_t)(coeff[BME69X_IDX_TK20_C]);
+        calib->par_p4 = (int8_t)(coeff[BME69X_IDX_TK30_C]);
+
+        calib->par_p9 =
+            (int16_t)(BME69X_CONCAT_BYTES(coeff[BME69X_IDX_NLS_C_MSB], coeff[BME69X_IDX_NLS_C_LSB]));
+        calib->par_p10 = (int8_t)(coeff[BME69X_IDX_TKNLS_C]);
+        calib->par_p11 = (int8_t)(coeff[BME69X_IDX_NLS3_C]);
+
+        /* Humidity related coefficients */
+        calib->par_h5 =
+            (int16_t)(((int16_t)coeff[BME69X_IDX_S_H_MSB] << 4) | (coeff[BME69X_IDX_S_H_LSB] >> 4));
+
+        if (calib->par_h5 > 2047)
+        {
+            /* Convert to negative value */
+            calib->par_h5 = (int16_t)(calib->par_h5 - 4096);
+        }
+
+        calib->par_h1 =
+            (int16_t)(((int16_t)coeff[BME69X_IDX_O_H_MSB] << 4) | (coeff[BME69X_IDX_O_H_LSB] & 0x0F));
+
+        /* Check if the value is above 2047 */
+        if (calib->par_h1 > 2047)
+        {
+            /* Convert to negative value */
+            calib->par_h1 = (int16_t)(calib->par_h1 - 4096);
+        }
+
+        calib->par_h2 = (int8_t)coeff[BME69X_IDX_TK10H_C];
+        calib->par_h4 = (int8_t)coeff[BME69X_IDX_par_h4];
+        calib->par_h3 = (uint8_t)coeff[BME69X_IDX_par_h3];
+        calib->par_h6 = (uint8_t)coeff[BME69X_IDX_HLIN2_C];
+
+        /* Gas heater related coefficients */
+        calib->par_g1 = (int8_t)coeff[BME69X_IDX_RO_C];
+        calib->par_g2 =
+            (int16_t)(BME69X_CONCAT_BYTES(coeff[BME69X_IDX_TKR_C_MSB], coeff[BME69X_IDX_TKR_C_LSB]));
+        calib->par_g3 = (int8_t)coeff[BME69X_IDX_T_AMB_COMP];
+
+        /* Other coefficients */
+        calib->res_heat_range = ((coeff[BME69X_IDX_RES_HEAT_RANGE] & BME69X_RHRANGE_MSK) >> 4);
+        calib->res_heat_val = (int8_t)coeff[BME69X_IDX_RES_HEAT_VAL];
+        calib->range_sw_err = ((int8_t)(coeff[BME69X_IDX_RANGE_SW_ERR] & BME69X_RSERROR_MSK)) / 16;
+
+        rslt = bme69x_derive_calib(calib);
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API computes the compensation constants derived from the
+ * calibration coefficients.
+ */
+int8_t bme69x_derive_calib(struct bme69x_calib_data *calib)
+{
+    int8_t rslt = BME69X_OK;
+    struct bme69x_calib_derived *d;
+
+    if (calib != NULL)
+    {
+        d = &calib->derived;
+#ifndef BME69X_USE_FPU
+        d->p1_off = calib->par_p1 * ((int64_t)1 << 47);
+        d->p5_sens = (calib->par_p5 - 16384) * ((int64_t)1 << 46);
+        d->p9_nl = calib->par_p9 * (1 << 16);
+        d->rh_var5 = (131 * calib->res_heat_val) + 65536UL;
+#else
+        d->do1 = (int32_t)calib->par_t1 << 8;
+        d->dtk1 = (double)calib->par_t2 / (double)(1ULL << 30);
+        d->dtk2 = (double)calib->par_t3 / (double)(1ULL << 48);
+
+        d->o = (double)((uint32_t)calib->par_p1 * (uint32_t)(1ULL << 3));
+        d->tk10 = (double)calib->par_p2 / (double)(1ULL << 6);
+        d->tk20 = (double)calib->par_p3 / (double)(1ULL << 8);
+        d->tk30 = (double)calib->par_p4 / (double)(1ULL << 15);
+
+        d->s = ((double)calib->par_p5 - (double)(1ULL << 14)) / (double)(1ULL << 20);
+        d->tk1s = ((double)calib->par_p6 - (double)(1ULL << 14)) / (double)(1ULL << 29);
+        d->tk2s = (double)calib->par_p7 / (double)(1ULL << 32);
+        d->tk3s = (double)calib->par_p8 / (double)(1ULL << 37);
+
+        d->nls = (double)calib->par_p9 / (double)(1ULL << 48);
+        d->tknls = (double)calib->par_p10 / (double)(1ULL << 48);
+
+        /*
+         * NLS3 = par_p11 / 2^65
+         * 2^65 is exceeding the width of 'double' datatype and hence we splitted into two factors since A^(x+y) = A^x * A^y
+         */
+        d->nls3 = (double)calib->par_p11 / ((double)(1ULL << 35) * (double)(1ULL << 30));
+
+        d->oh = (double)calib->par_h1 * (double)(1ULL << 6);
+        d->sh = (double)calib->par_h5 / (double)(1ULL << 16);
+        d->tk10h = (double)calib->par_h2 / (double)(1ULL << 14);
+        d->tk1sh = (double)calib->par_h4 / (double)(1ULL << 26);
+        d->tk12sh = d->tk1sh * ((double)calib->par_h3 / (double)(1ULL << 26));
+        d->hlin2 = (double)calib->par_h6 / (double)(1ULL << 19);
+
+        d->rh_var1 = (((float)calib->par_g1 / (16.0f)) + 49.0f);
+        d->rh_var2 = ((((float)calib->par_g2 / (32768.0f)) * (0.0005f)) + 0.00235f);
+        d->rh_var3 = ((float)calib->par_g3 / (1024.0f));
+        d->rh_range = 4 / (4 + (float)calib->res_heat_range);
+        d->rh_val = 1 / (1 + ((float)calib->res_heat_val * 0.002f));
+#endif
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API compensates arrays of raw ADC samples with the given
+ * calibration coefficients.
+ */
+int8_t bme69x_compensate_batch(const struct bme69x_calib_data *calib,
+                               const struct bme69x_raw_batch *raw,
+                               struct bme69x_data *data,
+                               uint32_t n)
+{
+    int8_t rslt = BME69X_OK;
+    uint32_t i = 0;
+
+#if defined(BME69X_SIMD_X86) || defined(BME69X_SIMD_NEON)
+    uint32_t n_simd;
+#endif
+
+    if ((calib == NULL) || (raw == NULL) || (data == NULL) || (raw->temp_adc == NULL) || (raw->pres_adc == NULL) ||
+        (raw->hum_adc == NULL) || (raw->gas_adc == NULL) || (raw->gas_range == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+    else
+    {
+#if defined(BME69X_SIMD_X86) || defined(BME69X_SIMD_NEON)
+        /* Temperature and pressure of whole vectors, the remaining quantities per sample */
+#ifdef BME69X_SIMD_X86
+        if (__builtin_cpu_supports("avx2"))
+        {
+            n_simd = simd_comp_avx2(&calib->derived, raw, data, n);
+        }
+        else
+        {
+            n_simd = simd_comp_sse2(&calib->derived, raw, data, n);
+        }
+
+#else
+        n_simd = simd_comp_neon(&calib->derived, raw, data, n);
+#endif
+
+        for (; i < n_simd; i++)
+        {
+            data[i].humidity = calc_humidity(raw->hum_adc[i], data[i].temperature, calib);
+            data[i].gas_resistance = calc_gas_resistance(raw->gas_adc[i], raw->gas_range[i] & BME69X_GAS_RANGE_MSK);
+        }
+
+#endif
+
+        for (; i < n; i++)
+        {
+            compensate_data(calib,
+                            raw->temp_adc[i],
+                            raw->pres_adc[i],
+                            raw->hum_adc[i],
+                            raw->gas_adc[i],
+                            raw->gas_range[i] & BME69X_GAS_RANGE_MSK,
+                            &data[i]);
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API initializes an empty ring of raw frames.
+ */
+int8_t bme69x_ring_init(struct bme69x_ring *ring)
+{
+    int8_t rslt = BME69X_OK;
+
+    if (ring != NULL)
+    {
+        ring->head = 0;
+        ring->tail = 0;
+        ring->n_dropped = 0;
+        ring->last_index = 0;
+        ring->started = 0;
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API pushes a raw frame to the ring, dropping it when the ring is full.
+ */
+int8_t bme69x_ring_push(struct bme69x_ring *ring, const struct bme69x_frame *frame)
+{
+    int8_t rslt = BME69X_OK;
+    uint32_t head;
+
+    if ((ring != NULL) && (frame != NULL))
+    {
+        head = ring->head;
+        if ((head - BME69X_LOAD_ACQUIRE(&ring->tail)) >= BME69X_RING_LEN)
+        {
+            ring->n_dropped++;
+            rslt = BME69X_W_RING_FULL;
+        }
+        else
+        {
+            ring->frames[head & (BME69X_RING_LEN - 1)] = *frame;
+
+            /* Publish the frame only once it is completely written */
+            BME69X_STORE_RELEASE(&ring->head, head + 1);
+        }
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API pops the oldest raw frame from the ring.
+ */
+int8_t bme69x_ring_pop(struct bme69x_ring *ring, struct bme69x_frame *frame)
+{
+    int8_t rslt = BME69X_OK;
+    uint32_t tail;
+
+    if ((ring != NULL) && (frame != NULL))
+    {
+        tail = ring->tail;
+        if (BME69X_LOAD_ACQUIRE(&ring->head) == tail)
+        {
+            rslt = BME69X_W_NO_NEW_DATA;
+        }
+        else
+        {
+            *frame = ring->frames[tail & (BME69X_RING_LEN - 1)];
+
+            /* Release the slot only once the frame is copied */
+            BME69X_STORE_RELEASE(&ring->tail, tail + 1);
+        }
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API reads the new data fields of the sensor and pushes them to
+ * the ring as raw frames, without compensating them.
+ */
+int8_t bme69x_ring_acquire(uint8_t op_mode, uint64_t timestamp, struct bme69x_ring *ring, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t buff[BME69X_LEN_FIELD * 3] = { 0 };
+    uint8_t set_val[BME69X_LEN_HEATR_REGS] = { 0 }; /* idac, res_heat, gas_wait */
+    struct bme69x_raw_field raw[3] = { { 0 } };
+    uint8_t order[3] = { 0 };
+    struct bme69x_frame frame;
+    uint64_t stamp = 0;
+    uint8_t n_fields = 3;
+    uint8_t n_new = 0;
+    uint8_t new_fields = 0;
+    uint8_t dropped = 0;
+    uint8_t off;
+    uint8_t i, j;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && (ring == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        if (op_mode == BME69X_FORCED_MODE)
+        {
+            n_fields = 1;
+        }
+        else if (!BME69X_IS_MULTI_FIELD(op_mode))
+        {
+            rslt = BME69X_W_DEFINE_OP_MODE;
+        }
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_get_regs(BME69X_REG_FIELD0, buff, (uint32_t)BME69X_LEN_FIELD * n_fields, dev);
+
+        /* The frames are stamped once the burst completed, by the caller for a device without clock */
+        stamp = BME69X_INTF_TIME_NS(dev);
+        if (stamp == 0)
+        {
+            stamp = timestamp;
+        }
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        for (i = 0; i < n_fields; i++)
+        {
+            (void)bme69x_parse_field(&buff[i * BME69X_LEN_FIELD], &raw[i]);
+        }
+
+        /* The heater registers are read once, or served from the shadow register cache */
+        n_new = order_fields(raw, n_fields, order);
+        if (n_new > 0)
+        {
+            rslt = get_regs_cached(BME69X_REG_IDAC_HEAT0, set_val, BME69X_LEN_HEATR_REGS, dev);
+        }
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        fill_field_heatr(raw, n_fields, set_val);
+    }
+
+    for (i = 0; (i < n_new) && (rslt == BME69X_OK); i++)
+    {
+        /* The sensor keeps the new data flag of a field until it is overwritten,
+         * so a field read by an earlier call must not be pushed twice */
+        if ((op_mode != BME69X_FORCED_MODE) && ring->started &&
+            ((int8_t)(raw[order[i]].meas_index - ring->last_index) <= 0))
+        {
+            continue;
+        }
+
+        off = (uint8_t)(order[i] * BME69X_LEN_FIELD);
+        frame.timestamp = stamp;
+        for (j = 0; j < BME69X_LEN_FIELD; j++)
+        {
+            frame.field[j] = buff[off + j];
+        }
+
+        frame.idac = raw[order[i]].idac;
+        frame.res_heat = raw[order[i]].res_heat;
+        frame.gas_wait = raw[order[i]].gas_wait;
+
+        if (bme69x_ring_push(ring, &frame) != BME69X_OK)
+        {
+            dropped++;
+        }
+
+        ring->last_index = raw[order[i]].meas_index;
+        ring->started = 1;
+        new_fields++;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        if (new_fields == 0)
+        {
+            rslt = BME69X_W_NO_NEW_DATA;
+        }
+        else
+        {
+            if (op_mode == BME69X_FORCED_MODE)
+            {
+                /* The sensor returns to sleep once the forced measurement is done */
+                dev->shadow.regs[shadow_index(BME69X_REG_CTRL_MEAS)] &= (uint8_t)~BME69X_MODE_MSK;
+            }
+
+            if (dropped)
+            {
+                rslt = BME69X_W_RING_FULL;
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API compensates a raw frame popped from the ring.
+ */
+int8_t bme69x_frame_compensate(const struct bme69x_calib_data *calib,
+                               const struct bme69x_frame *frame,
+                               struct bme69x_data *data)
+{
+    int8_t rslt;
+    struct bme69x_raw_field raw;
+
+    if (frame != NULL)
+    {
+        rslt = bme69x_parse_field(frame->field, &raw);
+        if (rslt == BME69X_OK)
+        {
+            raw.res_heat = frame->res_heat;
+            raw.idac = frame->idac;
+            raw.gas_wait = frame->gas_wait;
+            raw.timestamp = frame->timestamp;
+            rslt = bme69x_compensate(calib, &raw, data);
+        }
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+#ifndef BME69X_ONLY_FORCED
+
+/*
+ * @brief This API initializes a stream of parallel or sequential mode measurements.
+ */
+int8_t bme69x_stream_init(struct bme69x_stream *stream)
+{
+    int8_t rslt = BME69X_OK;
+
+    if (stream != NULL)
+    {
+        stream->last_index = 0;
+        stream->next_field = 0;
+        stream->window = 3;
+        stream->started = 0;
+        stream->n_emitted = 0;
+        stream->n_dropped = 0;
+        stream->n_duplicate = 0;
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API reads the measurements completed since the last call of the
+ * stream, each measurement being emitted once and in order.
+ */
+int8_t bme69x_stream_read(struct bme69x_data *data, uint8_t *n_data, struct bme69x_stream *stream, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    struct bme69x_raw_field raw[3];
+    uint8_t order[3];
+    uint8_t first = 0;
+    uint8_t count = 3;
+    uint8_t n_new = 0;
+    uint8_t n_out = 0;
+    int8_t gap;
+    uint8_t i;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && ((data == NULL) || (n_data == NULL) || (stream == NULL)))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        /* Only the fields that can have been written since the last read */
+        if (stream->started)
+        {
+            first = stream->next_field;
+            count = stream->window;
+        }
+
+        rslt = read_fields(first, count, raw, dev);
+    }
+
+    /* The window is too small if its last field is new, or if the sensor overwrote the
+     * expected field, read the remaining fields as well */
+    if ((rslt == BME69X_OK) && (count < 3) &&
+        ((raw[count - 1].status & BME69X_NEW_DATA_MSK) ||
+         ((raw[0].status & BME69X_NEW_DATA_MSK) && (raw[0].meas_index != (uint8_t)(stream->last_index + 1)))))
+    {
+        rslt = read_fields((uint8_t)((first + count) % 3), (uint8_t)(3 - count), &raw[count], dev);
+        count = 3;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        n_new = order_fields(raw, count, order);
+        if (n_new > 0)
+        {
+            rslt = set_field_heatr(raw, count, dev);
+        }
+    }
+
+    for (i = 0; (i < n_new) && (rslt == BME69X_OK); i++)
+    {
+        if (stream->started)
+        {
+            /* Measurements between the last emitted one and this one were overwritten */
+            gap = (int8_t)(raw[order[i]].meas_index - (uint8_t)(stream->last_index + 1));
+            if (gap < 0)
+            {
+                stream->n_duplicate++;
+                continue;
+            }
+
+            stream->n_dropped += (uint32_t)gap;
+        }
+
+        (void)bme69x_compensate(&dev->calib, &raw[order[i]], &data[n_out]);
+        n_out++;
+
+        stream->last_index = raw[order[i]].meas_index;
+        stream->next_field = (uint8_t)((first + order[i] + 1) % 3);
+        stream->started = 1;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        stream->n_emitted += n_out;
+
+        /* Expect as many measurements as last time, plus one */
+        if (n_out > 0)
+        {
+            stream->window = (n_out < 3) ? (uint8_t)(n_out + 1) : 3;
+        }
+
+        *n_data = n_out;
+        if (n_out == 0)
+        {
+            rslt = BME69X_W_NO_NEW_DATA;
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API starts a sequential mode profile of any length
+ */
+int8_t bme69x_seq_start(struct bme69x_conf *conf,
+                        const struct bme69x_heatr_conf *heatr_conf,
+                        struct bme69x_seq *seq,
+                        struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    struct bme69x_heatr_conf slots;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) &&
+        ((conf == NULL) || (heatr_conf == NULL) || (seq == NULL) || (heatr_conf->heatr_temp_prof == NULL) ||
+         (heatr_conf->heatr_dur_prof == NULL)))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if ((rslt == BME69X_OK) && (heatr_conf->profile_len == 0))
+    {
+        rslt = BME69X_E_INVALID_LENGTH;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        seq->dev = dev;
+        seq->temp_prof = heatr_conf->heatr_temp_prof;
+        seq->dur_prof = heatr_conf->heatr_dur_prof;
+        seq->profile_len = heatr_conf->profile_len;
+        seq->n_slots = (heatr_conf->profile_len > 10) ? 10 : heatr_conf->profile_len;
+        seq->step = 0;
+        seq->slot = 0;
+        seq->n_pending = 0;
+        seq->n_reloads = 0;
+        seq->tph_dur = bme69x_get_meas_dur(BME69X_SEQUENTIAL_MODE, conf, dev);
+        (void)bme69x_stream_init(&seq->stream);
+
+        /* The first steps of the profile fill the heater slots */
+        slots = *heatr_conf;
+        slots.profile_len = seq->n_slots;
+        rslt = bme69x_set_heatr_conf(BME69X_SEQUENTIAL_MODE, &slots, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        seq_stage(seq);
+        rslt = bme69x_set_op_mode(BME69X_SEQUENTIAL_MODE, dev);
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API emits the next measurement of a sequential pipeline
+ */
+int8_t bme69x_seq_read(struct bme69x_data *data, uint8_t *step, struct bme69x_seq *seq)
+{
+    int8_t rslt = BME69X_OK;
+    struct bme69x_data fields[3];
+    uint8_t n_fields = 0;
+    uint8_t skip;
+    uint8_t i;
+
+    if ((data == NULL) || (step == NULL) || (seq == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    /* The bus is only read once the measurements read ahead are emitted */
+    if ((rslt == BME69X_OK) && (seq->n_pending == 0))
+    {
+        rslt = bme69x_stream_read(fields, &n_fields, &seq->stream, seq->dev);
+        for (i = 0; (rslt == BME69X_OK) && (i < n_fields); i++)
+        {
+            /* The slots of the measurements lost in between are reloaded as well */
+            skip = (uint8_t)((fields[i].gas_index + seq->n_slots - seq->slot) % seq->n_slots);
+            for (; (rslt == BME69X_OK) && (skip > 0); skip--)
+            {
+                rslt = seq_advance(seq);
+            }
+
+            seq->pending[seq->n_pending] = fields[i];
+            seq->pending_step[seq->n_pending] = seq->step;
+            seq->n_pending++;
+
+            if (rslt == BME69X_OK)
+            {
+                rslt = seq_advance(seq);
+            }
+        }
+    }
+
+    if ((rslt >= BME69X_OK) && (seq->n_pending > 0))
+    {
+        *data = seq->pending[0];
+        *step = seq->pending_step[0];
+        seq->n_pending--;
+        for (i = 0; i < seq->n_pending; i++)
+        {
+            seq->pending[i] = seq->pending[i + 1];
+            seq->pending_step[i] = seq->pending_step[i + 1];
+        }
+
+        rslt = BME69X_OK;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API gets the time until the next measurement of a sequential
+ * pipeline completes
+ */
+uint32_t bme69x_seq_next_dur(const struct bme69x_seq *seq)
+{
+    uint32_t dur = 0;
+
+    if ((seq != NULL) && (seq->n_pending == 0))
+    {
+        dur = seq->tph_dur + ((uint32_t)seq->dur_prof[seq->step] * UINT32_C(1000));
+    }
+
+    return dur;
+}
+#endif
+
+/*
+ * @brief This API waits for a forced mode measurement to complete, polling
+ * the status register once the predicted duration has elapsed.
+ */
+int8_t bme69x_wait_data(uint8_t op_mode,
+                        struct bme69x_conf *conf,
+                        const struct bme69x_heatr_conf *heatr_conf,
+                        struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    int32_t meas_us;
+    int32_t wait_us;
+    uint16_t polls = 0;
+    uint8_t status = 0;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && (conf == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if ((rslt == BME69X_OK) && (op_mode != BME69X_FORCED_MODE))
+    {
+        rslt = BME69X_W_DEFINE_OP_MODE;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        meas_us = (int32_t)bme69x_get_meas_dur(op_mode, conf, dev);
+        if ((heatr_conf != NULL) && (heatr_conf->enable == BME69X_ENABLE))
+        {
+            meas_us += (int32_t)heatr_conf->heatr_dur * 1000;
+        }
+
+        wait_us = meas_us + dev->acq.skew_us;
+        if (wait_us > 0)
+        {
+            BME69X_INTF_DELAY_US(dev, (uint32_t)wait_us);
+            BME69X_STATS_ADD(dev, delay_us, (uint32_t)wait_us);
+        }
+
+        /* Only the status byte of the first field is read until new data is flagged */
+        while ((rslt == BME69X_OK) && (polls < BME69X_STATUS_POLL_TRIES))
+        {
+            rslt = bme69x_get_regs(BME69X_REG_FIELD0, &status, 1, dev);
+            polls++;
+            if ((rslt != BME69X_OK) || (status & BME69X_NEW_DATA_MSK))
+            {
+                break;
+            }
+
+            BME69X_INTF_DELAY_US(dev, BME69X_PERIOD_STATUS_POLL);
+            BME69X_STATS_ADD(dev, delay_us, BME69X_PERIOD_STATUS_POLL);
+            BME69X_STATS_ADD(dev, n_retries, 1);
+        }
+
+        dev->acq.last_polls = polls;
+        dev->acq.n_polls += polls;
+
+        if (rslt == BME69X_OK)
+        {
+            if (status & BME69X_NEW_DATA_MSK)
+            {
+                dev->acq.n_ready++;
+
+                /*
+                 * Data ready at the first poll means the wait may have been too long,
+                 * shorten it slowly. Every extra poll lengthens it by the time it took.
+                 */
+                if (polls == 1)
+                {
+                    if (wait_us > 0)
+                    {
+                        dev->acq.skew_us -= (int32_t)(BME69X_PERIOD_STATUS_POLL / 4);
+                    }
+                }
+                else
+                {
+                    dev->acq.skew_us += (int32_t)(polls - 1) * (int32_t)BME69X_PERIOD_STATUS_POLL;
+                }
+            }
+            else
+            {
+                dev->acq.n_timeout++;
+                rslt = BME69X_W_NO_NEW_DATA;
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API is used to set the gas configuration of the sensor.
+ */
+int8_t bme69x_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t nb_conv = 0;
+    uint8_t ctrl_gas_data[2];
+    uint8_t ctrl_gas_addr[2] = { BME69X_REG_CTRL_GAS_0, BME69X_REG_CTRL_GAS_1 };
+
+    if (conf != NULL)
+    {
+        rslt = bme69x_set_op_mode(BME69X_SLEEP_MODE, dev);
+        if (rslt == BME69X_OK)
+        {
+            rslt = set_conf(conf, op_mode, &nb_conv, dev);
+        }
+
+        if (rslt == BME69X_OK)
+        {
+            rslt = get_regs_cached(BME69X_REG_CTRL_GAS_0, ctrl_gas_data, 2, dev);
+            if (rslt == BME69X_OK)
+            {
+                calc_ctrl_gas(conf, nb_conv, ctrl_gas_data);
+                rslt = bme69x_set_regs(ctrl_gas_addr, ctrl_gas_data, 2, dev);
+            }
+        }
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the gas configuration of the sensor.
+ */
+int8_t bme69x_get_heatr_conf(const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev)
+{
+    int8_t rslt = BME69X_OK;
+    uint8_t data_array[10] = { 0 };
+    uint8_t i;
+
+    if ((conf != NULL) && (conf->heatr_dur_prof != NULL) && (conf->heatr_temp_prof != NULL))
+    {
+        /* FIXME: Add conversion to deg C and ms and add the other parameters */
+        rslt = bme69x_get_regs(BME69X_REG_RES_HEAT0, data_array, 10, dev);
+
+        if (rslt == BME69X_OK)
+        {
+            for (i = 0; i < conf->profile_len; i++)
+            {
+                conf->heatr_temp_prof[i] = data_array[i];
+            }
+
+            rslt = bme69x_get_regs(BME69X_REG_GAS_WAIT0, data_array, 10, dev);
+
+            if (rslt == BME69X_OK)
+            {
+                for (i = 0; i < conf->profile_len; i++)
+                {
+                    conf->heatr_dur_prof[i] = data_array[i];
+                }
+            }
+        }
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the ambient temperature of the heater targets and
+ * rewrites only the heater resistance registers of the configuration that changed.
+ */
+int8_t bme69x_set_amb_temp(int8_t amb_temp,
+                           uint8_t op_mode,
+                           const struct bme69x_heatr_conf *conf,
+                           struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t reg_addr[10];
+    uint8_t reg_data[10];
+    uint8_t cur[10];
+    uint8_t n_steps = 0;
+    uint8_t n_regs = 0;
+    uint8_t pos = 0;
+    uint8_t cur_mode = BME69X_SLEEP_MODE;
+    uint8_t len;
+    uint8_t i;
+
+#ifndef BME69X_USE_FPU
+    int32_t amb_term;
+#else
+    float amb_term;
+#endif
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && (conf == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        dev->amb_temp = amb_temp;
+
+        /* Without heater only the ambient temperature is kept */
+        if (conf->enable != BME69X_ENABLE)
+        {
+            n_steps = 0;
+        }
+        else if (op_mode == BME69X_FORCED_MODE)
+        {
+            n_steps = 1;
+        }
+        else if (!BME69X_IS_MULTI_FIELD(op_mode))
+        {
+            rslt = BME69X_W_DEFINE_OP_MODE;
+        }
+        else if (conf->heatr_temp_prof == NULL)
+        {
+            rslt = BME69X_E_NULL_PTR;
+        }
+        else if (conf->profile_len > 10)
+        {
+            rslt = BME69X_E_INVALID_LENGTH;
+        }
+        else
+        {
+            n_steps = conf->profile_len;
+        }
+    }
+
+    /* The registers hold the values last written, known without a read with the shadow register cache */
+    if ((rslt == BME69X_OK) && (n_steps > 0))
+    {
+        rslt = get_regs_cached(BME69X_REG_RES_HEAT0, cur, n_steps, dev);
+    }
+
+    if ((rslt == BME69X_OK) && (n_steps > 0))
+    {
+        /* A few steps at most, computed rather than rebuilding a heater resistance table */
+        amb_term = calc_res_heat_amb(dev);
+        for (i = 0; i < n_steps; i++)
+        {
+            reg_data[n_regs] =
+                calc_res_heat((op_mode == BME69X_FORCED_MODE) ? conf->heatr_temp : conf->heatr_temp_prof[i],
+                              amb_term,
+                              dev);
+            if (reg_data[n_regs] != cur[i])
+            {
+                reg_addr[n_regs] = (uint8_t)(BME69X_REG_RES_HEAT0 + i);
+                n_regs++;
+            }
+        }
+    }
+
+    /* The heater registers are only written in sleep mode, a running forced measurement is let finish */
+    if ((rslt == BME69X_OK) && (n_regs > 0))
+    {
+        rslt = bme69x_get_op_mode(&cur_mode, dev);
+        if ((rslt == BME69X_OK) && (cur_mode != BME69X_SLEEP_MODE))
+        {
+            rslt = bme69x_set_op_mode(BME69X_SLEEP_MODE, dev);
+        }
+    }
+
+    /* As many register pairs per burst as the interleaved buffer holds */
+    while ((rslt == BME69X_OK) && (pos < n_regs))
+    {
+        len = write_chunk_len(&reg_addr[pos], (uint8_t)(n_regs - pos));
+        rslt = bme69x_set_regs(&reg_addr[pos], &reg_data[pos], len, dev);
+        pos += len;
+    }
+
+    /* A parallel or sequential mode measurement restarts, forced mode returns to sleep by itself */
+    if ((rslt == BME69X_OK) && BME69X_IS_MULTI_FIELD(cur_mode))
+    {
+        rslt = bme69x_set_op_mode(cur_mode, dev);
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API starts a configuration transaction
+ */
+int8_t bme69x_txn_begin(struct bme69x_txn *txn, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && (txn != NULL))
+    {
+        txn->dev = dev;
+        txn->staged = 0;
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API stages the oversampling, filter and odr configuration of a transaction
+ */
+int8_t bme69x_txn_set_conf(const struct bme69x_conf *conf, struct bme69x_txn *txn)
+{
+    int8_t rslt = BME69X_OK;
+
+    if ((conf != NULL) && (txn != NULL))
+    {
+        txn->conf = *conf;
+        txn->staged |= BME69X_TXN_CONF;
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API stages the heater configuration of a transaction
+ */
+int8_t bme69x_txn_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_txn *txn)
+{
+    int8_t rslt = BME69X_OK;
+    uint8_t i;
+
+    if ((conf == NULL) || (txn == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+    else if (BME69X_IS_MULTI_FIELD(op_mode))
+    {
+        if ((conf->heatr_temp_prof == NULL) || (conf->heatr_dur_prof == NULL))
+        {
+            rslt = BME69X_E_NULL_PTR;
+        }
+        else if (conf->profile_len > 10)
+        {
+            rslt = BME69X_E_INVALID_LENGTH;
+        }
+    }
+    else if (op_mode != BME69X_FORCED_MODE)
+    {
+        rslt = BME69X_W_DEFINE_OP_MODE;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        /* The profiles are copied, the caller may reuse its arrays before the commit */
+        txn->heatr_conf = *conf;
+        if (op_mode != BME69X_FORCED_MODE)
+        {
+            for (i = 0; i < conf->profile_len; i++)
+            {
+                txn->temp_prof[i] = conf->heatr_temp_prof[i];
+                txn->dur_prof[i] = conf->heatr_dur_prof[i];
+            }
+        }
+
+        txn->heatr_conf.heatr_temp_prof = txn->temp_prof;
+        txn->heatr_conf.heatr_dur_prof = txn->dur_prof;
+        txn->heatr_mode = op_mode;
+        txn->staged |= BME69X_TXN_HEATR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API writes the staged configuration of a transaction and enters an operation mode
+ */
+int8_t bme69x_txn_commit(uint8_t op_mode, struct bme69x_txn *txn)
+{
+    int8_t rslt;
+    struct bme69x_dev *dev = NULL;
+    uint8_t nb_conv = 0;
+    uint8_t n_heatr = 0;
+    uint8_t n_regs = 0;
+    uint8_t pos = 0;
+    uint8_t len;
+    uint8_t cur;
+    uint8_t i;
+
+    /* Register data starting from BME69X_REG_CTRL_GAS_0(0x70) up to BME69X_REG_CONFIG(0x75) */
+    uint8_t ctrl[BME69X_LEN_CTRL] = { 0 };
+    uint8_t ctrl_new[BME69X_LEN_CTRL];
+
+    /* Control registers in the order of the writes, BME69X_REG_CTRL_MEAS last to enter the mode once configured */
+    const uint8_t ctrl_order[BME69X_LEN_CTRL] = { 0, 1, 2, 3, 5, 4 };
+    uint8_t reg_addr[BME69X_LEN_TXN_REGS] = { 0 };
+    uint8_t reg_data[BME69X_LEN_TXN_REGS] = { 0 };
+
+    if (txn != NULL)
+    {
+        dev = txn->dev;
+    }
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && !BME69X_IS_MODE(op_mode))
+    {
+        rslt = BME69X_W_DEFINE_OP_MODE;
+    }
+
+    /* The heater registers do not depend on the sensor state, an invalid profile leaves the sensor untouched */
+    if ((rslt == BME69X_OK) && (txn->staged & BME69X_TXN_HEATR))
+    {
+        rslt = calc_heatr_regs(&txn->heatr_conf, txn->heatr_mode, &nb_conv, reg_addr, reg_data, &n_heatr, dev);
+    }
+
+    /* A single sleep mode entry for the whole configuration */
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_set_op_mode(BME69X_SLEEP_MODE, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = get_regs_cached(BME69X_REG_CTRL_GAS_0, ctrl, BME69X_LEN_CTRL, dev);
+    }
+
+    for (i = 0; i < BME69X_LEN_CTRL; i++)
+    {
+        ctrl_new[i] = ctrl[i];
+    }
+
+    if ((rslt == BME69X_OK) && (txn->staged & BME69X_TXN_CONF))
+    {
+        dev->info_msg = BME69X_OK;
+        rslt = calc_conf(&txn->conf, &ctrl_new[1], dev);
+    }
+
+    if ((rslt == BME69X_OK) && (txn->staged & BME69X_TXN_HEATR))
+    {
+        calc_ctrl_gas(&txn->heatr_conf, nb_conv, ctrl_new);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        /* Heater registers the shadow register cache knows to hold their value already are skipped */
+        for (i = 0; i < n_heatr; i++)
+        {
+            if (!shadow_hit(reg_addr[i], &cur, 1, dev) || (cur != reg_data[i]))
+            {
+                reg_addr[n_regs] = reg_addr[i];
+                reg_data[n_regs] = reg_data[i];
+                n_regs++;
+            }
+        }
+
+        ctrl_new[4] = (uint8_t)((ctrl_new[4] & ~BME69X_MODE_MSK) | (op_mode & BME69X_MODE_MSK));
+
+        /* The control registers were just read, only the changed ones are written */
+        for (i = 0; i < BME69X_LEN_CTRL; i++)
+        {
+            if (ctrl_new[ctrl_order[i]] != ctrl[ctrl_order[i]])
+            {
+                reg_addr[n_regs] = (uint8_t)(BME69X_REG_CTRL_GAS_0 + ctrl_order[i]);
+                reg_data[n_regs] = ctrl_new[ctrl_order[i]];
+                n_regs++;
+            }
+        }
+    }
+
+    /* As many register pairs per burst as the interleaved buffer holds */
+    while ((rslt == BME69X_OK) && (pos < n_regs))
+    {
+        len = write_chunk_len(&reg_addr[pos], (uint8_t)(n_regs - pos));
+        rslt = bme69x_set_regs(&reg_addr[pos], &reg_data[pos], len, dev);
+        pos += len;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        txn->staged = 0;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API performs Self-test of low and high gas variants of BME69X
+ */
+int8_t bme69x_selftest_check(const struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    struct bme69x_selftest test;
+
+    rslt = bme69x_selftest_run(&test, &dev, 1);
+    if (rslt == BME69X_E_SELF_TEST)
+    {
+        rslt = test.rslt;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API runs the self-test sequence on several devices at once
+ */
+int8_t bme69x_selftest_run(struct bme69x_selftest *tests, const struct bme69x_dev *const *devs, uint8_t n_devs)
+{
+    int8_t rslt = BME69X_OK;
+    struct bme69x_dev *waiter;
+    uint8_t round;
+    uint8_t i;
+
+    if ((tests == NULL) || (devs == NULL) || (n_devs == 0))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    for (i = 0; (rslt == BME69X_OK) && (i < n_devs); i++)
+    {
+        tests[i].n_meas = 0;
+        tests[i].rslt = null_ptr_check(devs[i]);
+        if (tests[i].rslt == BME69X_OK)
+        {
+            /* Copy required parameters from reference bme69x_dev struct, the others are left cleared */
+            memset(&tests[i].t_dev, 0, sizeof(tests[i].t_dev));
+            tests[i].t_dev.amb_temp = 25;
+            tests[i].t_dev.read = devs[i]->read;
+            tests[i].t_dev.write = devs[i]->write;
+            tests[i].t_dev.intf = devs[i]->intf;
+            tests[i].t_dev.delay_us = devs[i]->delay_us;
+            tests[i].t_dev.get_time_ns = devs[i]->get_time_ns;
+            tests[i].t_dev.intf_ptr = devs[i]->intf_ptr;
+
+            tests[i].rslt = bme69x_init(&tests[i].t_dev);
+        }
+    }
+
+    /* Every round triggers all the devices still passing, then waits once for all of them */
+    for (round = 0; (rslt == BME69X_OK) && (round <= BME69X_N_MEAS); round++)
+    {
+        waiter = NULL;
+        for (i = 0; i < n_devs; i++)
+        {
+            if (tests[i].rslt == BME69X_OK)
+            {
+                tests[i].rslt = selftest_trigger(&tests[i], round);
+                if ((tests[i].rslt == BME69X_OK) && (waiter == NULL))
+                {
+                    waiter = &tests[i].t_dev;
+                }
+            }
+        }
+
+        if (waiter == NULL)
+        {
+            break;
+        }
+
+        /* Wait for the measurements to complete, the last trigger waits the longest */
+        BME69X_INTF_DELAY_US(waiter, (round == 0) ? BME69X_HEATR_DUR1_DELAY : BME69X_HEATR_DUR2_DELAY);
+
+        for (i = 0; i < n_devs; i++)
+        {
+            if (tests[i].rslt == BME69X_OK)
+            {
+                tests[i].rslt = selftest_read(&tests[i], round);
+            }
+        }
+    }
+
+    for (i = 0; (rslt == BME69X_OK) && (i < n_devs); i++)
+    {
+        if (tests[i].rslt == BME69X_OK)
+        {
+            tests[i].rslt = analyze_sensor_data(tests[i].data, BME69X_N_MEAS);
+        }
+    }
+
+    for (i = 0; (rslt == BME69X_OK) && (i < n_devs); i++)
+    {
+        if (tests[i].rslt != BME69X_OK)
+        {
+            rslt = BME69X_E_SELF_TEST;
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API binds an asynchronous operation to a device and to its completion callback
+ */
+int8_t bme69x_async_init(struct bme69x_async *op, bme69x_async_cb_t cb, void *arg, struct bme69x_dev *dev)
+{
+    int8_t rslt = BME69X_OK;
+
+    if ((op != NULL) && (cb != NULL) && (dev != NULL))
+    {
+        op->dev = dev;
+        op->cb = cb;
+        op->arg = arg;
+        op->busy = 0;
+        op->pending = 0;
+        op->page_step = 0;
+        op->step = BME69X_ASYNC_DONE;
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API starts reading the sensor data without blocking
+ */
+int8_t bme69x_async_get_data(uint8_t op_mode, struct bme69x_data *data, uint8_t *n_data, struct bme69x_async *op)
+{
+    int8_t rslt;
+
+    rslt = async_check(op);
+    if ((rslt == BME69X_OK) && ((data == NULL) || (n_data == NULL)))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if ((rslt == BME69X_OK) && (op_mode != BME69X_FORCED_MODE) && !BME69X_IS_MULTI_FIELD(op_mode))
+    {
+        *n_data = 0;
+        rslt = BME69X_W_DEFINE_OP_MODE;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        op->busy = 1;
+        op->op_mode = op_mode;
+        op->data = data;
+        op->n_data = n_data;
+        op->tries = 5;
+        op->page_step = 0;
+        op->step = BME69X_ASYNC_FIELD_READ;
+
+        rslt = async_step(op);
+        if (!op->pending)
+        {
+            op->busy = 0;
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API starts setting the heater configuration without blocking
+ */
+int8_t bme69x_async_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_async *op)
+{
+    int8_t rslt;
+
+    rslt = async_check(op);
+    if ((rslt == BME69X_OK) && (conf == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        op->busy = 1;
+        op->op_mode = op_mode;
+        op->heatr_conf = conf;
+        op->tries = 0;
+        op->page_step = 0;
+        op->step = BME69X_ASYNC_SLEEP_READ;
+
+        rslt = async_step(op);
+        if (!op->pending)
+        {
+            op->busy = 0;
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API completes the submitted transfer of an asynchronous operation
+ */
+int8_t bme69x_async_complete(struct bme69x_async *op, BME69X_INTF_RET_TYPE intf_rslt)
+{
+    int8_t rslt;
+    struct bme69x_dev *dev;
+
+    if ((op == NULL) || (op->dev == NULL) || (!op->pending))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    dev = op->dev;
+    op->pending = 0;
+
+    if (op->xfer.type == BME69X_XFER_WAIT)
+    {
+        BME69X_STATS_ADD(dev, delay_us, op->xfer.period);
+        rslt = BME69X_OK;
+    }
+    else
+    {
+        if (op->xfer.type == BME69X_XFER_READ)
+        {
+            BME69X_STATS_ADD(dev, n_reads, 1);
+            BME69X_STATS_ADD(dev, bytes_read, op->xfer.len);
+        }
+        else
+        {
+            BME69X_STATS_ADD(dev, n_writes, 1);
+            BME69X_STATS_ADD(dev, bytes_written, op->xfer.len + 1);
+        }
+
+        dev->intf_rslt = intf_rslt;
+        rslt = (intf_rslt == BME69X_INTF_RET_SUCCESS) ? BME69X_OK : BME69X_E_COM_FAIL;
+        if (rslt != BME69X_OK)
+        {
+            BME69X_STATS_ADD(dev, n_bus_errors, 1);
+        }
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = async_xfer_done(op);
+    }
+
+    if ((rslt == BME69X_OK) && (!op->pending))
+    {
+        rslt = async_step(op);
+    }
+
+    /* The callback may start the next operation */
+    if (!op->pending)
+    {
+        op->busy = 0;
+        op->page_step = 0;
+        op->cb(op, rslt, op->arg);
+    }
+
+    return BME69X_OK;
+}
+
+#ifdef BME69X_ENABLE_STATS
+
+/*
+ * @brief This API takes a snapshot of the hot path counters
+ */
+int8_t bme69x_get_stats(struct bme69x_stats *stats, const struct bme69x_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME69X_OK) && (stats != NULL))
+    {
+        *stats = dev->stats;
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+/*****************************INTERNAL APIs***********************************************/
+#ifndef BME69X_USE_FPU
+
+/* @brief This internal API is used to calculate the temperature value. */
+static int16_t calc_temperature(uint32_t temp_adc, const struct bme69x_calib_data *calib, uint32_t *t_lin)
+{
+    int64_t partial_data1;
+    int64_t partial_data2;
+    int64_t partial_data3;
+    int64_t partial_data4;
+    int64_t partial_data5;
+    int64_t partial_data6;
+    int64_t tem_comp;
+
+    partial_data1 = (int64_t)(temp_adc - (256U * calib->par_t1));
+    partial_data2 = (int64_t)(partial_data1 * (int64_t)calib->par_t2);
+    partial_data3 = (int64_t)(partial_data1 * partial_data1);
+    partial_data4 = (int64_t)(partial_data3 * (int64_t)calib->par_t3);
+    partial_data5 = (int64_t)((int64_t)(partial_data2 * 262144UL) + partial_data4);
+    partial_data6 = (int64_t)(partial_data5 / 4294967296ULL);
+    *t_lin = (uint32_t)partial_data6;
+    tem_comp = (int64_t)((partial_data6 * 25U) / 16384UL);
+
+    return (int16_t)(tem_comp);
+}
+
+/* @brief This internal API is used to calculate the pressure value. */
+static uint32_t calc_pressure(uint32_t pres_adc, uint32_t t_lin, const struct bme69x_calib_data *calib)
+{
+    int64_t partial_data1;
+    int64_t partial_data2;
+    int64_t partial_data3;
+    int64_t partial_data4;
+    int64_t partial_data5;
+    int64_t partial_data6;
+    int64_t offset;
+    int64_t sensitivity;
+    int64_t press_comp;
+    int64_t t_lin_64;
+
+    t_lin_64 = (int64_t)t_lin;
+
+    partial_data1 = t_lin_64 * t_lin_64;
+    partial_data2 = partial_data1 / 64;
+    partial_data3 = partial_data2 * t_lin_64 / 256;
+    partial_data4 = calib->par_p4 * partial_data3 / 32;
+    partial_data5 = calib->par_p3 * partial_data1 * 16;
+    partial_data6 = calib->par_p2 * t_lin_64 * (1 << 22);
+
+    offset = calib->derived.p1_off + partial_data4 + partial_data5 + partial_data6;
+    partial_data2 = (calib->par_p8 * partial_data3) / (1 << 5);
+    partial_data4 = calib->par_p7 * partial_data1 * (1 << 2);
+
+    partial_data5 = (calib->par_p6 - 16384) * t_lin_64 * (1 << 21);
+    sensitivity = calib->derived.p5_sens + partial_data2 + partial_data4 + partial_data5;
+    partial_data1 = sensitivity / (1 << 24) * pres_adc;
+
+    partial_data2 = calib->par_p10 * t_lin_64;
+    partial_data3 = partial_data2 + calib->derived.p9_nl;
+    partial_data4 = partial_data3 * pres_adc / (1 << 13);
+    partial_data5 = (pres_adc * partial_data4 / 10) / (1 << 9);
+    partial_data5 = partial_data5 * 10;
+    partial_data6 = pres_adc * pres_adc;
+
+    partial_data2 = calib->par_p11 * partial_data6 / (1 << 16);
+    partial_data3 = partial_data2 * pres_adc / (1 << 7);
+    partial_data4 = offset / 4 + partial_data1 + partial_data5 + partial_data3;
+
+    press_comp = (partial_data4 / ((int64_t)1 << 40)) * 25;
+
+    return (uint32_t)(press_comp / 100);
+}
+
+/* This internal API is used to calculate the humidity in integer */
+static uint32_t calc_humidity(uint16_t hum_adc, int16_t comp_temperature, const struct bme69x_calib_data *calib)
+{
+    uint32_t hum_comp;
+    int64_t hum_64 = hum_adc;
+    int64_t t_comp = comp_temperature;
+    int64_t t_fine = (t_comp * 256 - 128) / 5;
+    int64_t var_H = t_fine - 76800UL;
+
+    var_H =
+        (((((hum_64 * 16384UL) - (calib->par_h1 * 1048576UL) - (calib->par_h2 * var_H)) + 16384UL) / 32768UL) *
+         ((((((var_H * calib->par_h4) / 1024UL) * ((var_H * calib->par_h3) / 2048UL + 32768UL)) / 1024UL) +
+           2097152ULL) * calib->par_h5 + 8192UL) / 16384UL);
+
+    var_H = var_H - (((((var_H / 32768UL) * (var_H / 32768UL)) / 128UL) * calib->par_h6) / 16UL);
+
+    if (var_H < 0)
+    {
+        var_H = 0;
+    }
+
+    if (var_H > 419430400)
+    {
+        var_H = 419430400;
+    }
+
+    hum_comp = (uint32_t)(var_H / 4096UL);
+
+    return hum_comp;
+}
+
+#ifdef BME69X_USE_GAS_LUT
+
+/* (10000 * 262144) / (4096 + 3 * (gas_res_adc - 512)), the gas resistance of gas range 0 divided by 100 */
+static const uint32_t gas_res_lut[BME69X_LEN_GAS_LUT] = {
+    1024000, 1022801, 1021605, 1020412, 1019222, 1018034, 1016850, 1015668, 1014489, 1013312,
+    1012138, 1010967, 1009799, 1008634, 1007471, 1006310, 1005153, 1003998, 1002846, 1001696,
+    1000549, 999405, 998263, 997124, 995987, 994853, 993722, 992593, 991467, 990343,
+    989222, 988104, 986987, 985874, 984763, 983654, 982548, 981445, 980344, 979245,
+    978149, 977055, 975964, 974875, 973789, 972705, 971623, 970544, 969467, 968393,
+    967321, 966251, 965184, 964119, 963056, 961996, 960938, 959882, 958829, 957778,
+    956729, 955683, 954639, 953597, 952558, 951520, 950485, 949453, 948422, 947394,
+    946368, 945344, 944322, 943303, 942286, 941271, 940258, 939247, 938239, 937232,
+    936228, 935226, 934226, 933228, 932233, 931239, 930248, 929259, 928271, 927286,
+    926303, 925322, 924344, 923367, 922392, 921420, 920449, 919480, 918514, 917549,
+    916587, 915626, 914668, 913712, 912757, 911805, 910854, 909906, 908959, 908015,
+    907072, 906132, 905193, 904256, 903321, 902388, 901458, 900529, 899601, 898676,
+    897753, 896832, 895912, 894994, 894079, 893165, 892253, 891343, 890434, 889528,
+    888623, 887720, 886820, 885920, 885023, 884128, 883234, 882342, 881452, 880564,
+    879677, 878793, 877910, 877029, 876149, 875272, 874396, 873522, 872649, 871779,
+    870910, 870043, 869177, 868314, 867452, 866591, 865733, 864876, 864021, 863167,
+    862315, 861465, 860617, 859770, 858925, 858081, 857240, 856399, 855561, 854724,
+    853889, 853055, 852223, 851393, 850564, 849737, 848911, 848087, 847265, 846444,
+    845625, 844808, 843992, 843177, 842365, 841553, 840744, 839935, 839129, 838324,
+    837520, 836718, 835918, 835119, 834322, 833526, 832731, 831939, 831147, 830357,
+    829569, 828782, 827997, 827213, 826431, 825650, 824870, 824093, 823316, 822541,
+    821768, 820995, 820225, 819456, 818688, 817921, 817157, 816393, 815631, 814870,
+    814111, 813354, 812597, 811842, 811089, 810336, 809586, 808836, 808088, 807342,
+    806596, 805853, 805110, 804369, 803629, 802891, 802154, 801418, 800684, 799951,
+    799219, 798489, 797760, 797032, 796306, 795581, 794857, 794135, 793414, 792694,
+    791975, 791258, 790542, 789828, 789114, 788403, 787692, 786982, 786274, 785567,
+    784862, 784157, 783454, 782753, 782052, 781353, 780655, 779958, 779262, 778568,
+    777875, 777183, 776492, 775803, 775115, 774428, 773742, 773058, 772374, 771692,
+    771011, 770332, 769653, 768976, 768300, 767625, 766951, 766278, 765607, 764937,
+    764268, 763600, 762933, 762268, 761603, 760940, 760278, 759617, 758957, 758299,
+    757641, 756985, 756330, 755675, 755023, 754371, 753720, 753070, 752422, 751775,
+    751128, 750483, 749839, 749196, 748555, 747914, 747274, 746636, 745998, 745362,
+    744727, 744093, 743460, 742827, 742197, 741567, 740938, 740310, 739683, 739058,
+    738433, 737810, 737187, 736566, 735946, 735326, 734708, 734091, 733475, 732859,
+    732245, 731632, 731020, 730409, 729799, 729190, 728582, 727975, 727369, 726764,
+    726160, 725557, 724955, 724354, 723754, 723155, 722557, 721960, 721364, 720769,
+    720175, 719582, 718990, 718399, 717809, 717220, 716632, 716044, 715458, 714873,
+    714288, 713705, 713122, 712541, 711960, 711381, 710802, 710224, 709648, 709072,
+    708497, 707923, 707350, 706778, 706206, 705636, 705067, 704498, 703931, 703364,
+    702798, 702234, 701670, 701107, 700545, 699983, 699423, 698864, 698305, 697748,
+    697191, 696635, 696080, 695526, 694973, 694421, 693869, 693319, 692769, 692220,
+    691672, 691125, 690579, 690034, 689489, 688946, 688403, 687861, 687320, 686780,
+    686240, 685702, 685164, 684627, 684091, 683556, 683022, 682488, 681956, 681424,
+    680893, 680363, 679834, 679305, 678777, 678250, 677724, 677199, 676675, 676151,
+    675628, 675106, 674585, 674065, 673545, 673026, 672508, 671991, 671475, 670959,
+    670445, 669930, 669417, 668905, 668393, 667882, 667372, 666863, 666354, 665847,
+    665340, 664833, 664328, 663823, 663319, 662816, 662314, 661812, 661311, 660811,
+    660312, 659813, 659315, 658818, 658322, 657826, 657331, 656837, 656344, 655851,
+    655360, 654868, 654378, 653888, 653399, 652911, 652424, 651937, 651451, 650965,
+    650481, 649997, 649514, 649031, 648550, 648069, 647588, 647109, 646630, 646152,
+    645674, 645198, 644722, 644246, 643772, 643298, 642824, 642352, 641880, 641409,
+    640938, 640469, 640000, 639531, 639063, 638596, 638130, 637664, 637199, 636735,
+    636271, 635808, 635346, 634884, 634424, 633963, 633504, 633045, 632586, 632129,
+    631672, 631215, 630760, 630305, 629851, 629397, 628944, 628491, 628040, 627589,
+    627138, 626688, 626239, 625791, 625343, 624896, 624449, 624003, 623558, 623113,
+    622669, 622226, 621783, 621341, 620900, 620459, 620018, 619579, 619140, 618701,
+    618264, 617827, 617390, 616954, 616519, 616084, 615650, 615217, 614784, 614352,
+    613920, 613489, 613058, 612629, 612199, 611771, 611343, 610915, 610489, 610062,
+    609637, 609212, 608787, 608363, 607940, 607517, 607095, 606674, 606253, 605833,
+    605413, 604994, 604575, 604157, 603740, 603323, 602907, 602491, 602076, 601661,
+    601247, 600834, 600421, 600009, 599597, 599186, 598775, 598365, 597956, 597547,
+    597138, 596731, 596323, 595917, 595511, 595105, 594700, 594296, 593892, 593488,
+    593085, 592683, 592281, 591880, 591480, 591080, 590680, 590281, 589882, 589485,
+    589087, 588690, 588294, 587898, 587503, 587108, 586714, 586320, 585927, 585534,
+    585142, 584751, 584360, 583969, 583579, 583190, 582801, 582412, 582024, 581637,
+    581250, 580864, 580478, 580092, 579708, 579323, 578939, 578556, 578173, 577791,
+    577409, 577028, 576647, 576267, 575887, 575508, 575129, 574751, 574373, 573996,
+    573619, 573242, 572867, 572491, 572116, 571742, 571368, 570995, 570622, 570250,
+    569878, 569506, 569135, 568765, 568395, 568026, 567656, 567288, 566920, 566552,
+    566185, 565819, 565452, 565087, 564722, 564357, 563993, 563629, 563266, 562903,
+    562540, 562178, 561817, 561456, 561095, 560735, 560376, 560017, 559658, 559300,
+    558942, 558585, 558228, 557871, 557515, 557160, 556805, 556450, 556096, 555743,
+    555389, 555037, 554684, 554332, 553981, 553630, 553279, 552929, 552580, 552230,
+    551882, 551533, 551185, 550838, 550491, 550144, 549798, 549452, 549107, 548762,
+    548418, 548074, 547730, 547387, 547045, 546702, 546360, 546019, 545678, 545338,
+    544997, 544658, 544318, 543980, 543641, 543303, 542966, 542628, 542292, 541955,
+    541619, 541284, 540949, 540614, 540280, 539946, 539613, 539279, 538947, 538615,
+    538283, 537951, 537621, 537290, 536960, 536630, 536301, 535972, 535643, 535315,
+    534987, 534660, 534333, 534006, 533680, 533355, 533029, 532704, 532380, 532056,
+    531732, 531408, 531085, 530763, 530441, 530119, 529797, 529476, 529156, 528835,
+    528516, 528196, 527877, 527558, 527240, 526922, 526605, 526287, 525971, 525654,
+    525338, 525023, 524707, 524392, 524078, 523764, 523450, 523137, 522824, 522511,
+    522199, 521887, 521575, 521264, 520953, 520643, 520333, 520023, 519714, 519405,
+    519097, 518788, 518481, 518173, 517866, 517559, 517253, 516947, 516641, 516336,
+    516031, 515726, 515422, 515118, 514815, 514512, 514209, 513907, 513605, 513303,
+    513001, 512700, 512400, 512100, 511800, 511500, 511201, 510902, 510603, 510305,
+    510007, 509710, 509413, 509116, 508819, 508523, 508227, 507932, 507637, 507342,
+    507048, 506754, 506460, 506167, 505874, 505581, 505289, 504997, 504705, 504414,
+    504123, 503832, 503542, 503252, 502962, 502673, 502384, 502095, 501807, 501519,
+    501231, 500944, 500656, 500370, 500083, 499797, 499512, 499226, 498941, 498657,
+    498372, 498088, 497804, 497521, 497238, 496955, 496672, 496390, 496109, 495827,
+    495546, 495265, 494984, 494704, 494424, 494145, 493865, 493586, 493308, 493029,
+    492751, 492474, 492196, 491919, 491642, 491366, 491090, 490814, 490538, 490263,
+    489988, 489714, 489439, 489165, 488892, 488618, 488345, 488072, 487800, 487528,
+    487256, 486984, 486713, 486442, 486172, 485901, 485631, 485361, 485092, 484823,
+    484554, 484285, 484017, 483749, 483482, 483214, 482947, 482680, 482414, 482148,
+    481882, 481616, 481351, 481086, 480821, 480557, 480293, 480029, 479765, 479502,
+    479239, 478976, 478714, 478452, 478190, 477928, 477667, 477406, 477145, 476885,
+    476625, 476365, 476106, 475846, 475587, 475329, 475070, 474812, 474554, 474297,
+    474039, 473782, 473526, 473269, 473013, 472757, 472501, 472246, 471991, 471736,
+    471482, 471227, 470973, 470720, 470466, 470213, 469960, 469707, 469455, 469203,
+    468951, 468700, 468448, 468197, 467947, 467696, 467446, 467196, 466946, 466697,
+    466448, 466199, 465950, 465702
+};
+#endif
+
+/* This internal API is used to calculate the gas resistance */
+static uint32_t calc_gas_resistance(uint16_t gas_res_adc, uint8_t gas_range)
+{
+    uint32_t calc_gas_res;
+
+#ifdef BME69X_USE_GAS_LUT
+
+    /* floor(floor(x) / 2^n) equals floor(x / 2^n), so shifting the table of gas range 0 is exact */
+    calc_gas_res = gas_res_lut[gas_res_adc & BME69X_GAS_ADC_MSK] >> (gas_range & BME69X_GAS_RANGE_MSK);
+    calc_gas_res = calc_gas_res * 100;
+#else
+    uint32_t var1 = UINT32_C(262144) >> gas_range;
+    int32_t var2 = (int32_t)gas_res_adc - INT32_C(512);
+
+    var2 *= INT32_C(3);
+    var2 = INT32_C(4096) + var2;
+
+    /* multiplying 10000 then dividing then multiplying by 100 instead of multiplying by 1000000 to prevent overflow */
+    calc_gas_res = (UINT32_C(10000) * var1) / (uint32_t)var2;
+    calc_gas_res = calc_gas_res * 100;
+#endif
+
+    return calc_gas_res;
+}
+
+/* This internal API is used to calculate the heater resistance value using integer */
+static uint8_t calc_res_heat(uint16_t temp, int32_t amb_term, const struct bme69x_dev *dev)
+{
+    uint8_t heatr_res;
+    int32_t var2;
+    int32_t var3;
+    int32_t var4;
+    int32_t heatr_res_x100;
+
+    if (temp > 400) /* Cap temperature */
+    {
+        temp = 400;
+    }
+
+    var2 = (dev->calib.par_g1 + 784) * (((((dev->calib.par_g2 + 154009UL) * temp * 5) / 100) + 3276800ULL) / 10); /* par_g2,
+                                                                                                                   * par_g3 */
+    var3 = amb_term + (var2 >> 1);
+    var4 = (var3 / (dev->calib.res_heat_range + 4));
+    heatr_res_x100 = (int32_t)(((var4 / dev->calib.derived.rh_var5) - 250) * 34);
+    heatr_res = (uint8_t)((heatr_res_x100 + 50) / 100);
+
+    return heatr_res;
+}
+
+/* This internal API is used to calculate the ambient temperature term of the heater resistance in integer */
+static int32_t calc_res_heat_amb(const struct bme69x_dev *dev)
+{
+    int32_t var1;
+
+    var1 = (((int32_t)dev->amb_temp * dev->calib.par_g3) / 1000U) * 256;
+
+    return var1;
+}
+
+#else
+
+/* @brief This internal API is used to calculate the temperature value. */
+static float calc_temperature(uint32_t temp_adc, const struct bme69x_calib_data *calib)
+{
+    int32_t cf;
+    double temp1, temp2;
+    double calc_temp;
+
+    cf = temp_adc - calib->derived.do1;
+    temp1 = (double)(cf * calib->derived.dtk1);
+    temp2 = (double)cf * (double)cf * calib->derived.dtk2;
+
+    calc_temp = temp1 + temp2;
+
+    return (float)calc_temp;
+}
+
+/* @brief This internal API is used to calculate the pressure value. */
+static float calc_pressure(uint32_t pres_adc, float comp_temperature, const struct bme69x_calib_data *calib)
+{
+    const struct bme69x_calib_derived *d = &calib->derived;
+    double calc_pres, tmp1, tmp2, tmp3, tmp4;
+
+    tmp1 = d->o + (d->tk10 * comp_temperature) + (d->tk20 * comp_temperature * comp_temperature) +
+           (d->tk30 * comp_temperature * comp_temperature * comp_temperature);
+
+    tmp2 = (double)pres_adc *
+           (d->s + (d->tk1s * comp_temperature) + (d->tk2s * comp_temperature * comp_temperature) +
+            (d->tk3s * comp_temperature * comp_temperature * comp_temperature));
+
+    tmp3 = (double)pres_adc * (double)pres_adc * (d->nls + (d->tknls * comp_temperature));
+    tmp4 = (double)pres_adc * (double)pres_adc * (double)pres_adc * d->nls3;
+
+    calc_pres = tmp1 + tmp2 + tmp3 + tmp4;
+
+    return (float)calc_pres;
+}
+
+/* This internal API is used to calculate the humidity in integer */
+static float calc_humidity(uint16_t hum_adc, float comp_temperature, const struct bme69x_calib_data *calib)
+{
+    const struct bme69x_calib_derived *d = &calib->derived;
+    double hoff, hsens;
+    double temp_comp, calc_hum, hum_float_val;
+    int32_t hum_int_val;
+
+    temp_comp = (comp_temperature * 5120) - 76800;
+
+    hoff = (double)hum_adc - (d->oh + d->tk10h * temp_comp);
+    hsens = hoff * d->sh * (1 + (d->tk1sh * temp_comp) + (d->tk12sh * temp_comp * temp_comp));
+    hum_float_val = hsens * (1 - d->hlin2 * hsens);
+
+    /* Avoid direct floating-point comparison by using integer scaling */
+    hum_int_val = (int32_t)(hum_float_val * 1000.0f);
+
+    if (hum_int_val >= 100000)
+    {
+        hum_float_val = 100.0;
+    }
+    else if (hum_int_val < 0)
+    {
+        hum_float_val = 0.0;
+    }
+
+    calc_hum = hum_float_val;
+
+    return (float)calc_hum;
+}
+
+#ifdef BME69X_USE_GAS_LUT
+
+/* 1000000 * 262144 / (4096 + 3 * (gas_res_adc - 512)), the gas resistance of gas range 0 */
+static const float gas_res_lut[BME69X_LEN_GAS_LUT] = {
+    102400000.0f, 102280144.0f, 102160560.0f, 102041264.0f, 101922240.0f, 101803496.0f, 101685024.0f, 101566832.0f,
+    101448920.0f, 101331272.0f, 101213896.0f, 101096800.0f, 100979968.0f, 100863408.0f, 100747120.0f, 100631096.0f,
+    100515336.0f, 100399848.0f, 100284624.0f, 100169656.0f, 100054960.0f, 99940528.0f, 99826352.0f, 99712440.0f,
+    99598784.0f, 99485392.0f, 99372248.0f, 99259368.0f, 99146744.0f, 99034376.0f, 98922264.0f, 98810400.0f,
+    98698792.0f, 98587440.0f, 98476336.0f, 98365480.0f, 98254872.0f, 98144512.0f, 98034408.0f, 97924544.0f,
+    97814928.0f, 97705552.0f, 97596424.0f, 97487544.0f, 97378904.0f, 97270504.0f, 97162344.0f, 97054424.0f,
+    96946744.0f, 96839304.0f, 96732104.0f, 96625136.0f, 96518408.0f, 96411920.0f, 96305656.0f, 96199632.0f,
+    96093840.0f, 95988280.0f, 95882952.0f, 95777856.0f, 95672992.0f, 95568352.0f, 95463944.0f, 95359768.0f,
+    95255816.0f, 95152088.0f, 95048584.0f, 94945312.0f, 94842256.0f, 94739432.0f, 94636824.0f, 94534440.0f,
+    94432280.0f, 94330336.0f, 94228616.0f, 94127112.0f, 94025824.0f, 93924760.0f, 93823912.0f, 93723272.0f,
+    93622856.0f, 93522656.0f, 93422664.0f, 93322888.0f, 93223328.0f, 93123976.0f, 93024840.0f, 92925912.0f,
+    92827192.0f, 92728688.0f, 92630392.0f, 92532296.0f, 92434416.0f, 92336736.0f, 92239272.0f, 92142000.0f,
+    92044944.0f, 91948088.0f, 91851440.0f, 91754984.0f, 91658744.0f, 91562696.0f, 91466856.0f, 91371208.0f,
+    91275768.0f, 91180520.0f, 91085480.0f, 90990632.0f, 90895976.0f, 90801528.0f, 90707264.0f, 90613208.0f,
+    90519336.0f, 90425664.0f, 90332184.0f, 90238896.0f, 90145808.0f, 90052904.0f, 89960192.0f, 89867672.0f,
+    89775344.0f, 89683200.0f, 89591248.0f, 89499488.0f, 89407912.0f, 89316528.0f, 89225320.0f, 89134312.0f,
+    89043480.0f, 88952832.0f, 88862376.0f, 88772096.0f, 88682000.0f, 88592088.0f, 88502360.0f, 88412816.0f,
+    88323448.0f, 88234264.0f, 88145256.0f, 88056432.0f, 87967784.0f, 87879320.0f, 87791024.0f, 87702912.0f,
+    87614976.0f, 87527216.0f, 87439624.0f, 87352216.0f, 87264984.0f, 87177920.0f, 87091032.0f, 87004312.0f,
+    86917768.0f, 86831400.0f, 86745200.0f, 86659176.0f, 86573312.0f, 86487624.0f, 86402112.0f, 86316760.0f,
+    86231576.0f, 86146568.0f, 86061720.0f, 85977040.0f, 85892528.0f, 85808184.0f, 85724000.0f, 85639984.0f,
+    85556136.0f, 85472448.0f, 85388928.0f, 85305568.0f, 85222368.0f, 85139328.0f, 85056456.0f, 84973744.0f,
+    84891192.0f, 84808800.0f, 84726568.0f, 84644496.0f, 84562584.0f, 84480824.0f, 84399224.0f, 84317784.0f,
+    84236504.0f, 84155376.0f, 84074408.0f, 83993592.0f, 83912936.0f, 83832424.0f, 83752080.0f, 83671880.0f,
+    83591840.0f, 83511944.0f, 83432208.0f, 83352624.0f, 83273192.0f, 83193904.0f, 83114776.0f, 83035792.0f,
+    82956960.0f, 82878280.0f, 82799744.0f, 82721360.0f, 82643128.0f, 82565040.0f, 82487096.0f, 82409304.0f,
+    82331656.0f, 82254160.0f, 82176800.0f, 82099592.0f, 82022528.0f, 81945608.0f, 81868832.0f, 81792200.0f,
+    81715712.0f, 81639368.0f, 81563160.0f, 81487096.0f, 81411184.0f, 81335400.0f, 81259768.0f, 81184264.0f,
+    81108912.0f, 81033696.0f, 80958616.0f, 80883680.0f, 80808880.0f, 80734216.0f, 80659696.0f, 80585304.0f,
+    80511056.0f, 80436944.0f, 80362968.0f, 80289128.0f, 80215424.0f, 80141856.0f, 80068416.0f, 79995120.0f,
+    79921952.0f, 79848920.0f, 79776016.0f, 79703256.0f, 79630616.0f, 79558120.0f, 79485752.0f, 79413512.0f,
+    79341408.0f, 79269432.0f, 79197584.0f, 79125864.0f, 79054280.0f, 78982824.0f, 78911496.0f, 78840304.0f,
+    78769232.0f, 78698288.0f, 78627472.0f, 78556784.0f, 78486224.0f, 78415792.0f, 78345488.0f, 78275304.0f,
+    78205248.0f, 78135320.0f, 78065512.0f, 77995832.0f, 77926280.0f, 77856848.0f, 77787536.0f, 77718352.0f,
+    77649288.0f, 77580352.0f, 77511528.0f, 77442840.0f, 77374264.0f, 77305808.0f, 77237480.0f, 77169264.0f,
+    77101176.0f, 77033208.0f, 76965352.0f, 76897624.0f, 76830008.0f, 76762520.0f, 76695144.0f, 76627888.0f,
+    76560744.0f, 76493728.0f, 76426824.0f, 76360032.0f, 76293368.0f, 76226808.0f, 76160368.0f, 76094048.0f,
+    76027840.0f, 75961752.0f, 75895776.0f, 75829912.0f, 75764160.0f, 75698528.0f, 75633008.0f, 75567600.0f,
+    75502304.0f, 75437120.0f, 75372056.0f, 75307096.0f, 75242248.0f, 75177520.0f, 75112896.0f, 75048384.0f,
+    74983984.0f, 74919688.0f, 74855512.0f, 74791440.0f, 74727480.0f, 74663632.0f, 74599888.0f, 74536256.0f,
+    74472728.0f, 74409312.0f, 74346000.0f, 74282800.0f, 74219704.0f, 74156720.0f, 74093840.0f, 74031064.0f,
+    73968400.0f, 73905832.0f, 73843384.0f, 73781032.0f, 73718784.0f, 73656648.0f, 73594608.0f, 73532680.0f,
+    73470856.0f, 73409128.0f, 73347512.0f, 73285992.0f, 73224584.0f, 73163272.0f, 73102064.0f, 73040960.0f,
+    72979952.0f, 72919056.0f, 72858256.0f, 72797560.0f, 72736960.0f, 72676464.0f, 72616064.0f, 72555768.0f,
+    72495576.0f, 72435480.0f, 72375480.0f, 72315584.0f, 72255792.0f, 72196088.0f, 72136488.0f, 72076984.0f,
+    72017584.0f, 71958280.0f, 71899064.0f, 71839960.0f, 71780944.0f, 71722024.0f, 71663200.0f, 71604480.0f,
+    71545848.0f, 71487320.0f, 71428880.0f, 71370544.0f, 71312296.0f, 71254144.0f, 71196088.0f, 71138128.0f,
+    71080264.0f, 71022488.0f, 70964808.0f, 70907224.0f, 70849728.0f, 70792328.0f, 70735024.0f, 70677808.0f,
+    70620688.0f, 70563664.0f, 70506728.0f, 70449880.0f, 70393128.0f, 70336464.0f, 70279896.0f, 70223416.0f,
+    70167024.0f, 70110728.0f, 70054520.0f, 69998400.0f, 69942368.0f, 69886432.0f, 69830584.0f, 69774824.0f,
+    69719152.0f, 69663568.0f, 69608072.0f, 69552664.0f, 69497352.0f, 69442120.0f, 69386976.0f, 69331920.0f,
+    69276952.0f, 69222072.0f, 69167280.0f, 69112576.0f, 69057952.0f, 69003424.0f, 68948976.0f, 68894616.0f,
+    68840336.0f, 68786144.0f, 68732040.0f, 68678016.0f, 68624080.0f, 68570232.0f, 68516464.0f, 68462784.0f,
+    68409184.0f, 68355672.0f, 68302240.0f, 68248896.0f, 68195632.0f, 68142448.0f, 68089352.0f, 68036336.0f,
+    67983400.0f, 67930552.0f, 67877784.0f, 67825096.0f, 67772496.0f, 67719968.0f, 67667528.0f, 67615168.0f,
+    67562888.0f, 67510688.0f, 67458568.0f, 67406528.0f, 67354576.0f, 67302696.0f, 67250896.0f, 67199176.0f,
+    67147544.0f, 67095980.0f, 67044500.0f, 66993100.0f, 66941776.0f, 66890532.0f, 66839368.0f, 66788280.0f,
+    66737272.0f, 66686340.0f, 66635484.0f, 66584708.0f, 66534012.0f, 66483388.0f, 66432844.0f, 66382376.0f,
+    66331984.0f, 66281668.0f, 66231432.0f, 66181268.0f, 66131180.0f, 66081168.0f, 66031236.0f, 65981376.0f,
+    65931588.0f, 65881880.0f, 65832244.0f, 65782684.0f, 65733200.0f, 65683788.0f, 65634452.0f, 65585188.0f,
+    65536000.0f, 65486884.0f, 65437844.0f, 65388876.0f, 65339980.0f, 65291160.0f, 65242408.0f, 65193732.0f,
+    65145128.0f, 65096596.0f, 65048140.0f, 64999752.0f, 64951436.0f, 64903192.0f, 64855024.0f, 64806924.0f,
+    64758892.0f, 64710936.0f, 64663048.0f, 64615232.0f, 64567488.0f, 64519812.0f, 64472208.0f, 64424676.0f,
+    64377212.0f, 64329816.0f, 64282492.0f, 64235236.0f, 64188052.0f, 64140936.0f, 64093888.0f, 64046908.0f,
+    64000000.0f, 63953160.0f, 63906388.0f, 63859684.0f, 63813048.0f, 63766480.0f, 63719980.0f, 63673548.0f,
+    63627184.0f, 63580888.0f, 63534660.0f, 63488496.0f, 63442400.0f, 63396372.0f, 63350412.0f, 63304516.0f,
+    63258688.0f, 63212924.0f, 63167228.0f, 63121600.0f, 63076036.0f, 63030536.0f, 62985104.0f, 62939736.0f,
+    62894432.0f, 62849196.0f, 62804024.0f, 62758916.0f, 62713876.0f, 62668896.0f, 62623984.0f, 62579136.0f,
+    62534352.0f, 62489632.0f, 62444972.0f, 62400380.0f, 62355852.0f, 62311384.0f, 62266984.0f, 62222644.0f,
+    62178368.0f, 62134156.0f, 62090004.0f, 62045916.0f, 62001892.0f, 61957928.0f, 61914028.0f, 61870192.0f,
+    61826416.0f, 61782700.0f, 61739048.0f, 61695456.0f, 61651928.0f, 61608460.0f, 61565056.0f, 61521708.0f,
+    61478424.0f, 61435200.0f, 61392036.0f, 61348936.0f, 61305892.0f, 61262912.0f, 61219992.0f, 61177128.0f,
+    61134328.0f, 61091588.0f, 61048904.0f, 61006284.0f, 60963720.0f, 60921216.0f, 60878772.0f, 60836388.0f,
+    60794064.0f, 60751796.0f, 60709588.0f, 60667440.0f, 60625348.0f, 60583316.0f, 60541340.0f, 60499424.0f,
+    60457564.0f, 60415764.0f, 60374020.0f, 60332336.0f, 60290708.0f, 60249140.0f, 60207624.0f, 60166168.0f,
+    60124772.0f, 60083428.0f, 60042144.0f, 60000916.0f, 59959744.0f, 59918628.0f, 59877568.0f, 59836568.0f,
+    59795620.0f, 59754728.0f, 59713896.0f, 59673116.0f, 59632392.0f, 59591724.0f, 59551112.0f, 59510556.0f,
+    59470056.0f, 59429608.0f, 59389216.0f, 59348880.0f, 59308596.0f, 59268368.0f, 59228196.0f, 59188080.0f,
+    59148016.0f, 59108004.0f, 59068048.0f, 59028148.0f, 58988300.0f, 58948504.0f, 58908764.0f, 58869076.0f,
+    58829444.0f, 58789864.0f, 58750336.0f, 58710864.0f, 58671440.0f, 58632072.0f, 58592760.0f, 58553496.0f,
+    58514284.0f, 58475128.0f, 58436024.0f, 58396972.0f, 58357968.0f, 58319020.0f, 58280124.0f, 58241280.0f,
+    58202488.0f, 58163744.0f, 58125056.0f, 58086416.0f, 58047828.0f, 58009296.0f, 57970808.0f, 57932376.0f,
+    57893992.0f, 57855660.0f, 57817380.0f, 57779148.0f, 57740968.0f, 57702840.0f, 57664760.0f, 57626732.0f,
+    57588752.0f, 57550824.0f, 57512944.0f, 57475116.0f, 57437336.0f, 57399604.0f, 57361924.0f, 57324296.0f,
+    57286712.0f, 57249180.0f, 57211696.0f, 57174264.0f, 57136880.0f, 57099544.0f, 57062256.0f, 57025016.0f,
+    56987828.0f, 56950684.0f, 56913592.0f, 56876544.0f, 56839548.0f, 56802600.0f, 56765700.0f, 56728848.0f,
+    56692040.0f, 56655284.0f, 56618576.0f, 56581912.0f, 56545296.0f, 56508732.0f, 56472212.0f, 56435736.0f,
+    56399312.0f, 56362932.0f, 56326600.0f, 56290316.0f, 56254076.0f, 56217884.0f, 56181740.0f, 56145640.0f,
+    56109588.0f, 56073584.0f, 56037624.0f, 56001708.0f, 55965840.0f, 55930020.0f, 55894244.0f, 55858512.0f,
+    55822828.0f, 55787188.0f, 55751596.0f, 55716048.0f, 55680544.0f, 55645084.0f, 55609672.0f, 55574304.0f,
+    55538984.0f, 55503704.0f, 55468472.0f, 55433284.0f, 55398140.0f, 55363040.0f, 55327988.0f, 55292976.0f,
+    55258012.0f, 55223088.0f, 55188212.0f, 55153376.0f, 55118588.0f, 55083840.0f, 55049140.0f, 55014480.0f,
+    54979864.0f, 54945296.0f, 54910768.0f, 54876284.0f, 54841840.0f, 54807444.0f, 54773088.0f, 54738776.0f,
+    54704508.0f, 54670280.0f, 54636100.0f, 54601956.0f, 54567860.0f, 54533804.0f, 54499792.0f, 54465820.0f,
+    54431892.0f, 54398008.0f, 54364164.0f, 54330364.0f, 54296604.0f, 54262884.0f, 54229208.0f, 54195576.0f,
+    54161984.0f, 54128432.0f, 54094924.0f, 54061456.0f, 54028028.0f, 53994644.0f, 53961300.0f, 53928000.0f,
+    53894736.0f, 53861516.0f, 53828336.0f, 53795200.0f, 53762100.0f, 53729044.0f, 53696028.0f, 53663052.0f,
+    53630116.0f, 53597220.0f, 53564364.0f, 53531548.0f, 53498776.0f, 53466040.0f, 53433348.0f, 53400692.0f,
+    53368080.0f, 53335504.0f, 53302968.0f, 53270472.0f, 53238016.0f, 53205600.0f, 53173224.0f, 53140888.0f,
+    53108588.0f, 53076332.0f, 53044112.0f, 53011932.0f, 52979788.0f, 52947688.0f, 52915624.0f, 52883600.0f,
+    52851612.0f, 52819664.0f, 52787756.0f, 52755888.0f, 52724056.0f, 52692260.0f, 52660508.0f, 52628788.0f,
+    52597112.0f, 52565472.0f, 52533868.0f, 52502304.0f, 52470776.0f, 52439288.0f, 52407836.0f, 52376424.0f,
+    52345048.0f, 52313708.0f, 52282408.0f, 52251148.0f, 52219920.0f, 52188732.0f, 52157580.0f, 52126468.0f,
+    52095388.0f, 52064348.0f, 52033348.0f, 52002380.0f, 51971452.0f, 51940560.0f, 51909704.0f, 51878884.0f,
+    51848100.0f, 51817356.0f, 51786644.0f, 51755972.0f, 51725336.0f, 51694736.0f, 51664172.0f, 51633640.0f,
+    51603148.0f, 51572692.0f, 51542272.0f, 51511888.0f, 51481540.0f, 51451228.0f, 51420948.0f, 51390708.0f,
+    51360500.0f, 51330332.0f, 51300196.0f, 51270096.0f, 51240032.0f, 51210000.0f, 51180008.0f, 51150048.0f,
+    51120124.0f, 51090236.0f, 51060380.0f, 51030564.0f, 51000780.0f, 50971028.0f, 50941312.0f, 50911632.0f,
+    50881988.0f, 50852376.0f, 50822800.0f, 50793256.0f, 50763748.0f, 50734276.0f, 50704836.0f, 50675432.0f,
+    50646060.0f, 50616720.0f, 50587416.0f, 50558148.0f, 50528912.0f, 50499712.0f, 50470544.0f, 50441408.0f,
+    50412308.0f, 50383240.0f, 50354208.0f, 50325208.0f, 50296240.0f, 50267304.0f, 50238404.0f, 50209540.0f,
+    50180704.0f, 50151904.0f, 50123136.0f, 50094400.0f, 50065700.0f, 50037028.0f, 50008392.0f, 49979792.0f,
+    49951220.0f, 49922680.0f, 49894176.0f, 49865704.0f, 49837264.0f, 49808856.0f, 49780480.0f, 49752136.0f,
+    49723824.0f, 49695544.0f, 49667300.0f, 49639084.0f, 49610900.0f, 49582752.0f, 49554632.0f, 49526544.0f,
+    49498488.0f, 49470468.0f, 49442476.0f, 49414516.0f, 49386588.0f, 49358688.0f, 49330824.0f, 49302992.0f,
+    49275188.0f, 49247416.0f, 49219676.0f, 49191968.0f, 49164292.0f, 49136644.0f, 49109028.0f, 49081444.0f,
+    49053892.0f, 49026368.0f, 48998880.0f, 48971416.0f, 48943988.0f, 48916588.0f, 48889220.0f, 48861884.0f,
+    48834576.0f, 48807300.0f, 48780052.0f, 48752836.0f, 48725652.0f, 48698496.0f, 48671372.0f, 48644276.0f,
+    48617212.0f, 48590176.0f, 48563172.0f, 48536196.0f, 48509252.0f, 48482336.0f, 48455452.0f, 48428596.0f,
+    48401772.0f, 48374976.0f, 48348212.0f, 48321476.0f, 48294768.0f, 48268092.0f, 48241444.0f, 48214824.0f,
+    48188236.0f, 48161676.0f, 48135144.0f, 48108644.0f, 48082172.0f, 48055728.0f, 48029316.0f, 48002928.0f,
+    47976572.0f, 47950248.0f, 47923948.0f, 47897680.0f, 47871440.0f, 47845228.0f, 47819044.0f, 47792888.0f,
+    47766764.0f, 47740668.0f, 47714596.0f, 47688556.0f, 47662544.0f, 47636560.0f, 47610608.0f, 47584680.0f,
+    47558780.0f, 47532912.0f, 47507068.0f, 47481252.0f, 47455468.0f, 47429708.0f, 47403980.0f, 47378276.0f,
+    47352600.0f, 47326956.0f, 47301336.0f, 47275744.0f, 47250180.0f, 47224644.0f, 47199136.0f, 47173656.0f,
+    47148200.0f, 47122776.0f, 47097376.0f, 47072004.0f, 47046660.0f, 47021344.0f, 46996056.0f, 46970792.0f,
+    46945560.0f, 46920352.0f, 46895168.0f, 46870016.0f, 46844888.0f, 46819788.0f, 46794716.0f, 46769668.0f,
+    46744652.0f, 46719656.0f, 46694692.0f, 46669752.0f, 46644840.0f, 46619952.0f, 46595096.0f, 46570260.0f
+};
+
+/* 2^-gas_range, scaling by a power of two keeps the rounding of the division */
+static const float gas_range_scale[16] = {
+    1.0f, 0.5f, 0.25f, 0.125f, 0.0625f, 0.03125f, 0.015625f, 0.0078125f, 0.00390625f, 0.001953125f,
+    0.0009765625f, 0.00048828125f, 0.000244140625f, 0.0001220703125f, 0.00006103515625f, 0.000030517578125f
+};
+#endif
+
+/* This internal API is used to calculate the gas resistance value for BME69x variant in float */
+static float calc_gas_resistance(uint16_t gas_res_adc, uint8_t gas_range)
+{
+    float calc_gas_res;
+
+#ifdef BME69X_USE_GAS_LUT
+    calc_gas_res = gas_res_lut[gas_res_adc & BME69X_GAS_ADC_MSK] * gas_range_scale[gas_range & BME69X_GAS_RANGE_MSK];
+#else
+    uint32_t var1 = UINT32_C(262144) >> gas_range;
+    int32_t var2 = (int32_t)gas_res_adc - INT32_C(512);
+
+    var2 *= INT32_C(3);
+    var2 = INT32_C(4096) + var2;
+
+    calc_gas_res = 1000000.0f * (float)var1 / (float)var2;
+#endif
+
+    return calc_gas_res;
+}
+
+/* This internal API is used to calculate the heater resistance value using float */
+static uint8_t calc_res_heat(uint16_t temp, float amb_term, const struct bme69x_dev *dev)
+{
+    const struct bme69x_calib_derived *d = &dev->calib.derived;
+    float var4;
+    float var5;
+    uint8_t res_heat;
+
+    if (temp > 400) /* Cap temperature */
+    {
+        temp = 400;
+    }
+
+    var4 = (d->rh_var1 * (1.0f + (d->rh_var2 * (float)temp)));
+    var5 = (var4 + amb_term);
+    res_heat = (uint8_t)(3.4f * ((var5 * d->rh_range * d->rh_val) - 25));
+
+    return res_heat;
+}
+
+/* This internal API is used to calculate the ambient temperature term of the heater resistance in float */
+static float calc_res_heat_amb(const struct bme69x_dev *dev)
+{
+    return dev->calib.derived.rh_var3 * (float)dev->amb_temp;
+}
+
+#endif
+
+/* This internal API is used to compensate the raw data of one field */
+static void compensate_data(const struct bme69x_calib_data *calib,
+                            uint32_t temp_adc,
+                            uint32_t pres_adc,
+                            uint16_t hum_adc,
+                            uint16_t gas_res_adc,
+                            uint8_t gas_range,
+                            struct bme69x_data *data)
+{
+#ifndef BME69X_USE_FPU
+
+    /*
+     * Fixed point calculation needs t_lin for pressure calculation
+     * t_lin is calculated during temperature calculation
+     */
+    data->temperature = calc_temperature(temp_adc, calib, &data->t_lin);
+    data->pressure = calc_pressure(pres_adc, data->t_lin, calib);
+#else
+    data->temperature = calc_temperature(temp_adc, calib);
+    data->pressure = calc_pressure(pres_adc, data->temperature, calib);
+#endif
+    data->humidity = calc_humidity(hum_adc, data->temperature, calib);
+    data->gas_resistance = calc_gas_resistance(gas_res_adc, gas_range);
+}
+
+/*
+ * The kernels below evaluate calc_temperature and calc_pressure with the same
+ * operations in the same order, without contraction into fused multiply-add,
+ * so that every lane is bit-identical to the scalar code.
+ */
+#ifdef BME69X_SIMD_X86
+
+/* This internal API is used to compensate temperature and pressure two samples at a time using SSE2 */
+static uint32_t simd_comp_sse2(const struct bme69x_calib_derived *c,
+                               const struct bme69x_raw_batch *raw,
+                               struct bme69x_data *data,
+                               uint32_t n)
+{
+    uint32_t i;
+    __m128i adc;
+    __m128d cf, ct, pa, pa2, t1, t2, t3, t4;
+    float temp[4], pres[4];
+
+    for (i = 0; (i + 2) <= n; i += 2)
+    {
+        /* Temperature, cf = temp_adc - do1 wraps as in the scalar code */
+        adc = _mm_loadl_epi64((const __m128i *)&raw->temp_adc[i]);
+        cf = _mm_cvtepi32_pd(_mm_sub_epi32(adc, _mm_set1_epi32(c->do1)));
+        t1 = _mm_mul_pd(cf, _mm_set1_pd(c->dtk1));
+        t2 = _mm_mul_pd(_mm_mul_pd(cf, cf), _mm_set1_pd(c->dtk2));
+        _mm_storeu_ps(temp, _mm_cvtpd_ps(_mm_add_pd(t1, t2)));
+
+        /* The pressure uses the temperature rounded to float */
+        ct = _mm_cvtps_pd(_mm_loadu_ps(temp));
+
+        /* Unsigned conversion of pres_adc */
+        adc = _mm_loadl_epi64((const __m128i *)&raw->pres_adc[i]);
+        pa = _mm_cvtepi32_pd(adc);
+        pa = _mm_add_pd(pa, _mm_and_pd(_mm_cmplt_pd(pa, _mm_setzero_pd()), _mm_set1_pd(4294967296.0)));
+        pa2 = _mm_mul_pd(pa, pa);
+
+        t1 = _mm_add_pd(_mm_set1_pd(c->o), _mm_mul_pd(_mm_set1_pd(c->tk10), ct));
+        t1 = _mm_add_pd(t1, _mm_mul_pd(_mm_mul_pd(_mm_set1_pd(c->tk20), ct), ct));
+        t1 = _mm_add_pd(t1, _mm_mul_pd(_mm_mul_pd(_mm_mul_pd(_mm_set1_pd(c->tk30), ct), ct), ct));
+
+        t2 = _mm_add_pd(_mm_set1_pd(c->s), _mm_mul_pd(_mm_set1_pd(c->tk1s), ct));
+        t2 = _mm_add_pd(t2, _mm_mul_pd(_mm_mul_pd(_mm_set1_pd(c->tk2s), ct), ct));
+        t2 = _mm_add_pd(t2, _mm_mul_pd(_mm_mul_pd(_mm_mul_pd(_mm_set1_pd(c->tk3s), ct), ct), ct));
+        t2 = _mm_mul_pd(pa, t2);
+
+        t3 = _mm_mul_pd(pa2, _mm_add_pd(_mm_set1_pd(c->nls), _mm_mul_pd(_mm_set1_pd(c->tknls), ct)));
+        t4 = _mm_mul_pd(_mm_mul_pd(pa2, pa), _mm_set1_pd(c->nls3));
+
+        _mm_storeu_ps(pres, _mm_cvtpd_ps(_mm_add_pd(_mm_add_pd(_mm_add_pd(t1, t2), t3), t4)));
+
+        data[i].temperature = temp[0];
+        data[i + 1].temperature = temp[1];
+        data[i].pressure = pres[0];
+        data[i + 1].pressure = pres[1];
+    }
+
+    return i;
+}
+
+/* This internal API is used to compensate temperature and pressure four samples at a time using AVX2 */
+__attribute__((target("avx2")))
+static uint32_t simd_comp_avx2(const struct bme69x_calib_derived *c,
+                               const struct bme69x_raw_batch *raw,
+                               struct bme69x_data *data,
+                               uint32_t n)
+{
+    uint32_t i;
+    uint8_t k;
+    __m128i adc;
+    __m128 temp_ps;
+    __m256d cf, ct, pa, pa2, t1, t2, t3, t4;
+    float temp[4], pres[4];
+
+    for (i = 0; (i + 4) <= n; i += 4)
+    {
+        /* Temperature, cf = temp_adc - do1 wraps as in the scalar code */
+        adc = _mm_loadu_si128((const __m128i *)&raw->temp_adc[i]);
+        cf = _mm256_cvtepi32_pd(_mm_sub_epi32(adc, _mm_set1_epi32(c->do1)));
+        t1 = _mm256_mul_pd(cf, _mm256_set1_pd(c->dtk1));
+        t2 = _mm256_mul_pd(_mm256_mul_pd(cf, cf), _mm256_set1_pd(c->dtk2));
+        temp_ps = _mm256_cvtpd_ps(_mm256_add_pd(t1, t2));
+        _mm_storeu_ps(temp, temp_ps);
+
+        /* The pressure uses the temperature rounded to float */
+        ct = _mm256_cvtps_pd(temp_ps);
+
+        /* Unsigned conversion of pres_adc */
+        adc = _mm_loadu_si128((const __m128i *)&raw->pres_adc[i]);
+        pa = _mm256_cvtepi32_pd(adc);
+        pa = _mm256_add_pd(pa,
+                           _mm256_and_pd(_mm256_cmp_pd(pa, _mm256_setzero_pd(), _CMP_LT_OQ),
+                                         _mm256_set1_pd(4294967296.0)));
+        pa2 = _mm256_mul_pd(pa, pa);
+
+        t1 = _mm256_add_pd(_mm256_set1_pd(c->o), _mm256_mul_pd(_mm256_set1_pd(c->tk10), ct));
+        t1 = _mm256_add_pd(t1, _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(c->tk20), ct), ct));
+        t1 = _mm256_add_pd(t1, _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(c->tk30), ct), ct), ct));
+
+        t2 = _mm256_add_pd(_mm256_set1_pd(c->s), _mm256_mul_pd(_mm256_set1_pd(c->tk1s), ct));
+        t2 = _mm256_add_pd(t2, _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(c->tk2s), ct), ct));
+        t2 = _mm256_add_pd(t2, _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(c->tk3s), ct), ct), ct));
+        t2 = _mm256_mul_pd(pa, t2);
+
+        t3 = _mm256_mul_pd(pa2, _mm256_add_pd(_mm256_set1_pd(c->nls), _mm256_mul_pd(_mm256_set1_pd(c->tknls), ct)));
+        t4 = _mm256_mul_pd(_mm256_mul_pd(pa2, pa), _mm256_set1_pd(c->nls3));
+
+        _mm_storeu_ps(pres, _mm256_cvtpd_ps(_mm256_add_pd(_mm256_add_pd(_mm256_add_pd(t1, t2), t3), t4)));
+
+        for (k = 0; k < 4; k++)
+        {
+            data[i + k].temperature = temp[k];
+            data[i + k].pressure = pres[k];
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+#ifdef BME69X_SIMD_NEON
+
+/* This internal API is used to compensate temperature and pressure two samples at a time using NEON */
+static uint32_t simd_comp_neon(const struct bme69x_calib_derived *c,
+                               const struct bme69x_raw_batch *raw,
+                               struct bme69x_data *data,
+                               uint32_t n)
+{
+    uint32_t i;
+    float32x2_t temp_ps, pres_ps;
+    float64x2_t cf, ct, pa, pa2, t1, t2, t3, t4;
+
+    for (i = 0; (i + 2) <= n; i += 2)
+    {
+        /* Temperature, cf = temp_adc - do1 wraps as in the scalar code */
+        cf = vcvtq_f64_s64(vmovl_s32(vsub_s32(vreinterpret_s32_u32(vld1_u32(&raw->temp_adc[i])), vdup_n_s32(c->do1))));
+        t1 = vmulq_f64(cf, vdupq_n_f64(c->dtk1));
+        t2 = vmulq_f64(vmulq_f64(cf, cf), vdupq_n_f64(c->dtk2));
+        temp_ps = vcvt_f32_f64(vaddq_f64(t1, t2));
+
+        /* The pressure uses the temperature rounded to float */
+        ct = vcvt_f64_f32(temp_ps);
+
+        pa = vcvtq_f64_u64(vmovl_u32(vld1_u32(&raw->pres_adc[i])));
+        pa2 = vmulq_f64(pa, pa);
+
+        t1 = vaddq_f64(vdupq_n_f64(c->o), vmulq_f64(vdupq_n_f64(c->tk10), ct));
+        t1 = vaddq_f64(t1, vmulq_f64(vmulq_f64(vdupq_n_f64(c->tk20), ct), ct));
+        t1 = vaddq_f64(t1, vmulq_f64(vmulq_f64(vmulq_f64(vdupq_n_f64(c->tk30), ct), ct), ct));
+
+        t2 = vaddq_f64(vdupq_n_f64(c->s), vmulq_f64(vdupq_n_f64(c->tk1s), ct));
+        t2 = vaddq_f64(t2, vmulq_f64(vmulq_f64(vdupq_n_f64(c->tk2s), ct), ct));
+        t2 = vaddq_f64(t2, vmulq_f64(vmulq_f64(vmulq_f64(vdupq_n_f64(c->tk3s), ct), ct), ct));
+        t2 = vmulq_f64(pa, t2);
+
+        t3 = vmulq_f64(pa2, vaddq_f64(vdupq_n_f64(c->nls), vmulq_f64(vdupq_n_f64(c->tknls), ct)));
+        t4 = vmulq_f64(vmulq_f64(pa2, pa), vdupq_n_f64(c->nls3));
+
+        pres_ps = vcvt_f32_f64(vaddq_f64(vaddq_f64(vaddq_f64(t1, t2), t3), t4));
+
+        data[i].temperature = vget_lane_f32(temp_ps, 0);
+        data[i + 1].temperature = vget_lane_f32(temp_ps, 1);
+        data[i].pressure = vget_lane_f32(pres_ps, 0);
+        data[i + 1].pressure = vget_lane_f32(pres_ps, 1);
+    }
+
+    return i;
+}
+
+#endif
+
+/* This internal API is used to calculate the gas wait */
+static uint8_t calc_gas_wait(uint16_t dur)
+{
+    uint8_t factor = 0;
+    uint8_t durval;
+
+    if (dur >= 0xfc0)
+    {
+        durval = 0xff; /* Max duration*/
+    }
+    else
+    {
+        while (dur > 0x3F)
+        {
+            dur = dur / 4;
+            factor += 1;
+        }
+
+        durval = (uint8_t)(dur + (factor * 64));
+    }
+
+    return durval;
+}
+
+/* This internal API is used to read a single data of the sensor */
+static int8_t read_field_data(uint8_t index, struct bme69x_data *data, struct bme69x_dev *dev)
+{
+    int8_t rslt = BME69X_OK;
+    uint8_t buff[BME69X_LEN_FIELD] = { 0 };
+    struct bme69x_raw_field raw;
+    uint8_t tries = 5;
+
+    while ((tries) && (rslt == BME69X_OK))
+    {
+        rslt = bme69x_get_regs(((uint8_t)(BME69X_REG_FIELD0 + (index * BME69X_LEN_FIELD_OFFSET))),
+                               buff,
+                               (uint16_t)BME69X_LEN_FIELD,
+                               dev);
+        if (!data)
+        {
+            rslt = BME69X_E_NULL_PTR;
+            break;
+        }
+
+        (void)bme69x_parse_field(buff, &raw);
+        raw.timestamp = BME69X_INTF_TIME_NS(dev);
+        data->status = raw.status;
+        data->gas_index = raw.gas_index;
+        data->meas_index = raw.meas_index;
+
+        if ((data->status & BME69X_NEW_DATA_MSK) && (rslt == BME69X_OK))
+        {
+            /* The heater values are served from the shadow register cache once known */
+            rslt = get_regs_cached(BME69X_REG_RES_HEAT0 + raw.gas_index, &raw.res_heat, 1, dev);
+            if (rslt == BME69X_OK)
+            {
+                rslt = get_regs_cached(BME69X_REG_IDAC_HEAT0 + raw.gas_index, &raw.idac, 1, dev);
+            }
+
+            if (rslt == BME69X_OK)
+            {
+                rslt = get_regs_cached(BME69X_REG_GAS_WAIT0 + raw.gas_index, &raw.gas_wait, 1, dev);
+            }
+
+            if (rslt == BME69X_OK)
+            {
+                (void)bme69x_compensate(&dev->calib, &raw, data);
+
+                break;
+            }
+        }
+
+        if (rslt == BME69X_OK)
+        {
+            BME69X_INTF_DELAY_US(dev, BME69X_PERIOD_POLL);
+            BME69X_STATS_ADD(dev, delay_us, BME69X_PERIOD_POLL);
+            BME69X_STATS_ADD(dev, n_retries, 1);
+        }
+
+        tries--;
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to read all data fields of the sensor */
+static int8_t read_all_field_data(struct bme69x_data *data, uint8_t *n_new, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    struct bme69x_raw_field raw[3];
+    uint8_t order[3];
+    uint8_t n_out;
+    uint8_t i;
+
+    rslt = read_fields(0, 3, raw, dev);
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = set_field_heatr(raw, 3, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        *n_new = order_fields(raw, 3, order);
+
+        /* Only the raw fields are ordered, each one is compensated in place in the output */
+        n_out = (dev->features & BME69X_FEAT_NEW_FIELDS_ONLY) ? *n_new : 3;
+        for (i = 0; i < n_out; i++)
+        {
+            (void)bme69x_compensate(&dev->calib, &raw[order[i]], &data[i]);
+        }
+    }
+
+    return rslt;
+}
+
+/* This internal API reads consecutive fields, in at most two bursts */
+static int8_t read_fields(uint8_t first, uint8_t count, struct bme69x_raw_field *raw, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t buff[BME69X_LEN_FIELD * 3] = { 0 };
+    uint64_t stamp[2] = { 0, 0 };
+    uint8_t n_head;
+    uint8_t i;
+
+    /* Fields from the first one up to the last field, then from the first field on */
+    n_head = (uint8_t)(3 - first);
+    if (n_head > count)
+    {
+        n_head = count;
+    }
+
+    /* Every burst is timestamped once it completed */
+    rslt = bme69x_get_regs((uint8_t)(BME69X_REG_FIELD0 + (first * BME69X_LEN_FIELD_OFFSET)),
+                           buff,
+                           (uint32_t)BME69X_LEN_FIELD * n_head,
+                           dev);
+    stamp[0] = BME69X_INTF_TIME_NS(dev);
+
+    if ((rslt == BME69X_OK) && (count > n_head))
+    {
+        rslt = bme69x_get_regs(BME69X_REG_FIELD0,
+                               &buff[n_head * BME69X_LEN_FIELD],
+                               (uint32_t)BME69X_LEN_FIELD * (count - n_head),
+                               dev);
+        stamp[1] = BME69X_INTF_TIME_NS(dev);
+    }
+
+    for (i = 0; (i < count) && (rslt == BME69X_OK); i++)
+    {
+        (void)bme69x_parse_field(&buff[i * BME69X_LEN_FIELD], &raw[i]);
+        raw[i].timestamp = stamp[(i < n_head) ? 0 : 1];
+    }
+
+    return rslt;
+}
+
+/* This internal API fills the heater values of the fields, from the shadow register cache when enabled */
+static int8_t set_field_heatr(struct bme69x_raw_field *raw, uint8_t count, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t set_val[BME69X_LEN_HEATR_REGS] = { 0 }; /* idac, res_heat, gas_wait */
+
+    rslt = get_regs_cached(BME69X_REG_IDAC_HEAT0, set_val, BME69X_LEN_HEATR_REGS, dev);
+    if (rslt == BME69X_OK)
+    {
+        fill_field_heatr(raw, count, set_val);
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to fill the heater values of the fields from the heater registers */
+static void fill_field_heatr(struct bme69x_raw_field *raw, uint8_t count, const uint8_t *set_val)
+{
+    uint8_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        /* The 4-bit gas index can exceed the 10 heater profiles, such a field has no heater values */
+        if (raw[i].gas_index < 10)
+        {
+            raw[i].idac = set_val[raw[i].gas_index];
+            raw[i].res_heat = set_val[10 + raw[i].gas_index];
+            raw[i].gas_wait = set_val[20 + raw[i].gas_index];
+        }
+        else
+        {
+            raw[i].idac = 0;
+            raw[i].res_heat = 0;
+            raw[i].gas_wait = 0;
+        }
+    }
+}
+
+/* This internal API is used to switch between SPI memory pages */
+static int8_t set_mem_page(uint8_t reg_addr, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t reg;
+    uint8_t mem_page;
+
+    /* Register address ahead of the data, see bme69x_write_fptr_t */
+    uint8_t wr_buff[2] = { BME69X_REG_MEM_PAGE & BME69X_SPI_WR_MSK, 0 };
+
+    /* Check for null pointers in the device structure*/
+    rslt = null_ptr_check(dev);
+    if (rslt == BME69X_OK)
+    {
+        if (reg_addr > 0x7f)
+        {
+            mem_page = BME69X_MEM_PAGE1;
+        }
+        else
+        {
+            mem_page = BME69X_MEM_PAGE0;
+        }
+
+        if (mem_page != dev->mem_page)
+        {
+            dev->mem_page = mem_page;
+            if ((dev->features & BME69X_FEAT_SHADOW_REGS) &&
+                (dev->shadow.valid & (UINT64_C(1) << (BME69X_LEN_SHADOW - 1))))
+            {
+                reg = dev->shadow.regs[BME69X_LEN_SHADOW - 1];
+            }
+            else
+            {
+                dev->intf_rslt = BME69X_INTF_READ(dev, BME69X_REG_MEM_PAGE | BME69X_SPI_RD_MSK, &reg, 1);
+                BME69X_STATS_ADD(dev, n_reads, 1);
+                BME69X_STATS_ADD(dev, bytes_read, 1);
+                if (dev->intf_rslt != 0)
+                {
+                    BME69X_STATS_ADD(dev, n_bus_errors, 1);
+                    rslt = BME69X_E_COM_FAIL;
+                }
+            }
+
+            if (rslt == BME69X_OK)
+            {
+                reg = reg & (~BME69X_MEM_PAGE_MSK);
+                reg = reg | (dev->mem_page & BME69X_MEM_PAGE_MSK);
+                wr_buff[1] = reg;
+                dev->intf_rslt = BME69X_INTF_WRITE(dev, wr_buff[0], &wr_buff[1], 1);
+                BME69X_STATS_ADD(dev, n_writes, 1);
+                BME69X_STATS_ADD(dev, bytes_written, 2);
+                BME69X_STATS_ADD(dev, n_page_switches, 1);
+                if (dev->intf_rslt != 0)
+                {
+                    BME69X_STATS_ADD(dev, n_bus_errors, 1);
+                    rslt = BME69X_E_COM_FAIL;
+                }
+                else
+                {
+                    shadow_update(BME69X_REG_MEM_PAGE, &reg, 1, dev);
+                }
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to get the current SPI memory page */
+static int8_t get_mem_page(struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t reg;
+
+    /* Check for null pointer in the device structure*/
+    rslt = null_ptr_check(dev);
+    if (rslt == BME69X_OK)
+    {
+        dev->intf_rslt = BME69X_INTF_READ(dev, BME69X_REG_MEM_PAGE | BME69X_SPI_RD_MSK, &reg, 1);
+        BME69X_STATS_ADD(dev, n_reads, 1);
+        BME69X_STATS_ADD(dev, bytes_read, 1);
+        if (dev->intf_rslt != 0)
+        {
+            BME69X_STATS_ADD(dev, n_bus_errors, 1);
+            rslt = BME69X_E_COM_FAIL;
+        }
+        else
+        {
+            dev->mem_page = reg & BME69X_MEM_PAGE_MSK;
+            shadow_update(BME69X_REG_MEM_PAGE, &reg, 1, dev);
+        }
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to limit the max value of a parameter */
+static int8_t boundary_check(uint8_t *value, uint8_t max, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+    if ((value != NULL) && (rslt == BME69X_OK))
+    {
+        /* Check if value is above maximum value */
+        if (*value > max)
+        {
+            /* Auto correct the invalid value to maximum value */
+            *value = max;
+            dev->info_msg |= BME69X_I_PARAM_CORR;
+        }
+    }
+    else
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to check the bme69x_dev for null pointers */
+static int8_t null_ptr_check(const struct bme69x_dev *dev)
+{
+    int8_t rslt = BME69X_OK;
+
+#if defined(BME69X_NO_DEV_CHECK)
+    (void)dev;
+#elif defined(BME69X_INTF_HEADER)
+    if (dev == NULL)
+    {
+        /* Device structure pointer is not valid */
+        rslt = BME69X_E_NULL_PTR;
+    }
+#else
+    if ((dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL))
+    {
+        /* Device structure pointer is not valid */
+        rslt = BME69X_E_NULL_PTR;
+    }
+#endif
+
+    return rslt;
+}
+
+/* This internal API is used to get the index of a register in the shadow register cache */
+static int8_t shadow_index(uint8_t reg_addr)
+{
+    int8_t index = -1;
+
+    if ((reg_addr >= BME69X_REG_IDAC_HEAT0) && (reg_addr <= BME69X_REG_CONFIG))
+    {
+        index = (int8_t)(reg_addr - BME69X_REG_IDAC_HEAT0);
+    }
+    else if (reg_addr == BME69X_REG_MEM_PAGE)
+    {
+        index = (int8_t)(BME69X_LEN_SHADOW - 1);
+    }
+
+    return index;
+}
+
+/* This internal API is used to update the shadow register cache with the register values read or written */
+static void shadow_update(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev)
+{
+    uint32_t i;
+    int8_t index;
+
+    /* Bursts ending before the heater registers hold nothing to cache */
+    if (((uint32_t)reg_addr + len) <= BME69X_REG_IDAC_HEAT0)
+    {
+        return;
+    }
+
+    for (i = 0; (i < len) && ((reg_addr + i) <= 0xff); i++)
+    {
+        index = shadow_index((uint8_t)(reg_addr + i));
+        if (index >= 0)
+        {
+            dev->shadow.regs[index] = reg_data[i];
+            dev->shadow.valid |= UINT64_C(1) << index;
+        }
+    }
+}
+
+/* This internal API is used to copy registers from the shadow register cache, when enabled and valid */
+static uint8_t shadow_hit(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, const struct bme69x_dev *dev)
+{
+    uint32_t i;
+    int8_t index;
+    uint8_t hit = 0;
+
+    if ((dev != NULL) && (reg_data != NULL) && (dev->features & BME69X_FEAT_SHADOW_REGS))
+    {
+        hit = 1;
+        for (i = 0; (i < len) && hit; i++)
+        {
+            index = shadow_index((uint8_t)(reg_addr + i));
+            if ((index < 0) || !(dev->shadow.valid & (UINT64_C(1) << index)))
+            {
+                hit = 0;
+            }
+        }
+
+        /* The mode bits of a forced measurement clear on their own */
+        if (hit && (reg_addr <= BME69X_REG_CTRL_MEAS) && ((reg_addr + len) > BME69X_REG_CTRL_MEAS) &&
+            ((dev->shadow.regs[shadow_index(BME69X_REG_CTRL_MEAS)] & BME69X_MODE_MSK) == BME69X_FORCED_MODE))
+        {
+            hit = 0;
+        }
+    }
+
+    if (hit)
+    {
+        for (i = 0; i < len; i++)
+        {
+            reg_data[i] = dev->shadow.regs[shadow_index((uint8_t)(reg_addr + i))];
+        }
+    }
+
+    return hit;
+}
+
+/* This internal API is used to read registers, from the shadow register cache when enabled and valid */
+static int8_t get_regs_cached(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev)
+{
+    if (shadow_hit(reg_addr, reg_data, len, dev))
+    {
+        return BME69X_OK;
+    }
+
+    return bme69x_get_regs(reg_addr, reg_data, len, dev);
+}
+
+/* This internal API is used to set heater configurations */
+static int8_t set_conf(const struct bme69x_heatr_conf *conf, uint8_t op_mode, uint8_t *nb_conv, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t reg_addr[BME69X_LEN_HEATR_CONF] = { 0 };
+    uint8_t reg_data[BME69X_LEN_HEATR_CONF] = { 0 };
+    uint8_t n_regs = 0;
+    uint8_t pos = 0;
+    uint8_t len;
+
+    rslt = calc_heatr_regs(conf, op_mode, nb_conv, reg_addr, reg_data, &n_regs, dev);
+
+    /* As many register pairs per burst as the interleaved buffer holds */
+    while ((rslt == BME69X_OK) && (pos < n_regs))
+    {
+        len = write_chunk_len(&reg_addr[pos], (uint8_t)(n_regs - pos));
+        rslt = bme69x_set_regs(&reg_addr[pos], &reg_data[pos], len, dev);
+        pos += len;
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to calculate the heater registers of a configuration */
+static int8_t calc_heatr_regs(const struct bme69x_heatr_conf *conf,
+                              uint8_t op_mode,
+                              uint8_t *nb_conv,
+                              uint8_t *reg_addr,
+                              uint8_t *reg_data,
+                              uint8_t *n_regs,
+                              struct bme69x_dev *dev)
+{
+    int8_t rslt = BME69X_OK;
+    uint8_t n = 0;
+
+#ifndef BME69X_ONLY_FORCED
+    uint8_t i;
+    uint8_t len;
+#endif
+
+#ifndef BME69X_USE_FPU
+    int32_t amb_term = calc_res_heat_amb(dev);
+#else
+    float amb_term = calc_res_heat_amb(dev);
+#endif
+
+    BME69X_HEATR_LUT_UPDATE(dev);
+
+    switch (op_mode)
+    {
+        case BME69X_FORCED_MODE:
+            reg_addr[0] = BME69X_REG_RES_HEAT0;
+            reg_data[0] = BME69X_RES_HEAT(conf->heatr_temp, amb_term, dev);
+            reg_addr[1] = BME69X_REG_GAS_WAIT0;
+            reg_data[1] = calc_gas_wait(conf->heatr_dur);
+            (*nb_conv) = 0;
+            n = 2;
+            break;
+#ifndef BME69X_ONLY_FORCED
+        case BME69X_SEQUENTIAL_MODE:
+        case BME69X_PARALLEL_MODE:
+            if ((!conf->heatr_dur_prof) || (!conf->heatr_temp_prof))
+            {
+                rslt = BME69X_E_NULL_PTR;
+                break;
+            }
+
+            if (conf->profile_len > 10)
+            {
+                rslt = BME69X_E_INVALID_LENGTH;
+                break;
+            }
+
+            if (op_mode == BME69X_PARALLEL_MODE)
+            {
+                if (conf->shared_heatr_dur == 0)
+                {
+                    rslt = BME69X_W_DEFINE_SHD_HEATR_DUR;
+                    break;
+                }
+
+                reg_addr[0] = BME69X_REG_SHD_HEATR_DUR;
+                reg_data[0] = calc_heatr_dur_shared(conf->shared_heatr_dur);
+                n = 1;
+            }
+
+            len = conf->profile_len;
+            for (i = 0; i < len; i++)
+            {
+                reg_addr[n + i] = BME69X_REG_RES_HEAT0 + i;
+                reg_data[n + i] = BME69X_RES_HEAT(conf->heatr_temp_prof[i], amb_term, dev);
+                reg_addr[n + len + i] = BME69X_REG_GAS_WAIT0 + i;
+
+                /* The parallel mode durations are multiples of the TPH measurement duration */
+                if (op_mode == BME69X_PARALLEL_MODE)
+                {
+                    reg_data[n + len + i] = (uint8_t) conf->heatr_dur_prof[i];
+                }
+                else
+                {
+                    reg_data[n + len + i] = calc_gas_wait(conf->heatr_dur_prof[i]);
+                }
+            }
+
+            (*nb_conv) = len;
+            n = (uint8_t)(n + (2 * len));
+            break;
+#endif
+        default:
+            rslt = BME69X_W_DEFINE_OP_MODE;
+    }
+
+    *n_regs = (rslt == BME69X_OK) ? n : 0;
+
+    return rslt;
+}
+
+/* This internal API is used to get the number of register pairs written by one burst */
+static uint8_t write_chunk_len(const uint8_t *reg_addr, uint8_t len)
+{
+    uint8_t n = 1;
+
+    /* The SPI memory page is selected once per burst */
+    while ((n < len) && (n < (BME69X_LEN_INTERLEAVE_BUFF / 2)) && ((reg_addr[n] > 0x7f) == (reg_addr[0] > 0x7f)))
+    {
+        n++;
+    }
+
+    return n;
+}
+
+/* This internal API is used to set the control gas registers of a heater configuration */
+static void calc_ctrl_gas(const struct bme69x_heatr_conf *conf, uint8_t nb_conv, uint8_t *ctrl_gas_data)
+{
+    uint8_t hctrl, run_gas;
+
+    if (conf->enable == BME69X_ENABLE)
+    {
+        hctrl = BME69X_ENABLE_HEATER;
+        run_gas = BME69X_ENABLE_GAS_MEAS;
+    }
+    else
+    {
+        hctrl = BME69X_DISABLE_HEATER;
+        run_gas = BME69X_DISABLE_GAS_MEAS;
+    }
+
+    ctrl_gas_data[0] = BME69X_SET_BITS(ctrl_gas_data[0], BME69X_HCTRL, hctrl);
+    ctrl_gas_data[1] = BME69X_SET_BITS_POS_0(ctrl_gas_data[1], BME69X_NBCONV, nb_conv);
+    ctrl_gas_data[1] = BME69X_SET_BITS(ctrl_gas_data[1], BME69X_RUN_GAS, run_gas);
+}
+
+/* This internal API is used to set the oversampling, filter and odr bits of the registers
+ * BME69X_REG_CTRL_GAS_1 up to BME69X_REG_CONFIG */
+static int8_t calc_conf(struct bme69x_conf *conf, uint8_t *data_array, struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t odr20 = 0, odr3 = 1;
+
+    rslt = boundary_check(&conf->filter, BME69X_FILTER_SIZE_127, dev);
+    if (rslt == BME69X_OK)
+    {
+        rslt = boundary_check(&conf->os_temp, BME69X_OS_16X, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = boundary_check(&conf->os_pres, BME69X_OS_16X, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = boundary_check(&conf->os_hum, BME69X_OS_16X, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = boundary_check(&conf->odr, BME69X_ODR_NONE, dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        data_array[4] = BME69X_SET_BITS(data_array[4], BME69X_FILTER, conf->filter);
+        data_array[3] = BME69X_SET_BITS(data_array[3], BME69X_OST, conf->os_temp);
+        data_array[3] = BME69X_SET_BITS(data_array[3], BME69X_OSP, conf->os_pres);
+        data_array[1] = BME69X_SET_BITS_POS_0(data_array[1], BME69X_OSH, conf->os_hum);
+        if (conf->odr != BME69X_ODR_NONE)
+        {
+            odr20 = conf->odr;
+            odr3 = 0;
+        }
+
+        data_array[4] = BME69X_SET_BITS(data_array[4], BME69X_ODR20, odr20);
+        data_array[0] = BME69X_SET_BITS(data_array[0], BME69X_ODR3, odr3);
+    }
+
+    return rslt;
+}
+
+#ifndef BME69X_ONLY_FORCED
+
+/* This internal API is used to calculate the register value for
+ * shared heater duration */
+static uint8_t calc_heatr_dur_shared(uint16_t dur)
+{
+    uint8_t factor = 0;
+    uint8_t heatdurval;
+
+    if (dur >= 0x783)
+    {
+        heatdurval = 0xff; /* Max duration */
+    }
+    else
+    {
+        /* Step size of 0.477ms */
+        dur = (uint16_t)(((uint32_t)dur * 1000) / 477);
+        while (dur > 0x3F)
+        {
+            dur = dur >> 2;
+            factor += 1;
+        }
+
+        heatdurval = (uint8_t)(dur + (factor * 64));
+    }
+
+    return heatdurval;
+}
+#endif
+
+/* This internal API is used to order the fields, the oldest new data first */
+static uint8_t order_fields(const struct bme69x_raw_field *raw, uint8_t count, uint8_t *order)
+{
+    int8_t age[3] = { 0 };
+    uint8_t n_new = 0;
+    uint8_t ref = 0;
+    uint8_t n_old;
+    uint8_t rank;
+    uint8_t i, j;
+
+    /* Ordering field data
+     *
+     * The 3 fields are filled in a fixed order with data in an incrementing
+     * 8-bit sub-measurement index which looks like
+     * Field index | Sub-meas index
+     *      0      |        0
+     *      1      |        1
+     *      2      |        2
+     *      0      |        3
+     *      ...
+     *      0      |        255
+     *      1      |        0
+     *      2      |        1
+     *
+     * The new data fields are at most 2 sub-measurements apart, so the
+     * difference of their 8-bit indexes taken as a signed 8-bit value gives
+     * their relative age, also across the overflow from 255 to 0. The rank of
+     * a new field is the number of new fields older than it, the fields
+     * without new data follow in field order.
+     */
+    for (i = 0; i < count; i++)
+    {
+        if (raw[i].status & BME69X_NEW_DATA_MSK)
+        {
+            /* The age is relative to the first new field */
+            if (n_new == 0)
+            {
+                ref = raw[i].meas_index;
+            }
+
+            age[i] = (int8_t)(raw[i].meas_index - ref);
+            n_new++;
+        }
+    }
+
+    n_old = n_new;
+    for (i = 0; i < count; i++)
+    {
+        if (raw[i].status & BME69X_NEW_DATA_MSK)
+        {
+            rank = 0;
+            for (j = 0; j < count; j++)
+            {
+                if ((raw[j].status & BME69X_NEW_DATA_MSK) && ((age[j] < age[i]) || ((age[j] == age[i]) && (j < i))))
+                {
+                    rank++;
+                }
+            }
+        }
+        else
+        {
+            rank = n_old++;
+        }
+
+        order[rank] = i;
+    }
+
+    return n_new;
+}
+
+/* This Function is to analyze the sensor data */
+static int8_t analyze_sensor_data(const struct bme69x_data *data, uint8_t n_meas)
+{
+    int8_t rslt = BME69X_OK;
+    uint8_t self_test_failed = 0, i;
+    uint32_t cent_res = 0;
+
+    if ((data[0].temperature < BME69X_MIN_TEMPERATURE) || (data[0].temperature > BME69X_MAX_TEMPERATURE))
+    {
+        self_test_failed++;
+    }
+
+    if ((data[0].pressure < BME69X_MIN_PRESSURE) || (data[0].pressure > BME69X_MAX_PRESSURE))
+    {
+        self_test_failed++;
+    }
+
+    if ((data[0].humidity < BME69X_MIN_HUMIDITY) || (data[0].humidity > BME69X_MAX_HUMIDITY))
+    {
+        self_test_failed++;
+    }
+
+    for (i = 0; i < n_meas; i++) /* Every gas measurement should be valid */
+    {
+        if (!(data[i].status & BME69X_GASM_VALID_MSK))
+        {
+            self_test_failed++;
+        }
+    }
+
+    if (n_meas >= 6)
+    {
+        cent_res = (uint32_t)((5 * (data[3].gas_resistance + data[5].gas_resistance)) / (2 * data[4].gas_resistance));
+    }
+
+    if (cent_res < 6)
+    {
+        self_test_failed++;
+    }
+
+    if (self_test_failed)
+    {
+        rslt = BME69X_E_SELF_TEST;
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to configure and trigger a self-test measurement, round 0 being the gas valid check */
+static int8_t selftest_trigger(struct bme69x_selftest *test, uint8_t round)
+{
+    int8_t rslt;
+    struct bme69x_conf conf;
+    struct bme69x_heatr_conf heatr_conf;
+
+    /* Set the temperature, pressure and humidity & filter settings */
+    conf.os_hum = BME69X_OS_1X;
+    conf.os_pres = BME69X_OS_16X;
+    conf.os_temp = BME69X_OS_2X;
+
+    /* Set the remaining gas sensor settings and link the heating profile */
+    heatr_conf.enable = BME69X_ENABLE;
+    if (round == 0)
+    {
+        heatr_conf.heatr_dur = BME69X_HEATR_DUR1;
+        heatr_conf.heatr_temp = BME69X_HIGH_TEMP;
+    }
+    else
+    {
+        heatr_conf.heatr_dur = BME69X_HEATR_DUR2;
+
+        /* Higher and lower temperature in turns */
+        heatr_conf.heatr_temp = ((round - 1) % 2 == 0) ? BME69X_HIGH_TEMP : BME69X_LOW_TEMP;
+    }
+
+    rslt = bme69x_set_heatr_conf(BME69X_FORCED_MODE, &heatr_conf, &test->t_dev);
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_set_conf(&conf, &test->t_dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_set_op_mode(BME69X_FORCED_MODE, &test->t_dev); /* Trigger a measurement */
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to read a self-test measurement */
+static int8_t selftest_read(struct bme69x_selftest *test, uint8_t round)
+{
+    int8_t rslt;
+    uint8_t n_fields;
+    struct bme69x_data *data = &test->data[(round == 0) ? 0 : (round - 1)];
+
+    rslt = bme69x_get_data(BME69X_FORCED_MODE, data, &n_fields, &test->t_dev);
+    if (rslt == BME69X_OK)
+    {
+        test->n_meas++;
+
+        /* The first measurement only checks that the heater and the gas measurement work */
+        if ((round == 0) && ((data->idac == 0x00) || (data->idac == 0xFF) || !(data->status & BME69X_GASM_VALID_MSK)))
+        {
+            rslt = BME69X_E_SELF_TEST;
+        }
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to read the calibration coefficients */
+static int8_t get_calib_data(struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t coeff_array[BME69X_LEN_COEFF_ALL];
+
+    rslt = bme69x_get_coeff(coeff_array, dev);
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_parse_calib(coeff_array, &dev->calib);
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to read variant ID information from the register */
+static int8_t read_variant_id(struct bme69x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t reg_data = 0;
+
+    /* Read variant ID information register */
+    rslt = bme69x_get_regs(BME69X_REG_VARIANT_ID, &reg_data, 1, dev);
+
+    if (rslt == BME69X_OK)
+    {
+        dev->variant_id = reg_data;
+    }
+
+    return rslt;
+}
+
+#ifndef BME69X_ONLY_FORCED
+
+/* This internal API is used to compute the heater registers of the next slot reload of a sequential pipeline */
+static void seq_stage(struct bme69x_seq *seq)
+{
+    /* The slot of the current step runs again n_slots steps later */
+    uint8_t step = (uint8_t)(((uint16_t)seq->step + seq->n_slots) % seq->profile_len);
+
+    if (seq->profile_len > seq->n_slots)
+    {
+        BME69X_HEATR_LUT_UPDATE(seq->dev);
+        seq->next_res_heat = BME69X_RES_HEAT(seq->temp_prof[step], calc_res_heat_amb(seq->dev), seq->dev);
+        seq->next_gas_wait = calc_gas_wait(seq->dur_prof[step]);
+    }
+}
+
+/* This internal API is used to move a sequential pipeline to its next step, reloading the slot left */
+static int8_t seq_advance(struct bme69x_seq *seq)
+{
+    int8_t rslt = BME69X_OK;
+    uint8_t reg_addr[2];
+    uint8_t reg_data[2];
+
+    /* The sensor is on the other slots until this one comes round again */
+    if (seq->profile_len > seq->n_slots)
+    {
+        reg_addr[0] = (uint8_t)(BME69X_REG_RES_HEAT0 + seq->slot);
+        reg_data[0] = seq->next_res_heat;
+        reg_addr[1] = (uint8_t)(BME69X_REG_GAS_WAIT0 + seq->slot);
+        reg_data[1] = seq->next_gas_wait;
+        rslt = bme69x_set_regs(reg_addr, reg_data, 2, seq->dev);
+        if (rslt == BME69X_OK)
+        {
+            seq->n_reloads++;
+        }
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        seq->step = (uint8_t)((seq->step + 1) % seq->profile_len);
+        seq->slot = (uint8_t)((seq->slot + 1) % seq->n_slots);
+
+        /* Computed while the next step runs */
+        seq_stage(seq);
+    }
+
+    return rslt;
+}
+#endif
+
+/* This internal API is used to clear the features and the statistics of a device being initialized */
+static void clear_dev_state(struct bme69x_dev *dev)
+{
+    dev->features = 0;
+    dev->acq.skew_us = 0;
+    dev->acq.last_polls = 0;
+    dev->acq.n_ready = 0;
+    dev->acq.n_timeout = 0;
+    dev->acq.n_polls = 0;
+#ifdef BME69X_ENABLE_STATS
+    dev->stats.n_reads = 0;
+    dev->stats.n_writes = 0;
+    dev->stats.bytes_read = 0;
+    dev->stats.bytes_written = 0;
+    dev->stats.n_page_switches = 0;
+    dev->stats.n_retries = 0;
+    dev->stats.n_bus_errors = 0;
+    dev->stats.delay_us = 0;
+#endif
+#ifdef BME69X_USE_HEATR_LUT
+    dev->heatr_lut.valid = 0;
+#endif
+}
+
+#ifdef BME69X_USE_HEATR_LUT
+
+/* This internal API is used to rebuild the heater resistance table when the ambient temperature changed */
+static void update_heatr_lut(struct bme69x_dev *dev)
+{
+#ifndef BME69X_USE_FPU
+    int32_t amb_term;
+#else
+    float amb_term;
+#endif
+    uint16_t temp;
+
+    if ((dev->heatr_lut.valid == 0) || (dev->heatr_lut.amb_temp != dev->amb_temp))
+    {
+        amb_term = calc_res_heat_amb(dev);
+        for (temp = 0; temp < BME69X_LEN_HEATR_LUT; temp++)
+        {
+            dev->heatr_lut.res_heat[temp] = calc_res_heat(temp, amb_term, dev);
+        }
+
+        dev->heatr_lut.amb_temp = dev->amb_temp;
+        dev->heatr_lut.valid = 1;
+    }
+}
+#endif
+
+/* This internal API is used to check the chip ID and read the variant ID and the calibration data */
+static int8_t read_identity(struct bme69x_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = bme69x_get_regs(BME69X_REG_CHIP_ID, &dev->chip_id, 1, dev);
+
+    if (rslt == BME69X_OK)
+    {
+        if (dev->chip_id == BME69X_CHIP_ID)
+        {
+            /* Read Variant ID */
+            rslt = read_variant_id(dev);
+
+            if (rslt == BME69X_OK)
+            {
+                /* Get the Calibration data */
+                rslt = get_calib_data(dev);
+            }
+        }
+        else
+        {
+            rslt = BME69X_E_DEV_NOT_FOUND;
+        }
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to compute the checksum of a warm start blob */
+static uint32_t fnv1a(uint32_t hash, const uint8_t *byte, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        hash = (hash ^ byte[i]) * UINT32_C(16777619);
+    }
+
+    return hash;
+}
+
+/* This internal API is used to compute the checksum of a warm start blob */
+static uint32_t warm_checksum(const struct bme69x_warm_blob *blob)
+{
+    const struct bme69x_calib_data *calib = &blob->calib;
+    uint32_t hash = UINT32_C(2166136261);
+
+    /* FNV-1a member by member, so that the padding of a copied blob does not matter */
+    BME69X_WARM_HASH(hash, blob->format);
+    BME69X_WARM_HASH(hash, blob->unique_id);
+    BME69X_WARM_HASH(hash, blob->chip_id);
+    BME69X_WARM_HASH(hash, blob->variant_id);
+    BME69X_WARM_HASH(hash, calib->par_h1);
+    BME69X_WARM_HASH(hash, calib->par_h2);
+    BME69X_WARM_HASH(hash, calib->par_h3);
+    BME69X_WARM_HASH(hash, calib->par_h4);
+    BME69X_WARM_HASH(hash, calib->par_h5);
+    BME69X_WARM_HASH(hash, calib->par_h6);
+    BME69X_WARM_HASH(hash, calib->par_g1);
+    BME69X_WARM_HASH(hash, calib->par_g2);
+    BME69X_WARM_HASH(hash, calib->par_g3);
+    BME69X_WARM_HASH(hash, calib->par_t1);
+    BME69X_WARM_HASH(hash, calib->par_t2);
+    BME69X_WARM_HASH(hash, calib->par_t3);
+    BME69X_WARM_HASH(hash, calib->par_p5);
+    BME69X_WARM_HASH(hash, calib->par_p6);
+    BME69X_WARM_HASH(hash, calib->par_p7);
+    BME69X_WARM_HASH(hash, calib->par_p8);
+    BME69X_WARM_HASH(hash, calib->par_p1);
+    BME69X_WARM_HASH(hash, calib->par_p2);
+    BME69X_WARM_HASH(hash, calib->par_p3);
+    BME69X_WARM_HASH(hash, calib->par_p4);
+    BME69X_WARM_HASH(hash, calib->par_p9);
+    BME69X_WARM_HASH(hash, calib->par_p10);
+    BME69X_WARM_HASH(hash, calib->par_p11);
+    BME69X_WARM_HASH(hash, calib->res_heat_range);
+    BME69X_WARM_HASH(hash, calib->res_heat_val);
+    BME69X_WARM_HASH(hash, calib->range_sw_err);
+#ifndef BME69X_USE_FPU
+    BME69X_WARM_HASH(hash, calib->derived.p1_off);
+    BME69X_WARM_HASH(hash, calib->derived.p5_sens);
+    BME69X_WARM_HASH(hash, calib->derived.p9_nl);
+    BME69X_WARM_HASH(hash, calib->derived.rh_var5);
+#else
+    BME69X_WARM_HASH(hash, calib->derived.do1);
+    BME69X_WARM_HASH(hash, calib->derived.dtk1);
+    BME69X_WARM_HASH(hash, calib->derived.dtk2);
+    BME69X_WARM_HASH(hash, calib->derived.o);
+    BME69X_WARM_HASH(hash, calib->derived.tk10);
+    BME69X_WARM_HASH(hash, calib->derived.tk20);
+    BME69X_WARM_HASH(hash, calib->derived.tk30);
+    BME69X_WARM_HASH(hash, calib->derived.s);
+    BME69X_WARM_HASH(hash, calib->derived.tk1s);
+    BME69X_WARM_HASH(hash, calib->derived.tk2s);
+    BME69X_WARM_HASH(hash, calib->derived.tk3s);
+    BME69X_WARM_HASH(hash, calib->derived.nls);
+    BME69X_WARM_HASH(hash, calib->derived.tknls);
+    BME69X_WARM_HASH(hash, calib->derived.nls3);
+    BME69X_WARM_HASH(hash, calib->derived.oh);
+    BME69X_WARM_HASH(hash, calib->derived.sh);
+    BME69X_WARM_HASH(hash, calib->derived.tk10h);
+    BME69X_WARM_HASH(hash, calib->derived.tk1sh);
+    BME69X_WARM_HASH(hash, calib->derived.tk12sh);
+    BME69X_WARM_HASH(hash, calib->derived.hlin2);
+    BME69X_WARM_HASH(hash, calib->derived.rh_var1);
+    BME69X_WARM_HASH(hash, calib->derived.rh_var2);
+    BME69X_WARM_HASH(hash, calib->derived.rh_var3);
+    BME69X_WARM_HASH(hash, calib->derived.rh_range);
+    BME69X_WARM_HASH(hash, calib->derived.rh_val);
+#endif
+
+    return hash;
+}
+
+/* This internal API is used to fill a warm start blob from an initialized device */
+static void warm_fill(struct bme69x_warm_blob *blob, const uint8_t *unique_id, const struct bme69x_dev *dev)
+{
+    uint8_t i;
+
+    /* Cleared first, so that a saved blob holds no stale bytes in its padding */
+    memset(blob, 0, sizeof(*blob));
+    blob->format = BME69X_WARM_FORMAT;
+    for (i = 0; i < BME69X_LEN_UNIQUE_ID; i++)
+    {
+        blob->unique_id[i] = unique_id[i];
+    }
+
+    blob->chip_id = dev->chip_id;
+    blob->variant_id = dev->variant_id;
+    blob->calib = dev->calib;
+    blob->checksum = warm_checksum(blob);
+}
+
+/* This internal API is used to submit the bus transfer of an asynchronous operation */
+static int8_t async_issue(struct bme69x_async *op)
+{
+    int8_t rslt = BME69X_OK;
+    struct bme69x_dev *dev = op->dev;
+
+    op->pending = 1;
+    if (dev->submit(&op->xfer, op, dev->intf_ptr) != BME69X_INTF_RET_SUCCESS)
+    {
+        op->pending = 0;
+        rslt = BME69X_E_COM_FAIL;
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to submit the requested transfer of an asynchronous operation, in bus addressing */
+static int8_t async_issue_req(struct bme69x_async *op)
+{
+    struct bme69x_dev *dev = op->dev;
+    uint8_t i;
+
+    op->xfer = op->req;
+    if (op->req.type == BME69X_XFER_READ)
+    {
+        if (BME69X_IS_SPI(dev))
+        {
+            op->xfer.reg_addr = op->req.reg_addr | BME69X_SPI_RD_MSK;
+        }
+    }
+    else if (op->req.type == BME69X_XFER_WRITE)
+    {
+        /* Interleave the register pairs of the burst, as bme69x_set_regs */
+        for (i = 0; i < op->n_chunk; i++)
+        {
+            op->wr_buff[2 * i] = op->reg_addr[op->reg_pos + i];
+            if (BME69X_IS_SPI(dev))
+            {
+                op->wr_buff[2 * i] &= BME69X_SPI_WR_MSK;
+            }
+
+            op->wr_buff[(2 * i) + 1] = op->reg_data[op->reg_pos + i];
+        }
+
+        op->xfer.reg_addr = op->wr_buff[0];
+        op->xfer.reg_data = &op->wr_buff[1];
+        op->xfer.len = (uint32_t)(2 * op->n_chunk) - 1;
+    }
+
+    return async_issue(op);
+}
+
+/* This internal API is used to submit the write of the SPI memory page of the requested register */
+static int8_t async_page_write(struct bme69x_async *op)
+{
+    uint8_t mem_page = (op->req.reg_addr > 0x7f) ? BME69X_MEM_PAGE1 : BME69X_MEM_PAGE0;
+
+    op->page_buff[0] = BME69X_REG_MEM_PAGE & BME69X_SPI_WR_MSK;
+    op->page_buff[1] = (uint8_t)((op->page_buff[1] & (~BME69X_MEM_PAGE_MSK)) | (mem_page & BME69X_MEM_PAGE_MSK));
+    op->page_step = BME69X_ASYNC_PAGE_WRITE;
+    op->xfer.type = BME69X_XFER_WRITE;
+    op->xfer.reg_addr = op->page_buff[0];
+    op->xfer.reg_data = &op->page_buff[1];
+    op->xfer.len = 1;
+    op->xfer.period = 0;
+
+    return async_issue(op);
+}
+
+/* This internal API is used to submit the requested transfer, switching the SPI memory page first when needed */
+static int8_t async_request(struct bme69x_async *op, uint8_t next_step)
+{
+    struct bme69x_dev *dev = op->dev;
+    uint8_t mem_page = (op->req.reg_addr > 0x7f) ? BME69X_MEM_PAGE1 : BME69X_MEM_PAGE0;
+
+    op->step = next_step;
+
+    if (!BME69X_IS_SPI(dev) || (op->req.type == BME69X_XFER_WAIT) || (mem_page == dev->mem_page))
+    {
+        return async_issue_req(op);
+    }
+
+    if (shadow_hit(BME69X_REG_MEM_PAGE, &op->page_buff[1], 1, dev))
+    {
+        return async_page_write(op);
+    }
+
+    op->page_step = BME69X_ASYNC_PAGE_READ;
+    op->xfer.type = BME69X_XFER_READ;
+    op->xfer.reg_addr = BME69X_REG_MEM_PAGE | BME69X_SPI_RD_MSK;
+    op->xfer.reg_data = &op->page_buff[1];
+    op->xfer.len = 1;
+    op->xfer.period = 0;
+
+    return async_issue(op);
+}
+
+/* This internal API is used to submit a register read of an asynchronous operation */
+static int8_t async_read(struct bme69x_async *op, uint8_t reg_addr, uint8_t *reg_data, uint32_t len, uint8_t next_step)
+{
+    op->req.type = BME69X_XFER_READ;
+    op->req.reg_addr = reg_addr;
+    op->req.reg_data = reg_data;
+    op->req.len = len;
+    op->req.period = 0;
+
+    return async_request(op, next_step);
+}
+
+/* This internal API is used to submit the next burst of the register pairs of an asynchronous operation */
+static int8_t async_write(struct bme69x_async *op, uint8_t next_step)
+{
+    op->n_chunk = write_chunk_len(&op->reg_addr[op->reg_pos], (uint8_t)(op->n_regs - op->reg_pos));
+    op->req.type = BME69X_XFER_WRITE;
+    op->req.reg_addr = op->reg_addr[op->reg_pos];
+    op->req.reg_data = NULL;
+    op->req.len = op->n_chunk;
+    op->req.period = 0;
+
+    return async_request(op, next_step);
+}
+
+/* This internal API is used to submit a wait of an asynchronous operation */
+static int8_t async_wait(struct bme69x_async *op, uint32_t period, uint8_t next_step)
+{
+    op->req.type = BME69X_XFER_WAIT;
+    op->req.reg_addr = 0;
+    op->req.reg_data = NULL;
+    op->req.len = 0;
+    op->req.period = period;
+
+    return async_request(op, next_step);
+}
+
+/* This internal API is used to account for a completed transfer of an asynchronous operation */
+static int8_t async_xfer_done(struct bme69x_async *op)
+{
+    int8_t rslt = BME69X_OK;
+    struct bme69x_dev *dev = op->dev;
+    uint8_t i;
+
+    if (op->page_step == BME69X_ASYNC_PAGE_READ)
+    {
+        rslt = async_page_write(op);
+    }
+    else if (op->page_step == BME69X_ASYNC_PAGE_WRITE)
+    {
+        BME69X_STATS_ADD(dev, n_page_switches, 1);
+        dev->mem_page = op->page_buff[1] & BME69X_MEM_PAGE_MSK;
+        shadow_update(BME69X_REG_MEM_PAGE, &op->page_buff[1], 1, dev);
+        op->page_step = 0;
+        rslt = async_issue_req(op);
+    }
+    else if (op->req.type == BME69X_XFER_READ)
+    {
+        shadow_update(op->req.reg_addr, op->req.reg_data, op->req.len, dev);
+    }
+    else if (op->req.type == BME69X_XFER_WRITE)
+    {
+        for (i = 0; i < op->n_chunk; i++)
+        {
+            shadow_update(op->reg_addr[op->reg_pos + i], &op->reg_data[op->reg_pos + i], 1, dev);
+        }
+
+        op->reg_pos += op->n_chunk;
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to compensate the fields read by an asynchronous bme69x_get_data */
+static int8_t async_data_done(struct bme69x_async *op)
+{
+    int8_t rslt = BME69X_OK;
+    struct bme69x_dev *dev = op->dev;
+    uint8_t order[3];
+    uint8_t n_new;
+    uint8_t n_out;
+    uint8_t i;
+
+    if (op->op_mode == BME69X_FORCED_MODE)
+    {
+        fill_field_heatr(op->raw, 1, op->heatr);
+        (void)bme69x_compensate(&dev->calib, &op->raw[0], op->data);
+        *op->n_data = 1;
+
+        /* The sensor returns to sleep once the forced measurement is done */
+        dev->shadow.regs[shadow_index(BME69X_REG_CTRL_MEAS)] &= (uint8_t)~BME69X_MODE_MSK;
+    }
+    else
+    {
+        fill_field_heatr(op->raw, 3, op->heatr);
+        n_new = order_fields(op->raw, 3, order);
+        n_out = (dev->features & BME69X_FEAT_NEW_FIELDS_ONLY) ? n_new : 3;
+        for (i = 0; i < n_out; i++)
+        {
+            (void)bme69x_compensate(&dev->calib, &op->raw[order[i]], &op->data[i]);
+        }
+
+        *op->n_data = n_new;
+        if (n_new == 0)
+        {
+            rslt = BME69X_W_NO_NEW_DATA;
+        }
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to run the steps of an asynchronous operation until a transfer is submitted */
+static int8_t async_step(struct bme69x_async *op)
+{
+    int8_t rslt = BME69X_OK;
+    struct bme69x_dev *dev = op->dev;
+    uint8_t n_fields = (op->op_mode == BME69X_FORCED_MODE) ? 1 : 3;
+    uint64_t stamp;
+    uint8_t pos;
+    uint8_t i;
+
+    while ((rslt == BME69X_OK) && (!op->pending) && (op->step != BME69X_ASYNC_DONE))
+    {
+        switch (op->step)
+        {
+            case BME69X_ASYNC_FIELD_READ:
+                rslt = async_read(op, BME69X_REG_FIELD0, op->field, (uint32_t)BME69X_LEN_FIELD * n_fields,
+                                  BME69X_ASYNC_FIELD_DONE);
+                break;
+            case BME69X_ASYNC_FIELD_DONE:
+                /* Completion of the field read */
+                stamp = BME69X_INTF_TIME_NS(dev);
+                for (i = 0; i < n_fields; i++)
+                {
+                    (void)bme69x_parse_field(&op->field[i * BME69X_LEN_FIELD], &op->raw[i]);
+                    op->raw[i].timestamp = stamp;
+                }
+
+                if ((op->op_mode == BME69X_FORCED_MODE) && !(op->raw[0].status & BME69X_NEW_DATA_MSK))
+                {
+                    /* Poll again, as read_field_data */
+                    op->tries--;
+                    if (op->tries > 0)
+                    {
+                        BME69X_STATS_ADD(dev, n_retries, 1);
+                        rslt = async_wait(op, BME69X_PERIOD_POLL, BME69X_ASYNC_FIELD_READ);
+                    }
+                    else
+                    {
+                        op->data->status = op->raw[0].status;
+                        op->data->gas_index = op->raw[0].gas_index;
+                        op->data->meas_index = op->raw[0].meas_index;
+                        *op->n_data = 0;
+                        op->step = BME69X_ASYNC_DONE;
+                        rslt = BME69X_W_NO_NEW_DATA;
+                    }
+                }
+                else
+                {
+                    op->heatr_pos = 0;
+                    op->step = BME69X_ASYNC_HEATR_READ;
+                }
+
+                break;
+            case BME69X_ASYNC_HEATR_READ:
+                if (op->op_mode == BME69X_FORCED_MODE)
+                {
+                    /* Only the idac, res_heat and gas_wait registers of the profile used, as read_field_data */
+                    if ((op->raw[0].gas_index >= 10) || (op->heatr_pos == 3))
+                    {
+                        op->step = BME69X_ASYNC_HEATR_DONE;
+                    }
+                    else
+                    {
+                        pos = (uint8_t)((op->heatr_pos * 10) + op->raw[0].gas_index);
+                        op->heatr_pos++;
+                        if (!shadow_hit(BME69X_REG_IDAC_HEAT0 + pos, &op->heatr[pos], 1, dev))
+                        {
+                            rslt = async_read(op, BME69X_REG_IDAC_HEAT0 + pos, &op->heatr[pos], 1,
+                                              BME69X_ASYNC_HEATR_READ);
+                        }
+                    }
+                }
+                else if (shadow_hit(BME69X_REG_IDAC_HEAT0, op->heatr, BME69X_LEN_HEATR_REGS, dev))
+                {
+                    op->step = BME69X_ASYNC_HEATR_DONE;
+                }
+                else
+                {
+                    rslt = async_read(op, BME69X_REG_IDAC_HEAT0, op->heatr, BME69X_LEN_HEATR_REGS,
+                                      BME69X_ASYNC_HEATR_DONE);
+                }
+
+                break;
+            case BME69X_ASYNC_HEATR_DONE:
+                op->step = BME69X_ASYNC_DONE;
+                rslt = async_data_done(op);
+                break;
+            case BME69X_ASYNC_SLEEP_READ:
+
+                /* Only the first poll can be served from the shadow register cache, as bme69x_set_op_mode */
+                if ((op->tries == 0) && shadow_hit(BME69X_REG_CTRL_MEAS, op->ctrl, 1, dev))
+                {
+                    op->step = BME69X_ASYNC_SLEEP_DONE;
+                }
+                else
+                {
+                    rslt = async_read(op, BME69X_REG_CTRL_MEAS, op->ctrl, 1, BME69X_ASYNC_SLEEP_DONE);
+                }
+
+                break;
+            case BME69X_ASYNC_SLEEP_DONE:
+                if ((op->ctrl[0] & BME69X_MODE_MSK) == BME69X_SLEEP_MODE)
+                {
+                    op->step = BME69X_ASYNC_CONF;
+                }
+                else
+                {
+                    op->reg_addr[0] = BME69X_REG_CTRL_MEAS;
+                    op->reg_data[0] = op->ctrl[0] & (uint8_t)~BME69X_MODE_MSK;
+                    op->n_regs = 1;
+                    op->reg_pos = 0;
+                    rslt = async_write(op, BME69X_ASYNC_SLEEP_WAIT);
+                }
+
+                break;
+            case BME69X_ASYNC_SLEEP_WAIT:
+                op->tries++;
+                BME69X_STATS_ADD(dev, n_retries, 1);
+                rslt = async_wait(op, BME69X_PERIOD_POLL, BME69X_ASYNC_SLEEP_READ);
+                break;
+            case BME69X_ASYNC_CONF:
+                op->reg_pos = 0;
+                op->step = BME69X_ASYNC_CONF_WRITE;
+                rslt = calc_heatr_regs(op->heatr_conf, op->op_mode, &op->nb_conv, op->reg_addr, op->reg_data,
+                                       &op->n_regs, dev);
+                break;
+            case BME69X_ASYNC_CONF_WRITE:
+                if (op->reg_pos < op->n_regs)
+                {
+                    rslt = async_write(op, BME69X_ASYNC_CONF_WRITE);
+                }
+                else
+                {
+                    op->step = BME69X_ASYNC_GAS_READ;
+                }
+
+                break;
+            case BME69X_ASYNC_GAS_READ:
+                if (shadow_hit(BME69X_REG_CTRL_GAS_0, op->ctrl, 2, dev))
+                {
+                    op->step = BME69X_ASYNC_GAS_DONE;
+                }
+                else
+                {
+                    rslt = async_read(op, BME69X_REG_CTRL_GAS_0, op->ctrl, 2, BME69X_ASYNC_GAS_DONE);
+                }
+
+                break;
+            case BME69X_ASYNC_GAS_DONE:
+                calc_ctrl_gas(op->heatr_conf, op->nb_conv, op->ctrl);
+                op->reg_addr[0] = BME69X_REG_CTRL_GAS_0;
+                op->reg_data[0] = op->ctrl[0];
+                op->reg_addr[1] = BME69X_REG_CTRL_GAS_1;
+                op->reg_data[1] = op->ctrl[1];
+                op->n_regs = 2;
+                op->reg_pos = 0;
+                rslt = async_write(op, BME69X_ASYNC_DONE);
+                break;
+            default:
+                rslt = BME69X_E_NULL_PTR;
+                break;
+        }
+    }
+
+    return rslt;
+}
+
+/* This internal API is used to check an asynchronous operation before starting it */
+static int8_t async_check(const struct bme69x_async *op)
+{
+    int8_t rslt = BME69X_OK;
+
+    if ((op == NULL) || (op->dev == NULL) || (op->dev->submit == NULL) || (op->cb == NULL))
+    {
+        rslt = BME69X_E_NULL_PTR;
+    }
+    else if (op->busy)
+    {
+        rslt = BME69X_E_BUSY;
+    }
+
+    return rslt;
+}
@@ -1,317 +1,1034 @@
-/**
-* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
-*
-* BSD-3-Clause
-*
-* Redistribution and use in source and binary forms, with or without
-* modification, are permitted provided that the following conditions are met:
-*
-* 1. Redistributions of source code must retain the above copyright
-*    notice, this list of conditions and the following disclaimer.
-*
-* 2. Redistributions in binary form must reproduce the above copyright
-*    notice, this list of conditions and the following disclaimer in the
-*    documentation and/or other materials provided with the distribution.
-*
-* 3. Neither the name of the copyright holder nor the names of its
-*    contributors may be used to endorse or promote products derived from
-*    this software without specific prior written permission.
-*
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
-* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
-* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
-* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
-* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
-* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
-* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
-* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-* POSSIBILITY OF SUCH DAMAGE.
-*
-* @file       bme69x.h
-* @date       2025-07-15
-* @version    v1.0.3
-*
-*/
-
-#ifndef BME69X_H_
-#define BME69X_H_
-
-#include "bme69x_defs.h"
-
-/* CPP guard */
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/**
- * \ingroup bme69x
- * \defgroup bme69xApiInit Initialization
- * @brief Initialize the sensor and device structure
- */
-
-/*!
- * \ingroup bme69xApiInit
- * \page bme69x_api_bme69x_init bme69x_init
- * \code
- * int8_t bme69x_init(struct bme69x_dev *dev);
- * \endcode
- * @details This API reads the chip-id of the sensor which is the first step to
- * verify the sensor and also calibrates the sensor
- * As this API is the entry point, call this API before using other APIs.
- *
- * @param[in,out] dev : Structure instance of bme69x_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_init(struct bme69x_dev *dev);
-
-/**
- * \ingroup bme69x
- * \defgroup bme69xApiRegister Registers
- * @brief Generic API for accessing sensor registers
- */
-
-/*!
- * \ingroup bme69xApiRegister
- * \page bme69x_api_bme69x_set_regs bme69x_set_regs
- * \code
- * int8_t bme69x_set_regs(const uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev)
- * \endcode
- * @details This API writes the given data to the register address of the sensor
- *
- * @param[in] reg_addr : Register addresses to where the data is to be written
- * @param[in] reg_data : Pointer to data buffer which is to be written
- *                       in the reg_addr of sensor.
- * @param[in] len      : No of bytes of data to write
- * @param[in,out] dev  : Structure instance of bme69x_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_set_regs(const uint8_t *reg_addr, const uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev);
-
-/*!
- * \ingroup bme69xApiRegister
- * \page bme69x_api_bme69x_get_regs bme69x_get_regs
- * \code
- * int8_t bme69x_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev)
- * \endcode
- * @details This API reads the data from the given register address of sensor.
- *
- * @param[in] reg_addr  : Register address from where the data to be read
- * @param[out] reg_data : Pointer to data buffer to store the read data.
- * @param[in] len       : No of bytes of data to be read.
- * @param[in,out] dev   : Structure instance of bme69x_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev);
-
-/**
- * \ingroup bme69x
- * \defgroup bme69xApiSystem System
- * @brief API that performs system-level operations
- */
-
-/*!
- * \ingroup bme69xApiSystem
- * \page bme69x_api_bme69x_soft_reset bme69x_soft_reset
- * \code
- * int8_t bme69x_soft_reset(struct bme69x_dev *dev);
- * \endcode
- * @details This API soft-resets the sensor.
- *
- * @param[in,out] dev : Structure instance of bme69x_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_soft_reset(struct bme69x_dev *dev);
-
-/**
- * \ingroup bme69x
- * \defgroup bme69xApiOm Operation mode
- * @brief API to configure operation mode
- */
-
-/*!
- * \ingroup bme69xApiOm
- * \page bme69x_api_bme69x_set_op_mode bme69x_set_op_mode
- * \code
- * int8_t bme69x_set_op_mode(const uint8_t op_mode, struct bme69x_dev *dev);
- * \endcode
- * @details This API is used to set the operation mode of the sensor
- * @param[in] op_mode : Desired operation mode.
- * @param[in] dev     : Structure instance of bme69x_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_set_op_mode(const uint8_t op_mode, struct bme69x_dev *dev);
-
-/*!
- * \ingroup bme69xApiOm
- * \page bme69x_api_bme69x_get_op_mode bme69x_get_op_mode
- * \code
- * int8_t bme69x_get_op_mode(uint8_t *op_mode, struct bme69x_dev *dev);
- * \endcode
- * @details This API is used to get the operation mode of the sensor.
- *
- * @param[out] op_mode : Desired operation mode.
- * @param[in,out] dev : Structure instance of bme69x_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_get_op_mode(uint8_t *op_mode, struct bme69x_dev *dev);
-
-/*!
- * \ingroup bme69xApiConfig
- * \page bme69x_api_bme69x_get_meas_dur bme69x_get_meas_dur
- * \code
- * uint32_t bme69x_get_meas_dur(const uint8_t op_mode, struct bme69x_conf *conf, struct bme69x_dev *dev);
- * \endcode
- * @details This API is used to get the remaining duration that can be used for heating.
- *
- * @param[in] op_mode : Desired operation mode.
- * @param[in] conf    : Desired sensor configuration.
- * @param[in] dev     : Structure instance of bme69x_dev
- *
- * @return Measurement duration calculated in microseconds
- */
-uint32_t bme69x_get_meas_dur(const uint8_t op_mode, struct bme69x_conf *conf, struct bme69x_dev *dev);
-
-/**
- * \ingroup bme69x
- * \defgroup bme69xApiData Data Read out
- * @brief Read our data from the sensor
- */
-
-/*!
- * \ingroup bme69xApiData
- * \page bme69x_api_bme69x_get_data bme69x_get_data
- * \code
- * int8_t bme69x_get_data(uint8_t op_mode, struct bme69x_data *data, uint8_t *n_data, struct bme69x_dev *dev);
- * \endcode
- * @details This API reads the pressure, temperature and humidity and gas data
- * from the sensor, compensates the data and store it in the bme69x_data
- * structure instance passed by the user.
- *
- * @param[in]  op_mode : Expected operation mode.
- * @param[out] data    : Structure instance to hold the data.
- * @param[out] n_data  : Number of data instances available.
- * @param[in,out] dev  : Structure instance of bme69x_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_get_data(uint8_t op_mode, struct bme69x_data *data, uint8_t *n_data, struct bme69x_dev *dev);
-
-/**
- * \ingroup bme69x
- * \defgroup bme69xApiConfig Configuration
- * @brief Configuration API of sensor
- */
-
-/*!
- * \ingroup bme69xApiConfig
- * \page bme69x_api_bme69x_set_conf bme69x_set_conf
- * \code
- * int8_t bme69x_set_conf(struct bme69x_conf *conf, struct bme69x_dev *dev);
- * \endcode
- * @details This API is used to set the oversampling, filter and odr configuration
- *
- * @param[in] conf    : Desired sensor configuration.
- * @param[in,out] dev : Structure instance of bme69x_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_set_conf(struct bme69x_conf *conf, struct bme69x_dev *dev);
-
-/*!
- * \ingroup bme69xApiConfig
- * \page bme69x_api_bme69x_get_conf bme69x_get_conf
- * \code
- * int8_t bme69x_get_conf(struct bme69x_conf *conf, struct bme69x_dev *dev);
- * \endcode
- * @details This API is used to get the oversampling, filter and odr
- * configuration
- *
- * @param[out] conf   : Present sensor configuration.
- * @param[in,out] dev : Structure instance of bme69x_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_get_conf(struct bme69x_conf *conf, struct bme69x_dev *dev);
-
-/*!
- * \ingroup bme69xApiConfig
- * \page bme69x_api_bme69x_set_heatr_conf bme69x_set_heatr_conf
- * \code
- * int8_t bme69x_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev);
- * \endcode
- * @details This API is used to set the gas configuration of the sensor.
- *
- * @param[in] op_mode : Expected operation mode of the sensor.
- * @param[in] conf    : Desired heating configuration.
- * @param[in,out] dev : Structure instance of bme69x_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev);
-
-/*!
- * \ingroup bme69xApiConfig
- * \page bme69x_api_bme69x_get_heatr_conf bme69x_get_heatr_conf
- * \code
- * int8_t bme69x_get_heatr_conf(const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev);
- * \endcode
- * @details This API is used to get the gas configuration of the sensor.
- *
- * @param[out] conf   : Current configurations of the gas sensor.
- * @param[in,out] dev : Structure instance of bme69x_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_get_heatr_conf(const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev);
-
-/*!
- * \ingroup bme69xApiSystem
- * \page bme69x_api_bme69x_selftest_check bme69x_selftest_check
- * \code
- * int8_t bme69x_selftest_check(const struct bme69x_dev *dev);
- * \endcode
- * @details This API performs Self-test of low gas variant of BME69X
- *
- * @param[in, out]   dev  : Structure instance of bme69x_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-int8_t bme69x_selftest_check(const struct bme69x_dev *dev);
-
-#ifdef __cplusplus
-}
-#endif /* End of CPP guard */
-#endif /* BME69X_H_ */
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bme69x.h
+* @date       2025-07-15
+* @version    v1.0.3
+*
+*/
+
+#ifndef BME69X_H_
+#define BME69X_H_
+
+#include "bme69x_defs.h"
+
+/* CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiInit Initialization
+ * @brief Initialize the sensor and device structure
+ */
+
+/*!
+ * \ingroup bme69xApiInit
+ * \page bme69x_api_bme69x_init bme69x_init
+ * \code
+ * int8_t bme69x_init(struct bme69x_dev *dev);
+ * \endcode
+ * @details This API reads the chip-id of the sensor which is the first step to
+ * verify the sensor and also calibrates the sensor
+ * As this API is the entry point, call this API before using other APIs.
+ * The feature selection in bme69x_dev.features and the acquisition
+ * statistics in bme69x_dev.acq are cleared, select features after this API.
+ *
+ * @param[in,out] dev : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_init(struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiInit
+ * \page bme69x_api_bme69x_init_warm bme69x_init_warm
+ * \code
+ * int8_t bme69x_init_warm(struct bme69x_dev *dev, struct bme69x_warm_blob *blob);
+ * \endcode
+ * @details This API is the entry point of a restarting process, in place of
+ * bme69x_init. It resets the sensor and reads its unique ID only. If the blob
+ * is intact and was saved from the same sensor, the chip ID, the variant ID
+ * and the calibration data are taken from it and the coefficient registers
+ * are not read. Otherwise the sensor is initialized as with bme69x_init and
+ * the blob is rebuilt, to be stored again by the caller.
+ *
+ * @param[in,out] dev  : Structure instance of bme69x_dev
+ * @param[in,out] blob : Warm start blob, see bme69x_warm_save
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success, initialized from the blob
+ * @retval > 0 -> Warning, BME69X_W_WARM_MISS if the blob was rebuilt
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_init_warm(struct bme69x_dev *dev, struct bme69x_warm_blob *blob);
+
+/*!
+ * \ingroup bme69xApiInit
+ * \page bme69x_api_bme69x_warm_save bme69x_warm_save
+ * \code
+ * int8_t bme69x_warm_save(struct bme69x_warm_blob *blob, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API saves the identity and the calibration data of an
+ * initialized sensor into a warm start blob, keyed by its unique ID and
+ * protected by a checksum. The blob is stored as it is by the caller, one per
+ * sensor, and given to bme69x_init_warm on the next start.
+ *
+ * @param[out] blob   : Warm start blob
+ * @param[in,out] dev : Structure instance of bme69x_dev, initialized
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_warm_save(struct bme69x_warm_blob *blob, struct bme69x_dev *dev);
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiRegister Registers
+ * @brief Generic API for accessing sensor registers
+ */
+
+/*!
+ * \ingroup bme69xApiRegister
+ * \page bme69x_api_bme69x_set_regs bme69x_set_regs
+ * \code
+ * int8_t bme69x_set_regs(const uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev)
+ * \endcode
+ * @details This API writes the given data to the register address of the sensor
+ *
+ * @param[in] reg_addr : Register addresses to where the data is to be written
+ * @param[in] reg_data : Pointer to data buffer which is to be written
+ *                       in the reg_addr of sensor.
+ * @param[in] len      : No of bytes of data to write
+ * @param[in,out] dev  : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_set_regs(const uint8_t *reg_addr, const uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiRegister
+ * \page bme69x_api_bme69x_get_regs bme69x_get_regs
+ * \code
+ * int8_t bme69x_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev)
+ * \endcode
+ * @details This API reads the data from the given register address of sensor.
+ *
+ * @param[in] reg_addr  : Register address from where the data to be read
+ * @param[out] reg_data : Pointer to data buffer to store the read data.
+ * @param[in] len       : No of bytes of data to be read.
+ * @param[in,out] dev   : Structure instance of bme69x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bme69x_dev *dev);
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiSystem System
+ * @brief API that performs system-level operations
+ */
+
+/*!
+ * \ingroup bme69xApiSystem
+ * \page bme69x_api_bme69x_soft_reset bme69x_soft_reset
+ * \code
+ * int8_t bme69x_soft_reset(struct bme69x_dev *dev);
+ * \endcode
+ * @details This API soft-resets the sensor. The shadow register cache is
+ * invalidated, as the reset restores the default register values.
+ *
+ * @param[in,out] dev : Structure instance of bme69x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_soft_reset(struct bme69x_dev *dev);
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiOm Operation mode
+ * @brief API to configure operation mode
+ */
+
+/*!
+ * \ingroup bme69xApiOm
+ * \page bme69x_api_bme69x_set_op_mode bme69x_set_op_mode
+ * \code
+ * int8_t bme69x_set_op_mode(const uint8_t op_mode, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API is used to set the operation mode of the sensor
+ * @param[in] op_mode : Desired operation mode.
+ * @param[in] dev     : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_set_op_mode(const uint8_t op_mode, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiOm
+ * \page bme69x_api_bme69x_get_op_mode bme69x_get_op_mode
+ * \code
+ * int8_t bme69x_get_op_mode(uint8_t *op_mode, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API is used to get the operation mode of the sensor.
+ *
+ * @param[out] op_mode : Desired operation mode.
+ * @param[in,out] dev : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_get_op_mode(uint8_t *op_mode, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiConfig
+ * \page bme69x_api_bme69x_get_meas_dur bme69x_get_meas_dur
+ * \code
+ * uint32_t bme69x_get_meas_dur(const uint8_t op_mode, struct bme69x_conf *conf, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API is used to get the remaining duration that can be used for heating.
+ *
+ * @param[in] op_mode : Desired operation mode.
+ * @param[in] conf    : Desired sensor configuration.
+ * @param[in] dev     : Structure instance of bme69x_dev
+ *
+ * @return Measurement duration calculated in microseconds
+ */
+uint32_t bme69x_get_meas_dur(const uint8_t op_mode, struct bme69x_conf *conf, struct bme69x_dev *dev);
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiData Data Read out
+ * @brief Read our data from the sensor
+ */
+
+/*!
+ * \ingroup bme69xApiData
+ * \page bme69x_api_bme69x_get_data bme69x_get_data
+ * \code
+ * int8_t bme69x_get_data(uint8_t op_mode, struct bme69x_data *data, uint8_t *n_data, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API reads the pressure, temperature and humidity and gas data
+ * from the sensor, compensates the data and store it in the bme69x_data
+ * structure instance passed by the user.
+ *
+ * In parallel and sequential mode, data has to hold 3 instances. The n_data
+ * fields holding new data come first, from the oldest to the newest sample.
+ * The remaining instances are filled with the already read fields, unless
+ * BME69X_FEAT_NEW_FIELDS_ONLY is selected in bme69x_dev.features, in which
+ * case they are left untouched.
+ *
+ * With BME69X_FEAT_TIMESTAMP selected, every instance is timestamped by
+ * bme69x_dev.get_time_ns with the completion of the burst read of its field,
+ * before the compensation.
+ *
+ * @param[in]  op_mode : Expected operation mode.
+ * @param[out] data    : Structure instance to hold the data.
+ * @param[out] n_data  : Number of data instances available.
+ * @param[in,out] dev  : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_get_data(uint8_t op_mode, struct bme69x_data *data, uint8_t *n_data, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiData
+ * \page bme69x_api_bme69x_wait_data bme69x_wait_data
+ * \code
+ * int8_t bme69x_wait_data(uint8_t op_mode, struct bme69x_conf *conf, const struct bme69x_heatr_conf *heatr_conf,
+ *                         struct bme69x_dev *dev);
+ * \endcode
+ * @details This API waits for a triggered forced mode measurement to complete.
+ * It sleeps for the duration predicted by bme69x_get_meas_dur and the heater
+ * duration, corrected by the skew learnt on the previous waits, then polls the
+ * 1-byte status register until new data is flagged. bme69x_get_data can then
+ * read the data with a single burst. The poll counts are kept in dev->acq.
+ *
+ * @param[in] op_mode    : Operation mode, only BME69X_FORCED_MODE is supported.
+ * @param[in] conf       : Sensor configuration of the measurement.
+ * @param[in] heatr_conf : Heater configuration of the measurement, can be NULL.
+ * @param[in,out] dev    : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BME69X_W_NO_NEW_DATA if the polls ran out
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_wait_data(uint8_t op_mode,
+                        struct bme69x_conf *conf,
+                        const struct bme69x_heatr_conf *heatr_conf,
+                        struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiData
+ * \page bme69x_api_bme69x_parse_field bme69x_parse_field
+ * \code
+ * int8_t bme69x_parse_field(const uint8_t *field, struct bme69x_raw_field *raw);
+ * \endcode
+ * @details This API parses the BME69X_LEN_FIELD registers of one data field,
+ * starting at BME69X_REG_FIELD0, into raw ADC values. The heater values are
+ * not part of the field registers and are cleared.
+ *
+ * @param[in] field : Field registers
+ * @param[out] raw  : Structure instance to hold the raw values.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_parse_field(const uint8_t *field, struct bme69x_raw_field *raw);
+
+/*!
+ * \ingroup bme69xApiData
+ * \page bme69x_api_bme69x_compensate bme69x_compensate
+ * \code
+ * int8_t bme69x_compensate(const struct bme69x_calib_data *calib, const struct bme69x_raw_field *raw,
+ *                          struct bme69x_data *data);
+ * \endcode
+ * @details This API compensates the raw data of one field, as done by
+ * bme69x_get_data. It only reads the calibration coefficients and keeps no
+ * state, so several threads can compensate with the same calibration at once,
+ * apart from the thread reading the sensor.
+ *
+ * @param[in] calib : Calibration coefficients, e.g. bme69x_dev.calib
+ * @param[in] raw   : Raw values of the field
+ * @param[out] data : Structure instance to hold the data.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_compensate(const struct bme69x_calib_data *calib,
+                         const struct bme69x_raw_field *raw,
+                         struct bme69x_data *data);
+
+/*!
+ * \ingroup bme69xApiData
+ * \page bme69x_api_bme69x_get_coeff bme69x_get_coeff
+ * \code
+ * int8_t bme69x_get_coeff(uint8_t *coeff, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API reads the BME69X_LEN_COEFF_ALL bytes of the calibration
+ * coefficient registers, e.g. to store them along with raw data fields.
+ *
+ * @param[out] coeff  : Buffer of BME69X_LEN_COEFF_ALL bytes
+ * @param[in,out] dev : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_get_coeff(uint8_t *coeff, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiData
+ * \page bme69x_api_bme69x_parse_calib bme69x_parse_calib
+ * \code
+ * int8_t bme69x_parse_calib(const uint8_t *coeff, struct bme69x_calib_data *calib);
+ * \endcode
+ * @details This API parses calibration coefficient registers read with
+ * bme69x_get_coeff into a calibration block, including its derived constants,
+ * as bme69x_init does for bme69x_dev.calib.
+ *
+ * @param[in] coeff  : Buffer of BME69X_LEN_COEFF_ALL bytes
+ * @param[out] calib : Calibration coefficients
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_parse_calib(const uint8_t *coeff, struct bme69x_calib_data *calib);
+
+/*!
+ * \ingroup bme69xApiData
+ * \page bme69x_api_bme69x_derive_calib bme69x_derive_calib
+ * \code
+ * int8_t bme69x_derive_calib(struct bme69x_calib_data *calib);
+ * \endcode
+ * @details This API computes the constants of calib->derived from the
+ * calibration coefficients, so that the compensation does no divisions by
+ * calibration values per sample. bme69x_init calls it, call it again after
+ * filling or correcting a calibration block, e.g. before bme69x_compensate_batch.
+ *
+ * @param[in,out] calib : Calibration coefficients
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_derive_calib(struct bme69x_calib_data *calib);
+
+/*!
+ * \ingroup bme69xApiData
+ * \page bme69x_api_bme69x_compensate_batch bme69x_compensate_batch
+ * \code
+ * int8_t bme69x_compensate_batch(const struct bme69x_calib_data *calib, const struct bme69x_raw_batch *raw,
+ *                                struct bme69x_data *data, uint32_t n);
+ * \endcode
+ * @details This API compensates arrays of raw ADC samples, for example frames
+ * stored for offline processing. The same computation as in bme69x_get_data is
+ * used, so the results are bit-identical to those of the driver. Only the
+ * temperature, pressure, humidity and gas resistance of the output are written.
+ * In the floating point build, temperature and pressure are computed by SSE2 or
+ * AVX2 (selected at run time) or NEON kernels where available, define
+ * BME69X_DO_NOT_USE_SIMD to disable them. The kernels stay bit-identical to the
+ * scalar code as long as floating point contraction is off, the default of GCC
+ * with -std=c99.
+ *
+ * @param[in] calib : Calibration coefficients with up to date derived constants,
+ *                    e.g. bme69x_dev.calib
+ * @param[in] raw   : Raw ADC samples, every array holds at least n values.
+ * @param[out] data : Array of n structure instances to hold the compensated data.
+ * @param[in] n     : Number of samples.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_compensate_batch(const struct bme69x_calib_data *calib,
+                               const struct bme69x_raw_batch *raw,
+                               struct bme69x_data *data,
+                               uint32_t n);
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiRing Raw frame ring
+ * @brief Lock-free single-producer single-consumer ring of raw frames. The
+ * acquisition thread only reads and pushes frames, the consumer pops and
+ * compensates them, so a slow consumer never delays the bus.
+ */
+
+/*!
+ * \ingroup bme69xApiRing
+ * \page bme69x_api_bme69x_ring_init bme69x_ring_init
+ * \code
+ * int8_t bme69x_ring_init(struct bme69x_ring *ring);
+ * \endcode
+ * @details This API initializes an empty ring.
+ *
+ * @param[out] ring : Ring of raw frames
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_ring_init(struct bme69x_ring *ring);
+
+/*!
+ * \ingroup bme69xApiRing
+ * \page bme69x_api_bme69x_ring_push bme69x_ring_push
+ * \code
+ * int8_t bme69x_ring_push(struct bme69x_ring *ring, const struct bme69x_frame *frame);
+ * \endcode
+ * @details This API pushes a frame, from the producer thread only. It never
+ * blocks, a frame pushed to a full ring is dropped and counted in n_dropped.
+ *
+ * @param[in,out] ring : Ring of raw frames
+ * @param[in] frame    : Frame to push
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BME69X_W_RING_FULL if the frame was dropped
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_ring_push(struct bme69x_ring *ring, const struct bme69x_frame *frame);
+
+/*!
+ * \ingroup bme69xApiRing
+ * \page bme69x_api_bme69x_ring_pop bme69x_ring_pop
+ * \code
+ * int8_t bme69x_ring_pop(struct bme69x_ring *ring, struct bme69x_frame *frame);
+ * \endcode
+ * @details This API pops the oldest frame, from the consumer thread only.
+ *
+ * @param[in,out] ring : Ring of raw frames
+ * @param[out] frame   : Popped frame
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BME69X_W_NO_NEW_DATA if the ring is empty
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_ring_pop(struct bme69x_ring *ring, struct bme69x_frame *frame);
+
+/*!
+ * \ingroup bme69xApiRing
+ * \page bme69x_api_bme69x_ring_acquire bme69x_ring_acquire
+ * \code
+ * int8_t bme69x_ring_acquire(uint8_t op_mode, uint64_t timestamp, struct bme69x_ring *ring, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API reads the data fields of the sensor in one burst and
+ * pushes the fields holding new data to the ring, oldest first, without
+ * compensating them. In parallel and sequential mode, the fields already
+ * pushed by an earlier call are skipped. The heater registers come from the shadow register cache
+ * when enabled. With BME69X_FEAT_TIMESTAMP, the frames are stamped with
+ * bme69x_dev.get_time_ns once the burst completed.
+ *
+ * @param[in] op_mode   : Expected operation mode.
+ * @param[in] timestamp : Monotonic timestamp of the frames in nanoseconds, used without BME69X_FEAT_TIMESTAMP
+ * @param[in,out] ring  : Ring of raw frames
+ * @param[in,out] dev   : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BME69X_W_NO_NEW_DATA or BME69X_W_RING_FULL
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_ring_acquire(uint8_t op_mode, uint64_t timestamp, struct bme69x_ring *ring, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiRing
+ * \page bme69x_api_bme69x_frame_compensate bme69x_frame_compensate
+ * \code
+ * int8_t bme69x_frame_compensate(const struct bme69x_calib_data *calib, const struct bme69x_frame *frame,
+ *                                struct bme69x_data *data);
+ * \endcode
+ * @details This API parses and compensates a raw frame, see bme69x_compensate.
+ *
+ * @param[in] calib : Calibration coefficients, e.g. bme69x_dev.calib
+ * @param[in] frame : Raw frame
+ * @param[out] data : Structure instance to hold the data.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_frame_compensate(const struct bme69x_calib_data *calib,
+                               const struct bme69x_frame *frame,
+                               struct bme69x_data *data);
+
+#ifndef BME69X_ONLY_FORCED
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiStream Measurement stream
+ * @brief Continuous read out in parallel and sequential mode. A stream
+ * remembers the last measurement read so that every measurement is emitted
+ * exactly once, and counts the ones that were lost.
+ */
+
+/*!
+ * \ingroup bme69xApiStream
+ * \page bme69x_api_bme69x_stream_init bme69x_stream_init
+ * \code
+ * int8_t bme69x_stream_init(struct bme69x_stream *stream);
+ * \endcode
+ * @details This API initializes a stream, the first read emits all the new
+ * data fields.
+ *
+ * @param[out] stream : Measurement stream
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_stream_init(struct bme69x_stream *stream);
+
+/*!
+ * \ingroup bme69xApiStream
+ * \page bme69x_api_bme69x_stream_read bme69x_stream_read
+ * \code
+ * int8_t bme69x_stream_read(struct bme69x_data *data, uint8_t *n_data, struct bme69x_stream *stream,
+ *                           struct bme69x_dev *dev);
+ * \endcode
+ * @details This API reads the measurements completed since the last read of
+ * the stream, from the oldest to the newest. Only the fields that can hold
+ * them are read, starting from the field following the last measurement.
+ * New data fields repeating an already emitted measurement are skipped and
+ * counted in n_duplicate, measurements overwritten before being read are
+ * counted in n_dropped. Read at least once every 3 measurements to lose none.
+ *
+ * @param[out] data      : Array of 3 structure instances to hold the data.
+ * @param[out] n_data    : Number of measurements emitted.
+ * @param[in,out] stream : Measurement stream
+ * @param[in,out] dev    : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BME69X_W_NO_NEW_DATA if no measurement was emitted
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_stream_read(struct bme69x_data *data, uint8_t *n_data, struct bme69x_stream *stream, struct bme69x_dev *dev);
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiSeq Sequential pipeline
+ * @brief Sequential mode read out one profile step at a time. Every
+ * measurement is read as soon as its step completes, and the heater slot it
+ * leaves is reloaded with a later step of the profile, so a profile can be
+ * longer than the 10 heater slots of the sensor.
+ */
+
+/*!
+ * \ingroup bme69xApiSeq
+ * \page bme69x_api_bme69x_seq_start bme69x_seq_start
+ * \code
+ * int8_t bme69x_seq_start(struct bme69x_conf *conf, const struct bme69x_heatr_conf *heatr_conf,
+ *                         struct bme69x_seq *seq, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API loads the first steps of a heater profile into the heater
+ * slots and starts the sequential mode. With a profile of up to 10 steps the
+ * sensor runs it as set by bme69x_set_heatr_conf. A longer profile rolls
+ * through the 10 slots: once a step is read by bme69x_seq_read, its slot is
+ * rewritten with the step the sensor reaches next on that slot, from register
+ * values computed while the step ran. The profile arrays have to stay valid
+ * while the pipeline runs, conf is the configuration set with bme69x_set_conf.
+ *
+ * @param[in] conf       : Sensor configuration
+ * @param[in] heatr_conf : Heater profile, profile_len steps of any length
+ * @param[out] seq       : Sequential pipeline
+ * @param[in,out] dev    : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_seq_start(struct bme69x_conf *conf,
+                        const struct bme69x_heatr_conf *heatr_conf,
+                        struct bme69x_seq *seq,
+                        struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiSeq
+ * \page bme69x_api_bme69x_seq_read bme69x_seq_read
+ * \code
+ * int8_t bme69x_seq_read(struct bme69x_data *data, uint8_t *step, struct bme69x_seq *seq);
+ * \endcode
+ * @details This API emits the next measurement of the pipeline and its step
+ * in the profile. The fields are read with a bme69x_stream, so each
+ * measurement is emitted once. When a read finds several new measurements,
+ * the later ones are emitted by the next calls without bus access.
+ *
+ * @param[out] data    : Structure instance to hold the data
+ * @param[out] step    : Profile step of the measurement
+ * @param[in,out] seq  : Sequential pipeline
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BME69X_W_NO_NEW_DATA if the step has not completed yet
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_seq_read(struct bme69x_data *data, uint8_t *step, struct bme69x_seq *seq);
+
+/*!
+ * \ingroup bme69xApiSeq
+ * \page bme69x_api_bme69x_seq_next_dur bme69x_seq_next_dur
+ * \code
+ * uint32_t bme69x_seq_next_dur(const struct bme69x_seq *seq);
+ * \endcode
+ * @details This API gets the duration of the step the sensor runs, to wait
+ * for before calling bme69x_seq_read. It is 0 while measurements read ahead
+ * are waiting to be emitted.
+ *
+ * @param[in] seq : Sequential pipeline
+ *
+ * @return Duration of the step in microseconds
+ */
+uint32_t bme69x_seq_next_dur(const struct bme69x_seq *seq);
+#endif
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiAsync Asynchronous operations
+ * @brief Non-blocking variants of bme69x_get_data and bme69x_set_heatr_conf.
+ * An operation runs as a sequence of transfers submitted one at a time
+ * through bme69x_dev.submit, register reads and writes, SPI memory page
+ * switches and waits alike. The transport completes each of them with
+ * bme69x_async_complete, so one event loop can keep several sensors and
+ * buses busy without a thread sleeping per sensor.
+ */
+
+/*!
+ * \ingroup bme69xApiAsync
+ * \page bme69x_api_bme69x_async_init bme69x_async_init
+ * \code
+ * int8_t bme69x_async_init(struct bme69x_async *op, bme69x_async_cb_t cb, void *arg, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API binds an asynchronous operation to a device and to the
+ * callback reporting the result of every operation started on it. One
+ * operation runs at a time on an instance.
+ *
+ * @param[out] op     : Asynchronous operation
+ * @param[in] cb      : Completion callback
+ * @param[in] arg     : User argument passed to the callback
+ * @param[in,out] dev : Structure instance of bme69x_dev, with submit set
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_async_init(struct bme69x_async *op, bme69x_async_cb_t cb, void *arg, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiAsync
+ * \page bme69x_api_bme69x_async_get_data bme69x_async_get_data
+ * \code
+ * int8_t bme69x_async_get_data(uint8_t op_mode, struct bme69x_data *data, uint8_t *n_data, struct bme69x_async *op);
+ * \endcode
+ * @details This API starts reading the sensor data, with the same outputs,
+ * polls and results as bme69x_get_data. The outputs have to stay valid until
+ * the callback is called.
+ *
+ * @param[in] op_mode : Expected operation mode.
+ * @param[out] data   : Structure instance to hold the data, an array of 3 in parallel and sequential mode.
+ * @param[out] n_data : Number of data instances available.
+ * @param[in,out] op  : Asynchronous operation
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success, the callback reports the result of the read
+ * @retval > 0 -> Warning, the read was not started
+ * @retval < 0 -> Fail, BME69X_E_BUSY if an operation already runs on op
+ */
+int8_t bme69x_async_get_data(uint8_t op_mode, struct bme69x_data *data, uint8_t *n_data, struct bme69x_async *op);
+
+/*!
+ * \ingroup bme69xApiAsync
+ * \page bme69x_api_bme69x_async_set_heatr_conf bme69x_async_set_heatr_conf
+ * \code
+ * int8_t bme69x_async_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_async *op);
+ * \endcode
+ * @details This API starts setting the heater configuration, writing the
+ * same registers as bme69x_set_heatr_conf after putting the sensor to sleep.
+ * The configuration has to stay valid until the callback is called.
+ *
+ * @param[in] op_mode : Expected operation mode.
+ * @param[in] conf    : Structure instance of the configuration.
+ * @param[in,out] op  : Asynchronous operation
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success, the callback reports the result of the configuration
+ * @retval < 0 -> Fail, BME69X_E_BUSY if an operation already runs on op
+ */
+int8_t bme69x_async_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_async *op);
+
+/*!
+ * \ingroup bme69xApiAsync
+ * \page bme69x_api_bme69x_async_complete bme69x_async_complete
+ * \code
+ * int8_t bme69x_async_complete(struct bme69x_async *op, BME69X_INTF_RET_TYPE intf_rslt);
+ * \endcode
+ * @details This API is called by the transport once the transfer it was
+ * given has been performed, with the result a blocking read or write would
+ * have returned, 0 for a wait. It submits the next transfer of the operation,
+ * or calls the completion callback when the operation is done.
+ *
+ * @param[in,out] op   : Asynchronous operation of the transfer
+ * @param[in] intf_rslt : Result of the transfer
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, no transfer of op was pending
+ */
+int8_t bme69x_async_complete(struct bme69x_async *op, BME69X_INTF_RET_TYPE intf_rslt);
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiConfig Configuration
+ * @brief Configuration API of sensor
+ */
+
+/*!
+ * \ingroup bme69xApiConfig
+ * \page bme69x_api_bme69x_set_conf bme69x_set_conf
+ * \code
+ * int8_t bme69x_set_conf(struct bme69x_conf *conf, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API is used to set the oversampling, filter and odr configuration
+ *
+ * @param[in] conf    : Desired sensor configuration.
+ * @param[in,out] dev : Structure instance of bme69x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_set_conf(struct bme69x_conf *conf, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiConfig
+ * \page bme69x_api_bme69x_get_conf bme69x_get_conf
+ * \code
+ * int8_t bme69x_get_conf(struct bme69x_conf *conf, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API is used to get the oversampling, filter and odr
+ * configuration
+ *
+ * @param[out] conf   : Present sensor configuration.
+ * @param[in,out] dev : Structure instance of bme69x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_get_conf(struct bme69x_conf *conf, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiConfig
+ * \page bme69x_api_bme69x_set_heatr_conf bme69x_set_heatr_conf
+ * \code
+ * int8_t bme69x_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API is used to set the gas configuration of the sensor.
+ *
+ * @param[in] op_mode : Expected operation mode of the sensor.
+ * @param[in] conf    : Desired heating configuration.
+ * @param[in,out] dev : Structure instance of bme69x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiConfig
+ * \page bme69x_api_bme69x_get_heatr_conf bme69x_get_heatr_conf
+ * \code
+ * int8_t bme69x_get_heatr_conf(const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API is used to get the gas configuration of the sensor.
+ *
+ * @param[out] conf   : Current configurations of the gas sensor.
+ * @param[in,out] dev : Structure instance of bme69x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_get_heatr_conf(const struct bme69x_heatr_conf *conf, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiConfig
+ * \page bme69x_api_bme69x_set_amb_temp bme69x_set_amb_temp
+ * \code
+ * int8_t bme69x_set_amb_temp(int8_t amb_temp,
+ *                            uint8_t op_mode,
+ *                            const struct bme69x_heatr_conf *conf,
+ *                            struct bme69x_dev *dev);
+ * \endcode
+ * @details This API sets bme69x_dev.amb_temp, e.g. from a measured temperature, and
+ * recomputes the heater resistance of every step of a heater configuration already
+ * set by bme69x_set_heatr_conf. Only the registers whose value changed are written,
+ * the sensor is not reconfigured otherwise. The values last written come from the
+ * shadow register cache when enabled, else from one burst read. The registers are
+ * written in sleep mode: a running forced measurement completes first and is not
+ * triggered again, a parallel or sequential mode is left and entered again once the
+ * new targets are written, restarting its heater profile. A bme69x_seq picks the new
+ * ambient temperature up at its next slot reloads, without this API.
+ *
+ * @param[in] amb_temp : Ambient temperature in degree C.
+ * @param[in] op_mode  : Operation mode the configuration was set for.
+ * @param[in] conf     : Heater configuration last set.
+ * @param[in,out] dev  : Structure instance of bme69x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BME69X_W_DEFINE_OP_MODE if op_mode has no heater profile
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_set_amb_temp(int8_t amb_temp,
+                           uint8_t op_mode,
+                           const struct bme69x_heatr_conf *conf,
+                           struct bme69x_dev *dev);
+
+/**
+ * \ingroup bme69x
+ * \defgroup bme69xApiTxn Configuration transactions
+ * @brief Stage the configuration and the heater profile in memory and write
+ * them in one go: a single sleep mode entry, a single read of the control
+ * registers and the fewest interleaved writes, instead of the separate
+ * sequences of bme69x_set_conf, bme69x_set_heatr_conf and bme69x_set_op_mode.
+ */
+
+/*!
+ * \ingroup bme69xApiTxn
+ * \page bme69x_api_bme69x_txn_begin bme69x_txn_begin
+ * \code
+ * int8_t bme69x_txn_begin(struct bme69x_txn *txn, struct bme69x_dev *dev);
+ * \endcode
+ * @details This API starts a configuration transaction on a device, with nothing staged.
+ *
+ * @param[out] txn    : Configuration transaction
+ * @param[in] dev     : Structure instance of bme69x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_txn_begin(struct bme69x_txn *txn, struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiTxn
+ * \page bme69x_api_bme69x_txn_set_conf bme69x_txn_set_conf
+ * \code
+ * int8_t bme69x_txn_set_conf(const struct bme69x_conf *conf, struct bme69x_txn *txn);
+ * \endcode
+ * @details This API stages the oversampling, filter and odr configuration,
+ * checked and written by bme69x_txn_commit as bme69x_set_conf does.
+ *
+ * @param[in] conf    : Desired configuration.
+ * @param[in,out] txn : Configuration transaction
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_txn_set_conf(const struct bme69x_conf *conf, struct bme69x_txn *txn);
+
+/*!
+ * \ingroup bme69xApiTxn
+ * \page bme69x_api_bme69x_txn_set_heatr_conf bme69x_txn_set_heatr_conf
+ * \code
+ * int8_t bme69x_txn_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_txn *txn);
+ * \endcode
+ * @details This API stages a heater configuration, as bme69x_set_heatr_conf
+ * would write it. The profiles are copied into the transaction.
+ *
+ * @param[in] op_mode : Operation mode of the heater configuration.
+ * @param[in] conf    : Desired heating configuration.
+ * @param[in,out] txn : Configuration transaction
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BME69X_W_DEFINE_OP_MODE for an invalid mode
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_txn_set_heatr_conf(uint8_t op_mode, const struct bme69x_heatr_conf *conf, struct bme69x_txn *txn);
+
+/*!
+ * \ingroup bme69xApiTxn
+ * \page bme69x_api_bme69x_txn_commit bme69x_txn_commit
+ * \code
+ * int8_t bme69x_txn_commit(uint8_t op_mode, struct bme69x_txn *txn);
+ * \endcode
+ * @details This API puts the sensor to sleep, writes the staged configuration
+ * and enters op_mode. The control registers are merged into one image and
+ * only the changed ones are written. With BME69X_FEAT_SHADOW_REGS, the heater
+ * registers already holding their value are skipped as well. The writes are
+ * grouped in bursts of up to 10 register pairs, BME69X_REG_CTRL_MEAS last so
+ * that the mode is entered once everything is configured. Nothing is written
+ * if a staged part is invalid. The staged parts are cleared on success.
+ *
+ * @param[in] op_mode : Operation mode to enter, BME69X_SLEEP_MODE to stay in sleep mode.
+ * @param[in,out] txn : Configuration transaction
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_txn_commit(uint8_t op_mode, struct bme69x_txn *txn);
+
+/*!
+ * \ingroup bme69xApiSystem
+ * \page bme69x_api_bme69x_selftest_check bme69x_selftest_check
+ * \code
+ * int8_t bme69x_selftest_check(const struct bme69x_dev *dev);
+ * \endcode
+ * @details This API performs Self-test of low gas variant of BME69X
+ *
+ * @param[in, out]   dev  : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_selftest_check(const struct bme69x_dev *dev);
+
+/*!
+ * \ingroup bme69xApiSystem
+ * \page bme69x_api_bme69x_selftest_run bme69x_selftest_run
+ * \code
+ * int8_t bme69x_selftest_run(struct bme69x_selftest *tests, const struct bme69x_dev *const *devs, uint8_t n_devs);
+ * \endcode
+ * @details This API runs the measurement sequence of bme69x_selftest_check
+ * on several devices at once. Every round configures and triggers the
+ * measurement of all the devices still passing, then waits once with the
+ * delay_us of the first of them, so the test of n devices takes about as
+ * long as the test of one. A device failing a round is left out of the
+ * next ones. The devices are expected to share the same time base.
+ *
+ * @param[out] tests  : Per-device reports, n_devs instances
+ * @param[in] devs    : Devices to test, n_devs instances
+ * @param[in] n_devs  : Number of devices
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success, every device passed
+ * @retval < 0 -> Fail, BME69X_E_SELF_TEST if a device failed, see bme69x_selftest.rslt
+ */
+int8_t bme69x_selftest_run(struct bme69x_selftest *tests, const struct bme69x_dev *const *devs, uint8_t n_devs);
+
+#ifdef BME69X_ENABLE_STATS
+
+/*!
+ * \ingroup bme69xApiSystem
+ * \page bme69x_api_bme69x_get_stats bme69x_get_stats
+ * \code
+ * int8_t bme69x_get_stats(struct bme69x_stats *stats, const struct bme69x_dev *dev);
+ * \endcode
+ * @details This API takes a snapshot of the hot path counters: the bus
+ * transactions and bytes of bme69x_get_regs, bme69x_set_regs and the memory
+ * page switches, the repeated polls, the failed transactions and the time
+ * requested from delay_us. The counters are cleared by bme69x_init and wrap
+ * around, the difference of two snapshots gives the activity in between.
+ * The traffic of bme69x_selftest_check runs on a copy of the device and is
+ * not counted. Only available when BME69X_ENABLE_STATS is defined.
+ *
+ * @param[out] stats : Structure instance of bme69x_stats
+ * @param[in] dev    : Structure instance of bme69x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme69x_get_stats(struct bme69x_stats *stats, const struct bme69x_dev *dev);
+#endif
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+#endif /* BME69X_H_ */
@@ -1,980 +1,1658 @@
-/**
-* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
-*
-* BSD-3-Clause
-*
-* Redistribution and use in source and binary forms, with or without
-* modification, are permitted provided that the following conditions are met:
-*
-* 1. Redistributions of source code must retain the above copyright
-*    notice, this list of conditions and the following disclaimer.
-*
-* 2. Redistributions in binary form must reproduce the above copyright
-*    notice, this list of conditions and the following disclaimer in the
-*    documentation and/or other materials provided with the distribution.
-*
-* 3. Neither the name of the copyright holder nor the names of its
-*    contributors may be used to endorse or promote products derived from
-*    this software without specific prior written permission.
-*
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
-* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
-* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
-* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
-* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
-* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
-* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
-* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-* POSSIBILITY OF SUCH DAMAGE.
-*
-* @file       bme69x_defs.h
-* @date       2025-07-15
-* @version    v1.0.3
-*
-*/
-
-/*! @cond DOXYGEN_SUPRESS */
-
-#ifndef BME69X_DEFS_H_
-#define BME69X_DEFS_H_
-
-/********************************************************* */
-/*!             Header includes                           */
-/********************************************************* */
-#ifdef __KERNEL__
-#include <linux/types.h>
-#include <linux/kernel.h>
-#else
-#include <stdint.h>
-#include <stddef.h>
-#endif
-
-/********************************************************* */
-/*!               Common Macros                           */
-/********************************************************* */
-#ifdef __KERNEL__
-#if !defined(UINT8_C) && !defined(INT8_C)
-#define INT8_C(x)    S8_C(x)
-#define UINT8_C(x)   U8_C(x)
-#endif
-
-#if !defined(UINT16_C) && !defined(INT16_C)
-#define INT16_C(x)   S16_C(x)
-#define UINT16_C(x)  U16_C(x)
-#endif
-
-#if !defined(INT32_C) && !defined(UINT32_C)
-#define INT32_C(x)   S32_C(x)
-#define UINT32_C(x)  U32_C(x)
-#endif
-
-#if !defined(INT64_C) && !defined(UINT64_C)
-#define INT64_C(x)   S64_C(x)
-#define UINT64_C(x)  U64_C(x)
-#endif
-#endif
-
-/*! C standard macros */
-#ifndef NULL
-#ifdef __cplusplus
-#define NULL         0
-#else
-#define NULL         ((void *) 0)
-#endif
-#endif
-
-#ifndef BME69X_DO_NOT_USE_FPU
-
-/* Comment or un-comment the macro to provide floating point data output */
-#define BME69X_USE_FPU
-#endif
-
-/* Period between two polls (value can be given by user) */
-#ifndef BME69X_PERIOD_POLL
-#define BME69X_PERIOD_POLL                        UINT32_C(10000)
-#endif
-
-/* BME69X unique chip identifier */
-#define BME69X_CHIP_ID                            UINT8_C(0x61)
-
-/* Period for a soft reset */
-#define BME69X_PERIOD_RESET                       UINT32_C(10000)
-
-/* BME69X lower I2C address */
-#define BME69X_I2C_ADDR_LOW                       UINT8_C(0x76)
-
-/* BME69X higher I2C address */
-#define BME69X_I2C_ADDR_HIGH                      UINT8_C(0x77)
-
-/* Soft reset command */
-#define BME69X_SOFT_RESET_CMD                     UINT8_C(0xb6)
-
-/* Return code definitions */
-/* Success */
-#define BME69X_OK                                 INT8_C(0)
-
-/* Errors */
-/* Null pointer passed */
-#define BME69X_E_NULL_PTR                         INT8_C(-1)
-
-/* Communication failure */
-#define BME69X_E_COM_FAIL                         INT8_C(-2)
-
-/* Sensor not found */
-#define BME69X_E_DEV_NOT_FOUND                    INT8_C(-3)
-
-/* Incorrect length parameter */
-#define BME69X_E_INVALID_LENGTH                   INT8_C(-4)
-
-/* Self test fail error */
-#define BME69X_E_SELF_TEST                        INT8_C(-5)
-
-/* Warnings */
-/* Define a valid operation mode */
-#define BME69X_W_DEFINE_OP_MODE                   INT8_C(1)
-
-/* No new data was found */
-#define BME69X_W_NO_NEW_DATA                      INT8_C(2)
-
-/* Define the shared heating duration */
-#define BME69X_W_DEFINE_SHD_HEATR_DUR             INT8_C(3)
-
-/* Information - only available via bme69x_dev.info_msg */
-#define BME69X_I_PARAM_CORR                       UINT8_C(1)
-
-/* Register map addresses in I2C */
-/* Register for 3rd group of coefficients */
-#define BME69X_REG_COEFF3                         UINT8_C(0x00)
-
-/* 0th Field address*/
-#define BME69X_REG_FIELD0                         UINT8_C(0x1d)
-
-/* 0th Current DAC address*/
-#define BME69X_REG_IDAC_HEAT0                     UINT8_C(0x50)
-
-/* 0th Res heat address */
-#define BME69X_REG_RES_HEAT0                      UINT8_C(0x5a)
-
-/* 0th Gas wait address */
-#define BME69X_REG_GAS_WAIT0                      UINT8_C(0x64)
-
-/* Shared heating duration address */
-#define BME69X_REG_SHD_HEATR_DUR                  UINT8_C(0x6E)
-
-/* CTRL_GAS_0 address */
-#define BME69X_REG_CTRL_GAS_0                     UINT8_C(0x70)
-
-/* CTRL_GAS_1 address */
-#define BME69X_REG_CTRL_GAS_1                     UINT8_C(0x71)
-
-/* CTRL_HUM address */
-#define BME69X_REG_CTRL_HUM                       UINT8_C(0x72)
-
-/* CTRL_MEAS address */
-#define BME69X_REG_CTRL_MEAS                      UINT8_C(0x74)
-
-/* CONFIG address */
-#define BME69X_REG_CONFIG                         UINT8_C(0x75)
-
-/* MEM_PAGE address */
-#define BME69X_REG_MEM_PAGE                       UINT8_C(0xf3)
-
-/* Unique ID address */
-#define BME69X_REG_UNIQUE_ID                      UINT8_C(0x83)
-
-/* Register for 1st group of coefficients */
-#define BME69X_REG_COEFF1                         UINT8_C(0x8a)
-
-/* Chip ID address */
-#define BME69X_REG_CHIP_ID                        UINT8_C(0xd0)
-
-/* Soft reset address */
-#define BME69X_REG_SOFT_RESET                     UINT8_C(0xe0)
-
-/* Register for 2nd group of coefficients */
-#define BME69X_REG_COEFF2                         UINT8_C(0xe1)
-
-/* Variant ID Register */
-#define BME69X_REG_VARIANT_ID                     UINT8_C(0xF0)
-
-/* Enable/Disable macros */
-
-/* Enable */
-#define BME69X_ENABLE                             UINT8_C(0x01)
-
-/* Disable */
-#define BME69X_DISABLE                            UINT8_C(0x00)
-
-/* Variant ID macros */
-
-/* Low Gas variant */
-#define BME69X_VARIANT_GAS_LOW                    UINT8_C(0x00)
-
-/* High Gas variant */
-#define BME69X_VARIANT_GAS_HIGH                   UINT8_C(0x01)
-
-/* BME69x Gas variant */
-#define BME690_VARIANT_GAS_HIGH                   UINT8_C(0x02)
-
-/* Oversampling setting macros */
-
-/* Switch off measurement */
-#define BME69X_OS_NONE                            UINT8_C(0)
-
-/* Perform 1 measurement */
-#define BME69X_OS_1X                              UINT8_C(1)
-
-/* Perform 2 measurements */
-#define BME69X_OS_2X                              UINT8_C(2)
-
-/* Perform 4 measurements */
-#define BME69X_OS_4X                              UINT8_C(3)
-
-/* Perform 8 measurements */
-#define BME69X_OS_8X                              UINT8_C(4)
-
-/* Perform 16 measurements */
-#define BME69X_OS_16X                             UINT8_C(5)
-
-/* IIR Filter settings */
-
-/* Switch off the filter */
-#define BME69X_FILTER_OFF                         UINT8_C(0)
-
-/* Filter coefficient of 2 */
-#define BME69X_FILTER_SIZE_1                      UINT8_C(1)
-
-/* Filter coefficient of 4 */
-#define BME69X_FILTER_SIZE_3                      UINT8_C(2)
-
-/* Filter coefficient of 8 */
-#define BME69X_FILTER_SIZE_7                      UINT8_C(3)
-
-/* Filter coefficient of 16 */
-#define BME69X_FILTER_SIZE_15                     UINT8_C(4)
-
-/* Filter coefficient of 32 */
-#define BME69X_FILTER_SIZE_31                     UINT8_C(5)
-
-/* Filter coefficient of 64 */
-#define BME69X_FILTER_SIZE_63                     UINT8_C(6)
-
-/* Filter coefficient of 128 */
-#define BME69X_FILTER_SIZE_127                    UINT8_C(7)
-
-/* ODR/Standby time macros */
-
-/* Standby time of 0.59ms */
-#define BME69X_ODR_0_59_MS                        UINT8_C(0)
-
-/* Standby time of 62.5ms */
-#define BME69X_ODR_62_5_MS                        UINT8_C(1)
-
-/* Standby time of 125ms */
-#define BME69X_ODR_125_MS                         UINT8_C(2)
-
-/* Standby time of 250ms */
-#define BME69X_ODR_250_MS                         UINT8_C(3)
-
-/* Standby time of 500ms */
-#define BME69X_ODR_500_MS                         UINT8_C(4)
-
-/* Standby time of 1s */
-#define BME69X_ODR_1000_MS                        UINT8_C(5)
-
-/* Standby time of 10ms */
-#define BME69X_ODR_10_MS                          UINT8_C(6)
-
-/* Standby time of 20ms */
-#define BME69X_ODR_20_MS                          UINT8_C(7)
-
-/* No standby time */
-#define BME69X_ODR_NONE                           UINT8_C(8)
-
-/* Operating mode macros */
-
-/* Sleep operation mode */
-#define BME69X_SLEEP_MODE                         UINT8_C(0)
-
-/* Forced operation mode */
-#define BME69X_FORCED_MODE                        UINT8_C(1)
-
-/* Parallel operation mode */
-#define BME69X_PARALLEL_MODE                      UINT8_C(2)
-
-/* Sequential operation mode */
-#define BME69X_SEQUENTIAL_MODE                    UINT8_C(3)
-
-/* SPI page macros */
-
-/* SPI memory page 0 */
-#define BME69X_MEM_PAGE0                          UINT8_C(0x10)
-
-/* SPI memory page 1 */
-#define BME69X_MEM_PAGE1                          UINT8_C(0x00)
-
-/* Coefficient index macros */
-
-/* Length for all coefficients */
-#define BME69X_LEN_COEFF_ALL                      UINT8_C(42)
-
-/* Length for 1st group of coefficients */
-#define BME69X_LEN_COEFF1                         UINT8_C(23)
-
-/* Length for 2nd group of coefficients */
-#define BME69X_LEN_COEFF2                         UINT8_C(14)
-
-/* Length for 3rd group of coefficients */
-#define BME69X_LEN_COEFF3                         UINT8_C(5)
-
-/* Length of the field */
-#define BME69X_LEN_FIELD                          UINT8_C(17)
-
-/* Length between two fields */
-#define BME69X_LEN_FIELD_OFFSET                   UINT8_C(17)
-
-/* Length of the configuration register */
-#define BME69X_LEN_CONFIG                         UINT8_C(5)
-
-/* Length of the interleaved buffer */
-#define BME69X_LEN_INTERLEAVE_BUFF                UINT8_C(20)
-
-/* Coefficient index macros */
-
-/* Coefficient T2 LSB position */
-#define BME69X_IDX_DTK1_C_LSB                     (0)
-
-/* Coefficient T2 MSB position */
-#define BME69X_IDX_DTK1_C_MSB                     (1)
-
-/* Coefficient T3 position */
-#define BME69X_IDX_DTK2_C                         (2)
-
-/* Coefficient P1 LSB position */
-#define BME69X_IDX_S_C_LSB                        (4)
-
-/* Coefficient P1 MSB position */
-#define BME69X_IDX_S_C_MSB                        (5)
-
-/* Coefficient P2 LSB position */
-#define BME69X_IDX_TK1S_C_LSB                     (6)
-
-/* Coefficient P2 MSB position */
-#define BME69X_IDX_TK1S_C_MSB                     (7)
-
-/* Coefficient P3 position */
-#define BME69X_IDX_TK2S_C                         (8)
-
-/* Coefficient TK3S position */
-#define BME69X_IDX_TK3S_C                         (9)
-
-/* Coefficient P4 LSB position */
-#define BME69X_IDX_O_C_LSB                        (10)
-
-/* Coefficient P4 MSB position */
-#define BME69X_IDX_O_C_MSB                        (11)
-
-/* Coefficient P5 LSB position */
-#define BME69X_IDX_TK10_C_LSB                     (12)
-
-/* Coefficient P5 MSB position */
-#define BME69X_IDX_TK10_C_MSB                     (13)
-
-/* Coefficient P7 position */
-#define BME69X_IDX_TK20_C                         (14)
-
-/* Coefficient P6 position */
-#define BME69X_IDX_TK30_C                         (15)
-
-/* Coefficient P8 LSB position */
-#define BME69X_IDX_NLS_C_LSB                      (18)
-
-/* Coefficient P8 MSB position */
-#define BME69X_IDX_NLS_C_MSB                      (19)
-
-/* Coefficient P9 LSB position */
-#define BME69X_IDX_TKNLS_C                        (20)
-
-/* Coefficient P10 position */
-#define BME69X_IDX_NLS3_C                         (21)
-
-/* Coefficient H2 MSB position */
-#define BME69X_IDX_S_H_MSB                        (23)
-
-/* Coefficient H2 LSB position */
-#define BME69X_IDX_S_H_LSB                        (24)
-
-/* Coefficient H1 LSB position */
-#define BME69X_IDX_O_H_LSB                        (24)
-
-/* Coefficient H1 MSB position */
-#define BME69X_IDX_O_H_MSB                        (25)
-
-/* Coefficient H3 position */
-#define BME69X_IDX_TK10H_C                        (26)
-
-/* Coefficient H4 position */
-#define BME69X_IDX_par_h4                         (27)
-
-/* Coefficient H5 position */
-#define BME69X_IDX_par_h3                         (28)
-
-/* Coefficient H6 position */
-#define BME69X_IDX_HLIN2_C                        (29)
-
-/* Coefficient H7 position */
-#define BME69X_IDX_TKHLIN2_C                      (30)
-
-/* Coefficient T1 LSB position */
-#define BME69X_IDX_DO_C_LSB                       (31)
-
-/* Coefficient T1 MSB position */
-#define BME69X_IDX_DO_C_MSB                       (32)
-
-/* Coefficient GH2 LSB position */
-#define BME69X_IDX_TKR_C_LSB                      (33)
-
-/* Coefficient GH2 MSB position */
-#define BME69X_IDX_TKR_C_MSB                      (34)
-
-/* Coefficient GH1 position */
-#define BME69X_IDX_RO_C                           (35)
-
-/* Coefficient GH3 position */
-#define BME69X_IDX_T_AMB_COMP                     (36)
-
-/* Coefficient res heat value position */
-#define BME69X_IDX_RES_HEAT_VAL                   (37)
-
-/* Coefficient res heat range position */
-#define BME69X_IDX_RES_HEAT_RANGE                 (39)
-
-/* Coefficient range switching error position */
-#define BME69X_IDX_RANGE_SW_ERR                   (41)
-
-/* Gas measurement macros */
-
-/* / * BME690 Heater Off Bit Position * / */
-#define BME69X_HCTRL                              (3)
-
-/* / * BME690 Run Gas Bit Position * / */
-#define BME69X_RUN_GAS                            (6)
-
-/* / * BME690 nb_Conv Bit Position * / */
-#define BME69X_NBCONV                             (3)
-
-/* Disable gas measurement */
-#define BME69X_DISABLE_GAS_MEAS                   UINT8_C(0x00)
-
-/* Enable gas measurement */
-#define BME69X_ENABLE_GAS_MEAS                    UINT8_C(0x01)
-
-/* Heater control macros */
-
-/* Enable heater */
-#define BME69X_ENABLE_HEATER                      UINT8_C(0x00)
-
-/* Disable heater */
-#define BME69X_DISABLE_HEATER                     UINT8_C(0x01)
-
-#ifdef BME69X_USE_FPU
-
-/* 0 degree Celsius */
-#define BME69X_MIN_TEMPERATURE                    INT16_C(0)
-
-/* 60 degree Celsius */
-#define BME69X_MAX_TEMPERATURE                    INT16_C(60)
-
-/* 900 hecto Pascals */
-#define BME69X_MIN_PRESSURE                       UINT32_C(90000)
-
-/* 1100 hecto Pascals */
-#define BME69X_MAX_PRESSURE                       UINT32_C(110000)
-
-/* 20% relative humidity */
-#define BME69X_MIN_HUMIDITY                       UINT32_C(20)
-
-/* 80% relative humidity*/
-#define BME69X_MAX_HUMIDITY                       UINT32_C(80)
-#else
-
-/* 0 degree Celsius */
-#define BME69X_MIN_TEMPERATURE                    INT16_C(0)
-
-/* 60 degree Celsius */
-#define BME69X_MAX_TEMPERATURE                    INT16_C(6000)
-
-/* 900 hecto Pascals */
-#define BME69X_MIN_PRESSURE                       UINT32_C(90000)
-
-/* 1100 hecto Pascals */
-#define BME69X_MAX_PRESSURE                       UINT32_C(110000)
-
-/* 20% relative humidity */
-#define BME69X_MIN_HUMIDITY                       UINT32_C(20000)
-
-/* 80% relative humidity*/
-#define BME69X_MAX_HUMIDITY                       UINT32_C(80000)
-
-#endif
-
-#define BME69X_HEATR_DUR1                         UINT16_C(1000)
-#define BME69X_HEATR_DUR2                         UINT16_C(2000)
-#define BME69X_HEATR_DUR1_DELAY                   UINT32_C(1000000)
-#define BME69X_HEATR_DUR2_DELAY                   UINT32_C(2000000)
-#define BME69X_N_MEAS                             UINT8_C(6)
-#define BME69X_LOW_TEMP                           UINT8_C(150)
-#define BME69X_HIGH_TEMP                          UINT16_C(350)
-
-/* Mask macros */
-/* Mask for number of conversions */
-#define BME69X_NBCONV_MSK                         UINT8_C(0X0f)
-
-/* Mask for IIR filter */
-#define BME69X_FILTER_MSK                         UINT8_C(0X1c)
-
-/* Mask for ODR[3] */
-#define BME69X_ODR3_MSK                           UINT8_C(0x80)
-
-/* Mask for ODR[2:0] */
-#define BME69X_ODR20_MSK                          UINT8_C(0xe0)
-
-/* Mask for temperature oversampling */
-#define BME69X_OST_MSK                            UINT8_C(0Xe0)
-
-/* Mask for pressure oversampling */
-#define BME69X_OSP_MSK                            UINT8_C(0X1c)
-
-/* Mask for humidity oversampling */
-#define BME69X_OSH_MSK                            UINT8_C(0X07)
-
-/* Mask for heater control */
-#define BME69X_HCTRL_MSK                          UINT8_C(0x08)
-
-/* Mask for run gas */
-#define BME69X_RUN_GAS_MSK                        UINT8_C(0x30)
-
-/* Mask for operation mode */
-#define BME69X_MODE_MSK                           UINT8_C(0x03)
-
-/* Mask for res heat range */
-#define BME69X_RHRANGE_MSK                        UINT8_C(0x30)
-
-/* Mask for range switching error */
-#define BME69X_RSERROR_MSK                        UINT8_C(0xf0)
-
-/* Mask for new data */
-#define BME69X_NEW_DATA_MSK                       UINT8_C(0x80)
-
-/* Mask for gas index */
-#define BME69X_GAS_INDEX_MSK                      UINT8_C(0x0f)
-
-/* Mask for gas range */
-#define BME69X_GAS_RANGE_MSK                      UINT8_C(0x0f)
-
-/* Mask for gas measurement valid */
-#define BME69X_GASM_VALID_MSK                     UINT8_C(0x20)
-
-/* Mask for heater stability */
-#define BME69X_HEAT_STAB_MSK                      UINT8_C(0x10)
-
-/* Mask for SPI memory page */
-#define BME69X_MEM_PAGE_MSK                       UINT8_C(0x10)
-
-/* Mask for reading a register in SPI */
-#define BME69X_SPI_RD_MSK                         UINT8_C(0x80)
-
-/* Mask for writing a register in SPI */
-#define BME69X_SPI_WR_MSK                         UINT8_C(0x7f)
-
-/* Mask for the H1 calibration coefficient */
-#define BME69X_BIT_H1_DATA_MSK                    UINT8_C(0x0f)
-
-/* Position macros */
-
-/* Filter bit position */
-#define BME69X_FILTER_POS                         UINT8_C(2)
-
-/* Temperature oversampling bit position */
-#define BME69X_OST_POS                            UINT8_C(5)
-
-/* Pressure oversampling bit position */
-#define BME69X_OSP_POS                            UINT8_C(2)
-
-/* ODR[3] bit position */
-#define BME69X_ODR3_POS                           UINT8_C(7)
-
-/* ODR[2:0] bit position */
-#define BME69X_ODR20_POS                          UINT8_C(5)
-
-/* Run gas bit position */
-#define BME69X_RUN_GAS_POS                        UINT8_C(5)
-
-/* Heater control bit position */
-#define BME69X_HCTRL_POS                          UINT8_C(3)
-
-/* Macro to combine two 8 bit data's to form a 16 bit data */
-#define BME69X_CONCAT_BYTES(msb, lsb)             (((uint16_t)msb << 8) | (uint16_t)lsb)
-
-/* Macro to set bits */
-#define BME69X_SET_BITS(reg_data, bitname, data) \
-    ((reg_data & ~(bitname##_MSK)) | \
-     ((data << bitname##_POS) & bitname##_MSK))
-
-/* Macro to get bits */
-#define BME69X_GET_BITS(reg_data, bitname)        ((reg_data & (bitname##_MSK)) >> \
-                                                   (bitname##_POS))
-
-/* Macro to set bits starting from position 0 */
-#define BME69X_SET_BITS_POS_0(reg_data, bitname, data) \
-    ((reg_data & ~(bitname##_MSK)) | \
-     (data & bitname##_MSK))
-
-/* Macro to get bits starting from position 0 */
-#define BME69X_GET_BITS_POS_0(reg_data, bitname)  (reg_data & (bitname##_MSK))
-
-/**
- * BME69X_INTF_RET_TYPE is the read/write interface return type which can be overwritten by the build system.
- * The default is set to int8_t.
- */
-#ifndef BME69X_INTF_RET_TYPE
-#define BME69X_INTF_RET_TYPE                      int8_t
-#endif
-
-/**
- * BME69X_INTF_RET_SUCCESS is the success return value read/write interface return type which can be
- * overwritten by the build system. The default is set to 0. It is used to check for a successful
- * execution of the read/write functions
- */
-#ifndef BME69X_INTF_RET_SUCCESS
-#define BME69X_INTF_RET_SUCCESS                   INT8_C(0)
-#endif
-
-/********************************************************* */
-/*!               Function Pointers                       */
-/********************************************************* */
-
-/*!
- * @brief Bus communication function pointer which should be mapped to
- * the platform specific read functions of the user
- *
- * @param[in]     reg_addr : 8bit register address of the sensor
- * @param[out]    reg_data : Data from the specified address
- * @param[in]     length   : Length of the reg_data array
- * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
- *                           for interface related callbacks
- * @retval 0 for Success
- * @retval Non-zero for Failure
- */
-typedef BME69X_INTF_RET_TYPE (*bme69x_read_fptr_t)(uint8_t reg_addr, uint8_t *reg_data, uint32_t length,
-                                                   void *intf_ptr);
-
-/*!
- * @brief Bus communication function pointer which should be mapped to
- * the platform specific write functions of the user
- *
- * @param[in]     reg_addr : 8bit register address of the sensor
- * @param[out]    reg_data : Data to the specified address
- * @param[in]     length   : Length of the reg_data array
- * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
- *                           for interface related callbacks
- * @retval 0 for Success
- * @retval Non-zero for Failure
- *
- */
-typedef BME69X_INTF_RET_TYPE (*bme69x_write_fptr_t)(uint8_t reg_addr, const uint8_t *reg_data, uint32_t length,
-                                                    void *intf_ptr);
-
-/*!
- * @brief Delay function pointer which should be mapped to
- * delay function of the user
- *
- * @param period - The time period in microseconds
- * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
- *                           for interface related callbacks
- */
-typedef void (*bme69x_delay_us_fptr_t)(uint32_t period, void *intf_ptr);
-
-/*
- * @brief Generic communication function pointer
- * @param[in] dev_id: Place holder to store the id of the device structure
- *                    Can be used to store the index of the Chip select or
- *                    I2C address of the device.
- * @param[in] reg_addr: Used to select the register the where data needs to
- *                      be read from or written to.
- * @param[in,out] reg_data: Data array to read/write
- * @param[in] len: Length of the data array
- */
-
-/*
- * @brief Interface selection Enumerations
- */
-enum bme69x_intf {
-    /*! SPI interface */
-    BME69X_SPI_INTF,
-    /*! I2C interface */
-    BME69X_I2C_INTF
-};
-
-/* Structure definitions */
-
-/*
- * @brief Sensor field data structure
- */
-struct bme69x_data
-{
-    /*! Contains new_data, gasm_valid & heat_stab */
-    uint8_t status;
-
-    /*! The index of the heater profile used */
-    uint8_t gas_index;
-
-    /*! Measurement index to track order */
-    uint8_t meas_index;
-
-    /*! Heater resistance */
-    uint8_t res_heat;
-
-    /*! Current DAC */
-    uint8_t idac;
-
-    /*! Gas wait period */
-    uint8_t gas_wait;
-#ifndef BME69X_USE_FPU
-
-    /*! Temperature in degree celsius x100 */
-    int16_t temperature;
-
-    /*! Pressure in Pascal */
-    uint32_t pressure;
-
-    /*! Humidity in % relative humidity x1000 */
-    uint32_t humidity;
-
-    /*! Gas resistance in Ohms */
-    uint32_t gas_resistance;
-
-    /*! Intermediate temperature co-efficient for pressure calculation */
-    uint32_t t_lin;
-#else
-
-    /*! Temperature in degree celsius */
-    float temperature;
-
-    /*! Pressure in Pascal */
-    float pressure;
-
-    /*! Humidity in % relative humidity x1000 */
-    float humidity;
-
-    /*! Gas resistance in Ohms */
-    float gas_resistance;
-
-#endif
-
-};
-
-struct bme69x_calib_data
-{
-    /*! Calibration coefficient for the humidity sensor */
-    int16_t par_h1;
-
-    /*! Calibration coefficient for the humidity sensor */
-    int8_t par_h2;
-
-    /*! Calibration coefficient for the humidity sensor */
-    uint8_t par_h3;
-
-    /*! Calibration coefficient for the humidity sensor */
-    int8_t par_h4;
-
-    /*! Calibration coefficient for the humidity sensor */
-    int16_t par_h5;
-
-    /*! Calibration coefficient for the humidity sensor */
-    uint8_t par_h6;
-
-    /*! Calibration coefficient for the gas sensor */
-    int8_t par_g1;
-
-    /*! Calibration coefficient for the gas sensor */
-    int16_t par_g2;
-
-    /*! Calibration coefficient for the gas sensor */
-    int8_t par_g3;
-
-    /*! Calibration coefficient for the temperature sensor */
-    uint16_t par_t1;
-
-    /*! Calibration coefficient for the temperature sensor */
-    uint16_t par_t2;
-
-    /*! Calibration coefficient for the temperature sensor */
-    int8_t par_t3;
-
-    /*! Calibration coefficient for the pressure sensor */
-    int16_t par_p5;
-
-    /*! Calibration coefficient for the pressure sensor */
-    int16_t par_p6;
-
-    /*! Calibration coefficient for the pressure sensor */
-    int8_t par_p7;
-
-    /*! Calibration coefficient for the pressure sensor */
-    int8_t par_p8;
-
-    /*! Calibration coefficient for the pressure sensor */
-    uint16_t par_p1;
-
-    /*! Calibration coefficient for the pressure sensor */
-    uint16_t par_p2;
-
-    /*! Calibration coefficient for the pressure sensor */
-    int8_t par_p3;
-
-    /*! Calibration coefficient for the pressure sensor */
-    int8_t par_p4;
-
-    /*! Calibration coefficient for the pressure sensor */
-    int16_t par_p9;
-
-    /*! Calibration coefficient for the pressure sensor */
-    int8_t par_p10;
-
-    int8_t par_p11;
-#ifndef BME69X_USE_FPU
-
-    /*! Variable to store the intermediate temperature coefficient */
-    int32_t t_fine;
-#else
-
-    /*! Variable to store the intermediate temperature coefficient */
-    float t_fine;
-#endif
-
-    /*! Heater resistance range coefficient */
-    uint8_t res_heat_range;
-
-    /*! Heater resistance value coefficient */
-    int8_t res_heat_val;
-
-    /*! Gas resistance range switching error coefficient */
-    int8_t range_sw_err;
-};
-
-/*
- * @brief BME69X sensor settings structure which comprises of ODR,
- * over-sampling and filter settings.
- */
-struct bme69x_conf
-{
-    /*! Humidity oversampling. Refer @ref osx*/
-    uint8_t os_hum;
-
-    /*! Temperature oversampling. Refer @ref osx */
-    uint8_t os_temp;
-
-    /*! Pressure oversampling. Refer @ref osx */
-    uint8_t os_pres;
-
-    /*! Filter coefficient. Refer @ref filter*/
-    uint8_t filter;
-
-    /*!
-     * Standby time between sequential mode measurement profiles.
-     * Refer @ref odr
-     */
-    uint8_t odr;
-};
-
-/*
- * @brief BME69X gas heater configuration
- */
-struct bme69x_heatr_conf
-{
-    /*! Enable gas measurement. Refer @ref en_dis */
-    uint8_t enable;
-
-    /*! Store the heater temperature for forced mode degree Celsius */
-    uint16_t heatr_temp;
-
-    /*! Store the heating duration for forced mode in milliseconds */
-    uint16_t heatr_dur;
-
-    /*! Store the heater temperature profile in degree Celsius */
-    uint16_t *heatr_temp_prof;
-
-    /*! Store the heating duration profile in milliseconds */
-    uint16_t *heatr_dur_prof;
-
-    /*! Variable to store the length of the heating profile */
-    uint8_t profile_len;
-
-    /*!
-     * Variable to store heating duration for parallel mode
-     * in milliseconds
-     */
-    uint16_t shared_heatr_dur;
-};
-
-/*
- * @brief BME69X device structure
- */
-struct bme69x_dev
-{
-    /*! Chip Id */
-    uint8_t chip_id;
-
-    /*!
-     * The interface pointer is used to enable the user
-     * to link their interface descriptors for reference during the
-     * implementation of the read and write interfaces to the
-     * hardware.
-     */
-    void *intf_ptr;
-
-    /*!
-     *             Variant id
-     * ----------------------------------------
-     *     Value   |           Variant
-     * ----------------------------------------
-     *      0      |   BME69X_VARIANT_GAS_LOW
-     *      1      |   BME69X_VARIANT_GAS_HIGH
-     * ----------------------------------------
-     */
-    uint32_t variant_id;
-
-    /*! SPI/I2C interface */
-    enum bme69x_intf intf;
-
-    /*! Memory page used */
-    uint8_t mem_page;
-
-    /*! Ambient temperature in Degree C*/
-    int8_t amb_temp;
-
-    /*! Sensor calibration data */
-    struct bme69x_calib_data calib;
-
-    /*! Read function pointer */
-    bme69x_read_fptr_t read;
-
-    /*! Write function pointer */
-    bme69x_write_fptr_t write;
-
-    /*! Delay function pointer */
-    bme69x_delay_us_fptr_t delay_us;
-
-    /*! To store interface pointer error */
-    BME69X_INTF_RET_TYPE intf_rslt;
-
-    /*! Store the info messages */
-    uint8_t info_msg;
-};
-
-#endif /* BME69X_DEFS_H_ */
-/*! @endcond */
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bme69x_defs.h
+* @date       2025-07-15
+* @version    v1.0.3
+*
+*/
+
+/*! @cond DOXYGEN_SUPRESS */
+
+#ifndef BME69X_DEFS_H_
+#define BME69X_DEFS_H_
+
+/********************************************************* */
+/*!             Header includes                           */
+/********************************************************* */
+#ifdef __KERNEL__
+#include <linux/types.h>
+#include <linux/kernel.h>
+#else
+#include <stdint.h>
+#include <stddef.h>
+#endif
+
+/********************************************************* */
+/*!               Common Macros                           */
+/********************************************************* */
+#ifdef __KERNEL__
+#if !defined(UINT8_C) && !defined(INT8_C)
+#define INT8_C(x)    S8_C(x)
+#define UINT8_C(x)   U8_C(x)
+#endif
+
+#if !defined(UINT16_C) && !defined(INT16_C)
+#define INT16_C(x)   S16_C(x)
+#define UINT16_C(x)  U16_C(x)
+#endif
+
+#if !defined(INT32_C) && !defined(UINT32_C)
+#define INT32_C(x)   S32_C(x)
+#define UINT32_C(x)  U32_C(x)
+#endif
+
+#if !defined(INT64_C) && !defined(UINT64_C)
+#define INT64_C(x)   S64_C(x)
+#define UINT64_C(x)  U64_C(x)
+#endif
+#endif
+
+/*! C standard macros */
+#ifndef NULL
+#ifdef __cplusplus
+#define NULL         0
+#else
+#define NULL         ((void *) 0)
+#endif
+#endif
+
+#ifndef BME69X_DO_NOT_USE_FPU
+
+/* Comment or un-comment the macro to provide floating point data output */
+#define BME69X_USE_FPU
+#endif
+
+#ifndef BME69X_DO_NOT_USE_SIMD
+
+/* Comment or un-comment the macro to use the vectorized kernels of bme69x_compensate_batch when available */
+#ifndef BME69X_USE_SIMD
+#define BME69X_USE_SIMD
+#endif
+#endif
+
+/* Define one of the macros to build the driver for a single interface, the paths of the other one are removed */
+/* #define BME69X_ONLY_I2C */
+/* #define BME69X_ONLY_SPI */
+#if defined(BME69X_ONLY_I2C) && defined(BME69X_ONLY_SPI)
+#error "BME69X_ONLY_I2C and BME69X_ONLY_SPI are exclusive"
+#endif
+
+/* Define the macro to build the driver for the forced mode only, the parallel and sequential mode paths are removed */
+/* #define BME69X_ONLY_FORCED */
+
+/* Define the macro to skip the bme69x_dev checks of the APIs, for callers only passing valid devices */
+/* #define BME69X_NO_DEV_CHECK */
+
+/* Name a header defining BME69X_INTF_READ, BME69X_INTF_WRITE and BME69X_INTF_DELAY_US to call fixed
+ * functions in place of bme69x_dev.read, write and delay_us, for the compiler to inline the transport.
+ * It can define BME69X_INTF_TIME_NS in place of bme69x_dev.get_time_ns as well, called whatever the features */
+/* #define BME69X_INTF_HEADER "bme69x_intf.h" */
+
+/* Define the macro to look the gas resistance up in a constant table of 4 KiB in place of a division per sample */
+/* #define BME69X_USE_GAS_LUT */
+
+/* Define the macro to keep the heater resistances of 0 to 400 degree C in bme69x_dev, rebuilt when
+ * bme69x_dev.amb_temp changes, in place of the divisions of every heater profile step */
+/* #define BME69X_USE_HEATR_LUT */
+
+/* Period between two polls (value can be given by user) */
+#ifndef BME69X_PERIOD_POLL
+#define BME69X_PERIOD_POLL                        UINT32_C(10000)
+#endif
+
+/* Period between two status register polls of bme69x_wait_data (value can be given by user) */
+#ifndef BME69X_PERIOD_STATUS_POLL
+#define BME69X_PERIOD_STATUS_POLL                 UINT32_C(500)
+#endif
+
+/* Maximum number of status register polls, same time budget as the field read retries */
+#define BME69X_STATUS_POLL_TRIES                  ((5 * BME69X_PERIOD_POLL) / BME69X_PERIOD_STATUS_POLL)
+
+/* Define the macro to count the bus traffic and waits of the driver in bme69x_dev.stats */
+/* #define BME69X_ENABLE_STATS */
+
+/* Number of frames of a bme69x_ring, a power of two (value can be given by user) */
+#ifndef BME69X_RING_LEN
+#define BME69X_RING_LEN                           UINT32_C(32)
+#endif
+
+/* BME69X unique chip identifier */
+#define BME69X_CHIP_ID                            UINT8_C(0x61)
+
+/* Format of a bme69x_warm_blob, follows the layout of bme69x_calib_data */
+#define BME69X_WARM_FORMAT                        (UINT32_C(0x57420000) | (uint32_t)sizeof(struct bme69x_calib_data))
+
+/* Period for a soft reset */
+#define BME69X_PERIOD_RESET                       UINT32_C(10000)
+
+/* BME69X lower I2C address */
+#define BME69X_I2C_ADDR_LOW                       UINT8_C(0x76)
+
+/* BME69X higher I2C address */
+#define BME69X_I2C_ADDR_HIGH                      UINT8_C(0x77)
+
+/* Soft reset command */
+#define BME69X_SOFT_RESET_CMD                     UINT8_C(0xb6)
+
+/* Return code definitions */
+/* Success */
+#define BME69X_OK                                 INT8_C(0)
+
+/* Errors */
+/* Null pointer passed */
+#define BME69X_E_NULL_PTR                         INT8_C(-1)
+
+/* Communication failure */
+#define BME69X_E_COM_FAIL                         INT8_C(-2)
+
+/* Sensor not found */
+#define BME69X_E_DEV_NOT_FOUND                    INT8_C(-3)
+
+/* Incorrect length parameter */
+#define BME69X_E_INVALID_LENGTH                   INT8_C(-4)
+
+/* Self test fail error */
+#define BME69X_E_SELF_TEST                        INT8_C(-5)
+
+/* Asynchronous operation already in progress */
+#define BME69X_E_BUSY                             INT8_C(-6)
+
+/* Warnings */
+/* Define a valid operation mode */
+#define BME69X_W_DEFINE_OP_MODE                   INT8_C(1)
+
+/* No new data was found */
+#define BME69X_W_NO_NEW_DATA                      INT8_C(2)
+
+/* Define the shared heating duration */
+#define BME69X_W_DEFINE_SHD_HEATR_DUR             INT8_C(3)
+
+/* Ring full, the frame was dropped */
+#define BME69X_W_RING_FULL                        INT8_C(4)
+
+/* Warm start blob did not match the sensor, it was rebuilt from a full init */
+#define BME69X_W_WARM_MISS                        INT8_C(5)
+
+/* Information - only available via bme69x_dev.info_msg */
+#define BME69X_I_PARAM_CORR                       UINT8_C(1)
+
+/* Feature macros - selected via bme69x_dev.features */
+/* Serve reads of the control and heater registers from the shadow register cache */
+#define BME69X_FEAT_SHADOW_REGS                   UINT8_C(0x01)
+
+/* Only output the fields holding new data in parallel and sequential mode */
+#define BME69X_FEAT_NEW_FIELDS_ONLY               UINT8_C(0x02)
+
+/* Timestamp the data read with bme69x_dev.get_time_ns */
+#define BME69X_FEAT_TIMESTAMP                     UINT8_C(0x04)
+
+/* Register map addresses in I2C */
+/* Register for 3rd group of coefficients */
+#define BME69X_REG_COEFF3                         UINT8_C(0x00)
+
+/* 0th Field address*/
+#define BME69X_REG_FIELD0                         UINT8_C(0x1d)
+
+/* 0th Current DAC address*/
+#define BME69X_REG_IDAC_HEAT0                     UINT8_C(0x50)
+
+/* 0th Res heat address */
+#define BME69X_REG_RES_HEAT0                      UINT8_C(0x5a)
+
+/* 0th Gas wait address */
+#define BME69X_REG_GAS_WAIT0                      UINT8_C(0x64)
+
+/* Shared heating duration address */
+#define BME69X_REG_SHD_HEATR_DUR                  UINT8_C(0x6E)
+
+/* CTRL_GAS_0 address */
+#define BME69X_REG_CTRL_GAS_0                     UINT8_C(0x70)
+
+/* CTRL_GAS_1 address */
+#define BME69X_REG_CTRL_GAS_1                     UINT8_C(0x71)
+
+/* CTRL_HUM address */
+#define BME69X_REG_CTRL_HUM                       UINT8_C(0x72)
+
+/* CTRL_MEAS address */
+#define BME69X_REG_CTRL_MEAS                      UINT8_C(0x74)
+
+/* CONFIG address */
+#define BME69X_REG_CONFIG                         UINT8_C(0x75)
+
+/* MEM_PAGE address */
+#define BME69X_REG_MEM_PAGE                       UINT8_C(0xf3)
+
+/* Unique ID address */
+#define BME69X_REG_UNIQUE_ID                      UINT8_C(0x83)
+
+/* Register for 1st group of coefficients */
+#define BME69X_REG_COEFF1                         UINT8_C(0x8a)
+
+/* Chip ID address */
+#define BME69X_REG_CHIP_ID                        UINT8_C(0xd0)
+
+/* Soft reset address */
+#define BME69X_REG_SOFT_RESET                     UINT8_C(0xe0)
+
+/* Register for 2nd group of coefficients */
+#define BME69X_REG_COEFF2                         UINT8_C(0xe1)
+
+/* Variant ID Register */
+#define BME69X_REG_VARIANT_ID                     UINT8_C(0xF0)
+
+/* Enable/Disable macros */
+
+/* Enable */
+#define BME69X_ENABLE                             UINT8_C(0x01)
+
+/* Disable */
+#define BME69X_DISABLE                            UINT8_C(0x00)
+
+/* Variant ID macros */
+
+/* Low Gas variant */
+#define BME69X_VARIANT_GAS_LOW                    UINT8_C(0x00)
+
+/* High Gas variant */
+#define BME69X_VARIANT_GAS_HIGH                   UINT8_C(0x01)
+
+/* BME69x Gas variant */
+#define BME690_VARIANT_GAS_HIGH                   UINT8_C(0x02)
+
+/* Oversampling setting macros */
+
+/* Switch off measurement */
+#define BME69X_OS_NONE                            UINT8_C(0)
+
+/* Perform 1 measurement */
+#define BME69X_OS_1X                              UINT8_C(1)
+
+/* Perform 2 measurements */
+#define BME69X_OS_2X                              UINT8_C(2)
+
+/* Perform 4 measurements */
+#define BME69X_OS_4X                              UINT8_C(3)
+
+/* Perform 8 measurements */
+#define BME69X_OS_8X                              UINT8_C(4)
+
+/* Perform 16 measurements */
+#define BME69X_OS_16X                             UINT8_C(5)
+
+/* IIR Filter settings */
+
+/* Switch off the filter */
+#define BME69X_FILTER_OFF                         UINT8_C(0)
+
+/* Filter coefficient of 2 */
+#define BME69X_FILTER_SIZE_1                      UINT8_C(1)
+
+/* Filter coefficient of 4 */
+#define BME69X_FILTER_SIZE_3                      UINT8_C(2)
+
+/* Filter coefficient of 8 */
+#define BME69X_FILTER_SIZE_7                      UINT8_C(3)
+
+/* Filter coefficient of 16 */
+#define BME69X_FILTER_SIZE_15                     UINT8_C(4)
+
+/* Filter coefficient of 32 */
+#define BME69X_FILTER_SIZE_31                     UINT8_C(5)
+
+/* Filter coefficient of 64 */
+#define BME69X_FILTER_SIZE_63                     UINT8_C(6)
+
+/* Filter coefficient of 128 */
+#define BME69X_FILTER_SIZE_127                    UINT8_C(7)
+
+/* ODR/Standby time macros */
+
+/* Standby time of 0.59ms */
+#define BME69X_ODR_0_59_MS                        UINT8_C(0)
+
+/* Standby time of 62.5ms */
+#define BME69X_ODR_62_5_MS                        UINT8_C(1)
+
+/* Standby time of 125ms */
+#define BME69X_ODR_125_MS                         UINT8_C(2)
+
+/* Standby time of 250ms */
+#define BME69X_ODR_250_MS                         UINT8_C(3)
+
+/* Standby time of 500ms */
+#define BME69X_ODR_500_MS                         UINT8_C(4)
+
+/* Standby time of 1s */
+#define BME69X_ODR_1000_MS                        UINT8_C(5)
+
+/* Standby time of 10ms */
+#define BME69X_ODR_10_MS                          UINT8_C(6)
+
+/* Standby time of 20ms */
+#define BME69X_ODR_20_MS                          UINT8_C(7)
+
+/* No standby time */
+#define BME69X_ODR_NONE                           UINT8_C(8)
+
+/* Operating mode macros */
+
+/* Sleep operation mode */
+#define BME69X_SLEEP_MODE                         UINT8_C(0)
+
+/* Forced operation mode */
+#define BME69X_FORCED_MODE                        UINT8_C(1)
+
+/* Parallel operation mode */
+#define BME69X_PARALLEL_MODE                      UINT8_C(2)
+
+/* Sequential operation mode */
+#define BME69X_SEQUENTIAL_MODE                    UINT8_C(3)
+
+/* SPI page macros */
+
+/* SPI memory page 0 */
+#define BME69X_MEM_PAGE0                          UINT8_C(0x10)
+
+/* SPI memory page 1 */
+#define BME69X_MEM_PAGE1                          UINT8_C(0x00)
+
+/* Coefficient index macros */
+
+/* Length for all coefficients */
+#define BME69X_LEN_COEFF_ALL                      UINT8_C(42)
+
+/* Length for 1st group of coefficients */
+#define BME69X_LEN_COEFF1                         UINT8_C(23)
+
+/* Length for 2nd group of coefficients */
+#define BME69X_LEN_COEFF2                         UINT8_C(14)
+
+/* Length for 3rd group of coefficients */
+#define BME69X_LEN_COEFF3                         UINT8_C(5)
+
+/* Length of the field */
+#define BME69X_LEN_FIELD                          UINT8_C(17)
+
+/* Length between two fields */
+#define BME69X_LEN_FIELD_OFFSET                   UINT8_C(17)
+
+/* Length of the configuration register */
+#define BME69X_LEN_CONFIG                         UINT8_C(5)
+
+/* Length of the interleaved buffer */
+#define BME69X_LEN_INTERLEAVE_BUFF                UINT8_C(20)
+
+/* Length of the shadow register cache, BME69X_REG_IDAC_HEAT0 to BME69X_REG_CONFIG and BME69X_REG_MEM_PAGE */
+#define BME69X_LEN_SHADOW                         UINT8_C(39)
+
+/* Length of the heater registers, BME69X_REG_IDAC_HEAT0 to BME69X_REG_SHD_HEATR_DUR excluded */
+#define BME69X_LEN_HEATR_REGS                     UINT8_C(30)
+
+/* Maximum number of registers written by a heater configuration, shared duration and two profiles */
+#define BME69X_LEN_HEATR_CONF                     UINT8_C(21)
+
+/* Length of the control registers, BME69X_REG_CTRL_GAS_0 up to BME69X_REG_CONFIG */
+#define BME69X_LEN_CTRL                           UINT8_C(6)
+
+/* Maximum number of registers written by a configuration transaction, heater and control registers */
+#define BME69X_LEN_TXN_REGS                       (BME69X_LEN_HEATR_CONF + BME69X_LEN_CTRL)
+
+/* Length of the unique ID */
+#define BME69X_LEN_UNIQUE_ID                      UINT8_C(4)
+
+/* Length of the gas resistance table, one entry per gas ADC value */
+#define BME69X_LEN_GAS_LUT                        UINT16_C(1024)
+
+/* Length of the heater resistance table, one entry per degree C up to the 400 degree C cap */
+#define BME69X_LEN_HEATR_LUT                      UINT16_C(401)
+
+/* Parts staged in a bme69x_txn */
+#define BME69X_TXN_CONF                           UINT8_C(0x01)
+#define BME69X_TXN_HEATR                          UINT8_C(0x02)
+
+/* Transfer types of a bme69x_xfer */
+#define BME69X_XFER_READ                          UINT8_C(0)
+#define BME69X_XFER_WRITE                         UINT8_C(1)
+#define BME69X_XFER_WAIT                          UINT8_C(2)
+
+/* Coefficient index macros */
+
+/* Coefficient T2 LSB position */
+#define BME69X_IDX_DTK1_C_LSB                     (0)
+
+/* Coefficient T2 MSB position */
+#define BME69X_IDX_DTK1_C_MSB                     (1)
+
+/* Coefficient T3 position */
+#define BME69X_IDX_DTK2_C                         (2)
+
+/* Coefficient P1 LSB position */
+#define BME69X_IDX_S_C_LSB                        (4)
+
+/* Coefficient P1 MSB position */
+#define BME69X_IDX_S_C_MSB                        (5)
+
+/* Coefficient P2 LSB position */
+#define BME69X_IDX_TK1S_C_LSB                     (6)
+
+/* Coefficient P2 MSB position */
+#define BME69X_IDX_TK1S_C_MSB                     (7)
+
+/* Coefficient P3 position */
+#define BME69X_IDX_TK2S_C                         (8)
+
+/* Coefficient TK3S position */
+#define BME69X_IDX_TK3S_C                         (9)
+
+/* Coefficient P4 LSB position */
+#define BME69X_IDX_O_C_LSB                        (10)
+
+/* Coefficient P4 MSB position */
+#define BME69X_IDX_O_C_MSB                        (11)
+
+/* Coefficient P5 LSB position */
+#define BME69X_IDX_TK10_C_LSB                     (12)
+
+/* Coefficient P5 MSB position */
+#define BME69X_IDX_TK10_C_MSB                     (13)
+
+/* Coefficient P7 position */
+#define BME69X_IDX_TK20_C                         (14)
+
+/* Coefficient P6 position */
+#define BME69X_IDX_TK30_C                         (15)
+
+/* Coefficient P8 LSB position */
+#define BME69X_IDX_NLS_C_LSB                      (18)
+
+/* Coefficient P8 MSB position */
+#define BME69X_IDX_NLS_C_MSB                      (19)
+
+/* Coefficient P9 LSB position */
+#define BME69X_IDX_TKNLS_C                        (20)
+
+/* Coefficient P10 position */
+#define BME69X_IDX_NLS3_C                         (21)
+
+/* Coefficient H2 MSB position */
+#define BME69X_IDX_S_H_MSB                        (23)
+
+/* Coefficient H2 LSB position */
+#define BME69X_IDX_S_H_LSB                        (24)
+
+/* Coefficient H1 LSB position */
+#define BME69X_IDX_O_H_LSB                        (24)
+
+/* Coefficient H1 MSB position */
+#define BME69X_IDX_O_H_MSB                        (25)
+
+/* Coefficient H3 position */
+#define BME69X_IDX_TK10H_C                        (26)
+
+/* Coefficient H4 position */
+#define BME69X_IDX_par_h4                         (27)
+
+/* Coefficient H5 position */
+#define BME69X_IDX_par_h3                         (28)
+
+/* Coefficient H6 position */
+#define BME69X_IDX_HLIN2_C                        (29)
+
+/* Coefficient H7 position */
+#define BME69X_IDX_TKHLIN2_C                      (30)
+
+/* Coefficient T1 LSB position */
+#define BME69X_IDX_DO_C_LSB                       (31)
+
+/* Coefficient T1 MSB position */
+#define BME69X_IDX_DO_C_MSB                       (32)
+
+/* Coefficient GH2 LSB position */
+#define BME69X_IDX_TKR_C_LSB                      (33)
+
+/* Coefficient GH2 MSB position */
+#define BME69X_IDX_TKR_C_MSB                      (34)
+
+/* Coefficient GH1 position */
+#define BME69X_IDX_RO_C                           (35)
+
+/* Coefficient GH3 position */
+#define BME69X_IDX_T_AMB_COMP                     (36)
+
+/* Coefficient res heat value position */
+#define BME69X_IDX_RES_HEAT_VAL                   (37)
+
+/* Coefficient res heat range position */
+#define BME69X_IDX_RES_HEAT_RANGE                 (39)
+
+/* Coefficient range switching error position */
+#define BME69X_IDX_RANGE_SW_ERR                   (41)
+
+/* Gas measurement macros */
+
+/* / * BME690 Heater Off Bit Position * / */
+#define BME69X_HCTRL                              (3)
+
+/* / * BME690 Run Gas Bit Position * / */
+#define BME69X_RUN_GAS                            (6)
+
+/* / * BME690 nb_Conv Bit Position * / */
+#define BME69X_NBCONV                             (3)
+
+/* Disable gas measurement */
+#define BME69X_DISABLE_GAS_MEAS                   UINT8_C(0x00)
+
+/* Enable gas measurement */
+#define BME69X_ENABLE_GAS_MEAS                    UINT8_C(0x01)
+
+/* Heater control macros */
+
+/* Enable heater */
+#define BME69X_ENABLE_HEATER                      UINT8_C(0x00)
+
+/* Disable heater */
+#define BME69X_DISABLE_HEATER                     UINT8_C(0x01)
+
+#ifdef BME69X_USE_FPU
+
+/* 0 degree Celsius */
+#define BME69X_MIN_TEMPERATURE                    INT16_C(0)
+
+/* 60 degree Celsius */
+#define BME69X_MAX_TEMPERATURE                    INT16_C(60)
+
+/* 900 hecto Pascals */
+#define BME69X_MIN_PRESSURE                       UINT32_C(90000)
+
+/* 1100 hecto Pascals */
+#define BME69X_MAX_PRESSURE                       UINT32_C(110000)
+
+/* 20% relative humidity */
+#define BME69X_MIN_HUMIDITY                       UINT32_C(20)
+
+/* 80% relative humidity*/
+#define BME69X_MAX_HUMIDITY                       UINT32_C(80)
+#else
+
+/* 0 degree Celsius */
+#define BME69X_MIN_TEMPERATURE                    INT16_C(0)
+
+/* 60 degree Celsius */
+#define BME69X_MAX_TEMPERATURE                    INT16_C(6000)
+
+/* 900 hecto Pascals */
+#define BME69X_MIN_PRESSURE                       UINT32_C(90000)
+
+/* 1100 hecto Pascals */
+#define BME69X_MAX_PRESSURE                       UINT32_C(110000)
+
+/* 20% relative humidity */
+#define BME69X_MIN_HUMIDITY                       UINT32_C(20000)
+
+/* 80% relative humidity*/
+#define BME69X_MAX_HUMIDITY                       UINT32_C(80000)
+
+#endif
+
+#define BME69X_HEATR_DUR1                         UINT16_C(1000)
+#define BME69X_HEATR_DUR2                         UINT16_C(2000)
+#define BME69X_HEATR_DUR1_DELAY                   UINT32_C(1000000)
+#define BME69X_HEATR_DUR2_DELAY                   UINT32_C(2000000)
+#define BME69X_N_MEAS                             UINT8_C(6)
+#define BME69X_LOW_TEMP                           UINT8_C(150)
+#define BME69X_HIGH_TEMP                          UINT16_C(350)
+
+/* Mask macros */
+/* Mask for number of conversions */
+#define BME69X_NBCONV_MSK                         UINT8_C(0X0f)
+
+/* Mask for IIR filter */
+#define BME69X_FILTER_MSK                         UINT8_C(0X1c)
+
+/* Mask for ODR[3] */
+#define BME69X_ODR3_MSK                           UINT8_C(0x80)
+
+/* Mask for ODR[2:0] */
+#define BME69X_ODR20_MSK                          UINT8_C(0xe0)
+
+/* Mask for temperature oversampling */
+#define BME69X_OST_MSK                            UINT8_C(0Xe0)
+
+/* Mask for pressure oversampling */
+#define BME69X_OSP_MSK                            UINT8_C(0X1c)
+
+/* Mask for humidity oversampling */
+#define BME69X_OSH_MSK                            UINT8_C(0X07)
+
+/* Mask for heater control */
+#define BME69X_HCTRL_MSK                          UINT8_C(0x08)
+
+/* Mask for run gas */
+#define BME69X_RUN_GAS_MSK                        UINT8_C(0x30)
+
+/* Mask for operation mode */
+#define BME69X_MODE_MSK                           UINT8_C(0x03)
+
+/* Mask for res heat range */
+#define BME69X_RHRANGE_MSK                        UINT8_C(0x30)
+
+/* Mask for range switching error */
+#define BME69X_RSERROR_MSK                        UINT8_C(0xf0)
+
+/* Mask for new data */
+#define BME69X_NEW_DATA_MSK                       UINT8_C(0x80)
+
+/* Mask for gas index */
+#define BME69X_GAS_INDEX_MSK                      UINT8_C(0x0f)
+
+/* Mask for gas range */
+#define BME69X_GAS_RANGE_MSK                      UINT8_C(0x0f)
+
+/* Mask for the 10-bit gas ADC value */
+#define BME69X_GAS_ADC_MSK                        UINT16_C(0x03ff)
+
+/* Mask for gas measurement valid */
+#define BME69X_GASM_VALID_MSK                     UINT8_C(0x20)
+
+/* Mask for heater stability */
+#define BME69X_HEAT_STAB_MSK                      UINT8_C(0x10)
+
+/* Mask for SPI memory page */
+#define BME69X_MEM_PAGE_MSK                       UINT8_C(0x10)
+
+/* Mask for reading a register in SPI */
+#define BME69X_SPI_RD_MSK                         UINT8_C(0x80)
+
+/* Mask for writing a register in SPI */
+#define BME69X_SPI_WR_MSK                         UINT8_C(0x7f)
+
+/* Mask for the H1 calibration coefficient */
+#define BME69X_BIT_H1_DATA_MSK                    UINT8_C(0x0f)
+
+/* Position macros */
+
+/* Filter bit position */
+#define BME69X_FILTER_POS                         UINT8_C(2)
+
+/* Temperature oversampling bit position */
+#define BME69X_OST_POS                            UINT8_C(5)
+
+/* Pressure oversampling bit position */
+#define BME69X_OSP_POS                            UINT8_C(2)
+
+/* ODR[3] bit position */
+#define BME69X_ODR3_POS                           UINT8_C(7)
+
+/* ODR[2:0] bit position */
+#define BME69X_ODR20_POS                          UINT8_C(5)
+
+/* Run gas bit position */
+#define BME69X_RUN_GAS_POS                        UINT8_C(5)
+
+/* Heater control bit position */
+#define BME69X_HCTRL_POS                          UINT8_C(3)
+
+/* Macro to combine two 8 bit data's to form a 16 bit data */
+#define BME69X_CONCAT_BYTES(msb, lsb)             (((uint16_t)msb << 8) | (uint16_t)lsb)
+
+/* Macro to set bits */
+#define BME69X_SET_BITS(reg_data, bitname, data) \
+    ((reg_data & ~(bitname##_MSK)) | \
+     ((data << bitname##_POS) & bitname##_MSK))
+
+/* Macro to get bits */
+#define BME69X_GET_BITS(reg_data, bitname)        ((reg_data & (bitname##_MSK)) >> \
+                                                   (bitname##_POS))
+
+/* Macro to set bits starting from position 0 */
+#define BME69X_SET_BITS_POS_0(reg_data, bitname, data) \
+    ((reg_data & ~(bitname##_MSK)) | \
+     (data & bitname##_MSK))
+
+/* Macro to get bits starting from position 0 */
+#define BME69X_GET_BITS_POS_0(reg_data, bitname)  (reg_data & (bitname##_MSK))
+
+/**
+ * BME69X_INTF_RET_TYPE is the read/write interface return type which can be overwritten by the build system.
+ * The default is set to int8_t.
+ */
+#ifndef BME69X_INTF_RET_TYPE
+#define BME69X_INTF_RET_TYPE                      int8_t
+#endif
+
+/**
+ * BME69X_INTF_RET_SUCCESS is the success return value read/write interface return type which can be
+ * overwritten by the build system. The default is set to 0. It is used to check for a successful
+ * execution of the read/write functions
+ */
+#ifndef BME69X_INTF_RET_SUCCESS
+#define BME69X_INTF_RET_SUCCESS                   INT8_C(0)
+#endif
+
+/********************************************************* */
+/*!               Function Pointers                       */
+/********************************************************* */
+
+/*!
+ * @brief Bus communication function pointer which should be mapped to
+ * the platform specific read functions of the user
+ *
+ * @param[in]     reg_addr : 8bit register address of the sensor
+ * @param[out]    reg_data : Data from the specified address
+ * @param[in]     length   : Length of the reg_data array
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ * @retval 0 for Success
+ * @retval Non-zero for Failure
+ */
+typedef BME69X_INTF_RET_TYPE (*bme69x_read_fptr_t)(uint8_t reg_addr, uint8_t *reg_data, uint32_t length,
+                                                   void *intf_ptr);
+
+/*!
+ * @brief Bus communication function pointer which should be mapped to
+ * the platform specific write functions of the user
+ *
+ * The API always places reg_addr in memory right ahead of reg_data, i.e.
+ * reg_data[-1] == reg_addr, so the address and the data can be sent from
+ * reg_data - 1 as one buffer of length + 1 bytes, without a copy.
+ *
+ * @param[in]     reg_addr : 8bit register address of the sensor
+ * @param[out]    reg_data : Data to the specified address
+ * @param[in]     length   : Length of the reg_data array
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ * @retval 0 for Success
+ * @retval Non-zero for Failure
+ *
+ */
+typedef BME69X_INTF_RET_TYPE (*bme69x_write_fptr_t)(uint8_t reg_addr, const uint8_t *reg_data, uint32_t length,
+                                                    void *intf_ptr);
+
+/*!
+ * @brief Delay function pointer which should be mapped to
+ * delay function of the user
+ *
+ * @param period - The time period in microseconds
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ */
+typedef void (*bme69x_delay_us_fptr_t)(uint32_t period, void *intf_ptr);
+
+/*!
+ * @brief Monotonic clock function pointer which should be mapped to
+ * a clock of the user that neither jumps nor wraps, e.g. CLOCK_MONOTONIC
+ *
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ * @return Current time in nanoseconds
+ */
+typedef uint64_t (*bme69x_time_ns_fptr_t)(void *intf_ptr);
+
+struct bme69x_xfer;
+struct bme69x_async;
+
+/*!
+ * @brief Asynchronous transfer function pointer which should be mapped to
+ * the platform specific transport of the user. It queues the transfer and
+ * returns right away, the transport then calls bme69x_async_complete with the
+ * result once the transfer is done, from its own context and never from
+ * within this function.
+ *
+ * @param[in]     xfer     : Transfer to perform, valid until its completion
+ * @param[in]     op       : Operation to complete
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ * @retval 0 for Success
+ * @retval Non-zero if the transfer could not be queued
+ */
+typedef BME69X_INTF_RET_TYPE (*bme69x_submit_fptr_t)(const struct bme69x_xfer *xfer, struct bme69x_async *op,
+                                                     void *intf_ptr);
+
+/*!
+ * @brief Completion callback of an asynchronous operation
+ *
+ * @param[in,out] op   : Completed operation, can be started again from the callback
+ * @param[in]     rslt : Result of the operation, as returned by the blocking API
+ * @param[in,out] arg  : User argument given to bme69x_async_init
+ */
+typedef void (*bme69x_async_cb_t)(struct bme69x_async *op, int8_t rslt, void *arg);
+
+/*
+ * @brief Generic communication function pointer
+ * @param[in] dev_id: Place holder to store the id of the device structure
+ *                    Can be used to store the index of the Chip select or
+ *                    I2C address of the device.
+ * @param[in] reg_addr: Used to select the register the where data needs to
+ *                      be read from or written to.
+ * @param[in,out] reg_data: Data array to read/write
+ * @param[in] len: Length of the data array
+ */
+
+/*
+ * @brief Interface selection Enumerations
+ */
+enum bme69x_intf {
+    /*! SPI interface */
+    BME69X_SPI_INTF,
+    /*! I2C interface */
+    BME69X_I2C_INTF
+};
+
+/* Structure definitions */
+
+/*
+ * @brief Sensor field data structure
+ */
+struct bme69x_data
+{
+    /*! Contains new_data, gasm_valid & heat_stab */
+    uint8_t status;
+
+    /*! The index of the heater profile used */
+    uint8_t gas_index;
+
+    /*! Measurement index to track order */
+    uint8_t meas_index;
+
+    /*! Heater resistance */
+    uint8_t res_heat;
+
+    /*! Current DAC */
+    uint8_t idac;
+
+    /*! Gas wait period */
+    uint8_t gas_wait;
+
+    /*! Time at which the field registers were read, in nanoseconds of bme69x_dev.get_time_ns, 0 unless
+     * BME69X_FEAT_TIMESTAMP is selected. Data compensated from a frame of bme69x_ring_acquire gets the timestamp of the frame,
+     * also in nanoseconds. */
+    uint64_t timestamp;
+#ifndef BME69X_USE_FPU
+
+    /*! Temperature in degree celsius x100 */
+    int16_t temperature;
+
+    /*! Pressure in Pascal */
+    uint32_t pressure;
+
+    /*! Humidity in % relative humidity x1000 */
+    uint32_t humidity;
+
+    /*! Gas resistance in Ohms */
+    uint32_t gas_resistance;
+
+    /*! Intermediate temperature co-efficient for pressure calculation */
+    uint32_t t_lin;
+#else
+
+    /*! Temperature in degree celsius */
+    float temperature;
+
+    /*! Pressure in Pascal */
+    float pressure;
+
+    /*! Humidity in % relative humidity x1000 */
+    float humidity;
+
+    /*! Gas resistance in Ohms */
+    float gas_resistance;
+
+#endif
+
+};
+
+/*
+ * @brief BME69X compensation constants derived from the calibration coefficients
+ */
+struct bme69x_calib_derived
+{
+#ifndef BME69X_USE_FPU
+
+    /*! Pressure offset term, par_p1 * 2^47 */
+    int64_t p1_off;
+
+    /*! Pressure sensitivity term, (par_p5 - 16384) * 2^46 */
+    int64_t p5_sens;
+
+    /*! Pressure non-linearity term, par_p9 * 2^16 */
+    int32_t p9_nl;
+
+    /*! Heater resistance divisor, 131 * res_heat_val + 65536 */
+    int32_t rh_var5;
+#else
+
+    /*! Temperature offset, par_t1 * 2^8 */
+    int32_t do1;
+
+    /*! Temperature coefficients */
+    double dtk1, dtk2;
+
+    /*! Pressure offset coefficients */
+    double o, tk10, tk20, tk30;
+
+    /*! Pressure sensitivity coefficients */
+    double s, tk1s, tk2s, tk3s;
+
+    /*! Pressure non-linearity coefficients */
+    double nls, tknls, nls3;
+
+    /*! Humidity coefficients, tk12sh = tk1sh * tk2sh */
+    double oh, sh, tk10h, tk1sh, tk12sh, hlin2;
+
+    /*! Heater resistance coefficients */
+    float rh_var1, rh_var2, rh_var3;
+
+    /*! Heater resistance range and value factors */
+    float rh_range, rh_val;
+#endif
+};
+
+struct bme69x_calib_data
+{
+    /*! Calibration coefficient for the humidity sensor */
+    int16_t par_h1;
+
+    /*! Calibration coefficient for the humidity sensor */
+    int8_t par_h2;
+
+    /*! Calibration coefficient for the humidity sensor */
+    uint8_t par_h3;
+
+    /*! Calibration coefficient for the humidity sensor */
+    int8_t par_h4;
+
+    /*! Calibration coefficient for the humidity sensor */
+    int16_t par_h5;
+
+    /*! Calibration coefficient for the humidity sensor */
+    uint8_t par_h6;
+
+    /*! Calibration coefficient for the gas sensor */
+    int8_t par_g1;
+
+    /*! Calibration coefficient for the gas sensor */
+    int16_t par_g2;
+
+    /*! Calibration coefficient for the gas sensor */
+    int8_t par_g3;
+
+    /*! Calibration coefficient for the temperature sensor */
+    uint16_t par_t1;
+
+    /*! Calibration coefficient for the temperature sensor */
+    uint16_t par_t2;
+
+    /*! Calibration coefficient for the temperature sensor */
+    int8_t par_t3;
+
+    /*! Calibration coefficient for the pressure sensor */
+    int16_t par_p5;
+
+    /*! Calibration coefficient for the pressure sensor */
+    int16_t par_p6;
+
+    /*! Calibration coefficient for the pressure sensor */
+    int8_t par_p7;
+
+    /*! Calibration coefficient for the pressure sensor */
+    int8_t par_p8;
+
+    /*! Calibration coefficient for the pressure sensor */
+    uint16_t par_p1;
+
+    /*! Calibration coefficient for the pressure sensor */
+    uint16_t par_p2;
+
+    /*! Calibration coefficient for the pressure sensor */
+    int8_t par_p3;
+
+    /*! Calibration coefficient for the pressure sensor */
+    int8_t par_p4;
+
+    /*! Calibration coefficient for the pressure sensor */
+    int16_t par_p9;
+
+    /*! Calibration coefficient for the pressure sensor */
+    int8_t par_p10;
+
+    int8_t par_p11;
+
+    /*! Heater resistance range coefficient */
+    uint8_t res_heat_range;
+
+    /*! Heater resistance value coefficient */
+    int8_t res_heat_val;
+
+    /*! Gas resistance range switching error coefficient */
+    int8_t range_sw_err;
+
+    /*! Constants derived from the coefficients above by bme69x_derive_calib */
+    struct bme69x_calib_derived derived;
+};
+
+/*
+ * @brief BME69X raw data of one field, as parsed from the field registers
+ */
+struct bme69x_raw_field
+{
+    /*! Contains new_data, gasm_valid & heat_stab */
+    uint8_t status;
+
+    /*! The index of the heater profile used */
+    uint8_t gas_index;
+
+    /*! Measurement index to track order */
+    uint8_t meas_index;
+
+    /*! Raw temperature ADC value */
+    uint32_t temp_adc;
+
+    /*! Raw pressure ADC value */
+    uint32_t pres_adc;
+
+    /*! Raw humidity ADC value */
+    uint16_t hum_adc;
+
+    /*! Raw 10-bit gas resistance ADC value */
+    uint16_t gas_adc;
+
+    /*! Gas resistance range */
+    uint8_t gas_range;
+
+    /*! Heater resistance of the heater profile used, not part of the field registers */
+    uint8_t res_heat;
+
+    /*! Current DAC of the heater profile used, not part of the field registers */
+    uint8_t idac;
+
+    /*! Gas wait period of the heater profile used, not part of the field registers */
+    uint8_t gas_wait;
+
+    /*! Time at which the field registers were read, in nanoseconds, not part of the field registers */
+    uint64_t timestamp;
+};
+
+/*
+ * @brief BME69X raw frame, one data field with the heater registers of its profile
+ */
+struct bme69x_frame
+{
+    /*! Time at which the field registers were read, in nanoseconds, see bme69x_ring_acquire */
+    uint64_t timestamp;
+
+    /*! Field registers, starting at the status register */
+    uint8_t field[BME69X_LEN_FIELD];
+
+    /*! Heater resistance of the heater profile used */
+    uint8_t res_heat;
+
+    /*! Current DAC of the heater profile used */
+    uint8_t idac;
+
+    /*! Gas wait period of the heater profile used */
+    uint8_t gas_wait;
+};
+
+/*
+ * @brief BME69X single-producer single-consumer ring of raw frames. The
+ * producer only writes head, n_dropped, last_index and started, the consumer
+ * only writes tail.
+ */
+struct bme69x_ring
+{
+    /*! Frames */
+    struct bme69x_frame frames[BME69X_RING_LEN];
+
+    /*! Number of frames pushed */
+    volatile uint32_t head;
+
+    /*! Number of frames popped */
+    volatile uint32_t tail;
+
+    /*! Number of frames dropped because the ring was full */
+    volatile uint32_t n_dropped;
+
+    /*! Sub-measurement index of the last acquired field */
+    uint8_t last_index;
+
+    /*! Whether a field was acquired since bme69x_ring_init */
+    uint8_t started;
+};
+
+/*
+ * @brief BME69X stream of parallel or sequential mode measurements
+ */
+struct bme69x_stream
+{
+    /*! Sub-measurement index of the last emitted measurement */
+    uint8_t last_index;
+
+    /*! Field expected to hold the next measurement */
+    uint8_t next_field;
+
+    /*! Number of fields read from next_field on */
+    uint8_t window;
+
+    /*! Set once a measurement has been emitted */
+    uint8_t started;
+
+    /*! Number of measurements emitted */
+    uint32_t n_emitted;
+
+    /*! Number of measurements overwritten by the sensor before being read */
+    uint32_t n_dropped;
+
+    /*! Number of new data fields repeating an emitted measurement */
+    uint32_t n_duplicate;
+};
+
+/*
+ * @brief BME69X sequential mode pipeline. The measurements are emitted one
+ * profile step at a time as they complete, and profiles longer than the 10
+ * heater slots roll through them, see bme69x_seq_start.
+ */
+struct bme69x_seq
+{
+    /*! Device running the profile */
+    struct bme69x_dev *dev;
+
+    /*! Stream the measurements are read from */
+    struct bme69x_stream stream;
+
+    /*! Heater temperatures of the profile in degree Celsius */
+    const uint16_t *temp_prof;
+
+    /*! Heating durations of the profile in milliseconds */
+    const uint16_t *dur_prof;
+
+    /*! Number of steps of the profile */
+    uint8_t profile_len;
+
+    /*! Number of heater slots in use, 10 at most */
+    uint8_t n_slots;
+
+    /*! Profile step of the next measurement */
+    uint8_t step;
+
+    /*! Heater slot of the next measurement */
+    uint8_t slot;
+
+    /*! TPH duration of a step in microseconds */
+    uint32_t tph_dur;
+
+    /*! Heater resistance register of the next slot reload, computed ahead */
+    uint8_t next_res_heat;
+
+    /*! Gas wait register of the next slot reload, computed ahead */
+    uint8_t next_gas_wait;
+
+    /*! Measurements read ahead, emitted by the next calls */
+    struct bme69x_data pending[3];
+
+    /*! Profile steps of the measurements read ahead */
+    uint8_t pending_step[3];
+
+    /*! Number of measurements read ahead */
+    uint8_t n_pending;
+
+    /*! Number of heater slots reloaded */
+    uint32_t n_reloads;
+};
+
+/*
+ * @brief BME69X raw ADC samples, one array per quantity
+ */
+struct bme69x_raw_batch
+{
+    /*! Raw 20-bit temperature ADC values, in a 24-bit register field */
+    const uint32_t *temp_adc;
+
+    /*! Raw 20-bit pressure ADC values, in a 24-bit register field */
+    const uint32_t *pres_adc;
+
+    /*! Raw 16-bit humidity ADC values */
+    const uint16_t *hum_adc;
+
+    /*! Raw 10-bit gas resistance ADC values */
+    const uint16_t *gas_adc;
+
+    /*! Gas resistance ranges */
+    const uint8_t *gas_range;
+};
+
+/*
+ * @brief BME69X sensor settings structure which comprises of ODR,
+ * over-sampling and filter settings.
+ */
+struct bme69x_conf
+{
+    /*! Humidity oversampling. Refer @ref osx*/
+    uint8_t os_hum;
+
+    /*! Temperature oversampling. Refer @ref osx */
+    uint8_t os_temp;
+
+    /*! Pressure oversampling. Refer @ref osx */
+    uint8_t os_pres;
+
+    /*! Filter coefficient. Refer @ref filter*/
+    uint8_t filter;
+
+    /*!
+     * Standby time between sequential mode measurement profiles.
+     * Refer @ref odr
+     */
+    uint8_t odr;
+};
+
+/*
+ * @brief BME69X gas heater configuration
+ */
+struct bme69x_heatr_conf
+{
+    /*! Enable gas measurement. Refer @ref en_dis */
+    uint8_t enable;
+
+    /*! Store the heater temperature for forced mode degree Celsius */
+    uint16_t heatr_temp;
+
+    /*! Store the heating duration for forced mode in milliseconds */
+    uint16_t heatr_dur;
+
+    /*! Store the heater temperature profile in degree Celsius */
+    uint16_t *heatr_temp_prof;
+
+    /*! Store the heating duration profile in milliseconds */
+    uint16_t *heatr_dur_prof;
+
+    /*! Variable to store the length of the heating profile */
+    uint8_t profile_len;
+
+    /*!
+     * Variable to store heating duration for parallel mode
+     * in milliseconds
+     */
+    uint16_t shared_heatr_dur;
+};
+
+/*
+ * @brief BME69X configuration transaction. The configuration and the heater
+ * profile are staged in memory and committed together, see bme69x_txn_commit.
+ */
+struct bme69x_txn
+{
+    /*! Device the transaction is committed to */
+    struct bme69x_dev *dev;
+
+    /*! Staged parts, BME69X_TXN_CONF and BME69X_TXN_HEATR */
+    uint8_t staged;
+
+    /*! Staged sensor configuration */
+    struct bme69x_conf conf;
+
+    /*! Staged heater configuration, its profiles point to temp_prof and dur_prof */
+    struct bme69x_heatr_conf heatr_conf;
+
+    /*! Operation mode of the staged heater configuration */
+    uint8_t heatr_mode;
+
+    /*! Copy of the heater temperature profile */
+    uint16_t temp_prof[10];
+
+    /*! Copy of the heater duration profile */
+    uint16_t dur_prof[10];
+};
+
+/*
+ * @brief BME69X transfer of an asynchronous operation
+ */
+struct bme69x_xfer
+{
+    /*! BME69X_XFER_READ, BME69X_XFER_WRITE or BME69X_XFER_WAIT */
+    uint8_t type;
+
+    /*! Register address, as passed to bme69x_read_fptr_t or bme69x_write_fptr_t */
+    uint8_t reg_addr;
+
+    /*! Data read or written */
+    uint8_t *reg_data;
+
+    /*! Length of reg_data */
+    uint32_t len;
+
+    /*! Duration of a wait in microseconds */
+    uint32_t period;
+};
+
+/*
+ * @brief BME69X asynchronous operation. Runs bme69x_get_data or
+ * bme69x_set_heatr_conf as a sequence of transfers submitted through
+ * bme69x_dev.submit, one at a time.
+ */
+struct bme69x_async
+{
+    /*! Device the operation runs on */
+    struct bme69x_dev *dev;
+
+    /*! Completion callback */
+    bme69x_async_cb_t cb;
+
+    /*! Argument of the completion callback */
+    void *arg;
+
+    /*! Set while the operation runs */
+    uint8_t busy;
+
+    /*! Set while a transfer is submitted */
+    uint8_t pending;
+
+    /*! Step of the operation */
+    uint8_t step;
+
+    /*! Step of the SPI memory page switch preceding the transfer, 0 if none */
+    uint8_t page_step;
+
+    /*! Operation mode */
+    uint8_t op_mode;
+
+    /*! Remaining polls */
+    uint8_t tries;
+
+    /*! Transfer in flight */
+    struct bme69x_xfer xfer;
+
+    /*! Transfer requested by the step, in I2C addressing. Preceded by the page switch on SPI */
+    struct bme69x_xfer req;
+
+    /*! Memory page register being written, preceded by its address, see bme69x_write_fptr_t */
+    uint8_t page_buff[2];
+
+    /*! Field registers */
+    uint8_t field[BME69X_LEN_FIELD * 3];
+
+    /*! Heater registers */
+    uint8_t heatr[BME69X_LEN_HEATR_REGS];
+
+    /*! Number of heater registers of the forced mode field read, up to 3 */
+    uint8_t heatr_pos;
+
+    /*! Control registers */
+    uint8_t ctrl[2];
+
+    /*! Register pairs to write */
+    uint8_t reg_addr[BME69X_LEN_HEATR_CONF];
+    uint8_t reg_data[BME69X_LEN_HEATR_CONF];
+
+    /*! Number of register pairs to write */
+    uint8_t n_regs;
+
+    /*! Next register pair to write */
+    uint8_t reg_pos;
+
+    /*! Register pairs of the write in flight */
+    uint8_t n_chunk;
+
+    /*! Interleaved buffer of the write in flight */
+    uint8_t wr_buff[BME69X_LEN_INTERLEAVE_BUFF];
+
+    /*! Number of gas conversions of the heater configuration */
+    uint8_t nb_conv;
+
+    /*! Raw fields */
+    struct bme69x_raw_field raw[3];
+
+    /*! Output data of bme69x_async_get_data */
+    struct bme69x_data *data;
+
+    /*! Output number of new fields of bme69x_async_get_data */
+    uint8_t *n_data;
+
+    /*! Heater configuration of bme69x_async_set_heatr_conf */
+    const struct bme69x_heatr_conf *heatr_conf;
+};
+
+/*
+ * @brief BME69X shadow register cache. Holds the last value read from or
+ * written to the heater, control and memory page registers.
+ */
+struct bme69x_shadow
+{
+    /*! One bit per register of regs, set when the cached value is valid */
+    uint64_t valid;
+
+    /*!
+     * Register values, BME69X_REG_IDAC_HEAT0 to BME69X_REG_CONFIG
+     * followed by BME69X_REG_MEM_PAGE
+     */
+    uint8_t regs[BME69X_LEN_SHADOW];
+};
+
+/*
+ * @brief BME69X acquisition statistics. Tracks the status polls of
+ * bme69x_wait_data and the skew learnt on the predicted measurement duration.
+ */
+struct bme69x_acq
+{
+    /*! Correction added to the predicted measurement duration, in microseconds */
+    int32_t skew_us;
+
+    /*! Status polls needed by the last wait */
+    uint16_t last_polls;
+
+    /*! Number of waits that ended with new data */
+    uint32_t n_ready;
+
+    /*! Number of waits that ran out of polls */
+    uint32_t n_timeout;
+
+    /*! Total number of status polls */
+    uint32_t n_polls;
+};
+
+/*
+ * @brief BME69X heater resistance table, kept when BME69X_USE_HEATR_LUT is defined
+ */
+struct bme69x_heatr_lut
+{
+    /*! Heater resistance register value per heater temperature in degree C */
+    uint8_t res_heat[BME69X_LEN_HEATR_LUT];
+
+    /*! Ambient temperature the table was built for */
+    int8_t amb_temp;
+
+    /*! Non-zero once the table is built, cleared by bme69x_init */
+    uint8_t valid;
+};
+
+/*
+ * @brief BME69X hot path counters, kept when BME69X_ENABLE_STATS is defined
+ */
+struct bme69x_stats
+{
+    /*! Number of read transactions */
+    uint32_t n_reads;
+
+    /*! Number of write transactions */
+    uint32_t n_writes;
+
+    /*! Number of data bytes read */
+    uint32_t bytes_read;
+
+    /*! Number of bytes written, register addresses included */
+    uint32_t bytes_written;
+
+    /*! Number of SPI memory page switches */
+    uint32_t n_page_switches;
+
+    /*! Number of polls repeated for lack of new data or while entering sleep */
+    uint32_t n_retries;
+
+    /*! Number of transactions failed by the interface, the last result is in bme69x_dev.intf_rslt */
+    uint32_t n_bus_errors;
+
+    /*! Time requested from delay_us, in microseconds */
+    uint64_t delay_us;
+};
+
+/*
+ * @brief BME69X device structure. The optional function pointers are only
+ * called once enabled, submit by the bme69x_async APIs and get_time_ns by
+ * BME69X_FEAT_TIMESTAMP, so they can be left unset otherwise.
+ */
+struct bme69x_dev
+{
+    /*! Chip Id */
+    uint8_t chip_id;
+
+    /*!
+     * The interface pointer is used to enable the user
+     * to link their interface descriptors for reference during the
+     * implementation of the read and write interfaces to the
+     * hardware.
+     */
+    void *intf_ptr;
+
+    /*!
+     *             Variant id
+     * ----------------------------------------
+     *     Value   |           Variant
+     * ----------------------------------------
+     *      0      |   BME69X_VARIANT_GAS_LOW
+     *      1      |   BME69X_VARIANT_GAS_HIGH
+     * ----------------------------------------
+     */
+    uint32_t variant_id;
+
+    /*! SPI/I2C interface */
+    enum bme69x_intf intf;
+
+    /*! Memory page used */
+    uint8_t mem_page;
+
+    /*! Ambient temperature in Degree C*/
+    int8_t amb_temp;
+
+    /*! Sensor calibration data */
+    struct bme69x_calib_data calib;
+
+    /*! Read function pointer */
+    bme69x_read_fptr_t read;
+
+    /*! Write function pointer */
+    bme69x_write_fptr_t write;
+
+    /*! Delay function pointer */
+    bme69x_delay_us_fptr_t delay_us;
+
+    /*! Asynchronous transfer function pointer, only needed by the bme69x_async APIs */
+    bme69x_submit_fptr_t submit;
+
+    /*! Monotonic clock function pointer, optional. The data read is timestamped with it when
+     * BME69X_FEAT_TIMESTAMP is selected in features */
+    bme69x_time_ns_fptr_t get_time_ns;
+
+    /*! To store interface pointer error */
+    BME69X_INTF_RET_TYPE intf_rslt;
+
+    /*! Store the info messages */
+    uint8_t info_msg;
+
+    /*! Enabled features, a combination of the BME69X_FEAT_* macros, cleared by bme69x_init */
+    uint8_t features;
+
+    /*! Shadow register cache, invalidated by bme69x_soft_reset */
+    struct bme69x_shadow shadow;
+
+    /*! Acquisition statistics, cleared by bme69x_init */
+    struct bme69x_acq acq;
+
+#ifdef BME69X_ENABLE_STATS
+
+    /*! Hot path counters, cleared by bme69x_init */
+    struct bme69x_stats stats;
+#endif
+
+#ifdef BME69X_USE_HEATR_LUT
+
+    /*! Heater resistance table, built on the first heater configuration for the current amb_temp */
+    struct bme69x_heatr_lut heatr_lut;
+#endif
+};
+
+/*
+ * @brief BME69X self-test of one device, see bme69x_selftest_run
+ */
+struct bme69x_selftest
+{
+    /*! Temporary device the test runs on, the tested device is left untouched */
+    struct bme69x_dev t_dev;
+
+    /*! Measurements of the test */
+    struct bme69x_data data[BME69X_N_MEAS];
+
+    /*! Number of measurements completed, the gas valid check included */
+    uint8_t n_meas;
+
+    /*! Result of the test, BME69X_E_SELF_TEST if the sensor failed it */
+    int8_t rslt;
+};
+
+/*
+ * @brief BME69X warm start blob, the identity and calibration of a sensor
+ * saved by bme69x_warm_save and restored by bme69x_init_warm. It is stored as
+ * it is, e.g. in a file, by a build with the same bme69x_calib_data layout.
+ */
+struct bme69x_warm_blob
+{
+    /*! Format of the blob, BME69X_WARM_FORMAT */
+    uint32_t format;
+
+    /*! Unique ID of the sensor, the key of the blob */
+    uint8_t unique_id[BME69X_LEN_UNIQUE_ID];
+
+    /*! Chip ID */
+    uint8_t chip_id;
+
+    /*! Variant ID */
+    uint32_t variant_id;
+
+    /*! Calibration data, derived constants included */
+    struct bme69x_calib_data calib;
+
+    /*! Checksum of the members above */
+    uint32_t checksum;
+};
+
+#endif /* BME69X_DEFS_H_ */
+/*! @endcond */
@@ -0,0 +1,273 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+
+#include "bme69x.h"
+#include "common.h"
+#include "async.h"
+
+/***********************************************************************/
+/*                         Macros                                      */
+/***********************************************************************/
+
+/* Macro for count of samples to be displayed per sensor */
+#define SAMPLE_COUNT  UINT16_C(50)
+
+/* Number of buses in the sensor map */
+#define N_BUSES       UINT8_C(2)
+
+/* Longest wait of the event loop in microseconds */
+#define LOOP_TIMEOUT  UINT32_C(100000)
+
+/***********************************************************************/
+/*                         Sensor map                                  */
+/***********************************************************************/
+
+struct sensor_map
+{
+    /* Index of the bus in the buses array */
+    uint8_t bus;
+
+    /* I2C address or SPI chip select */
+    uint8_t addr;
+};
+
+struct sensor
+{
+    struct bme69x_dev bme;
+    struct bme69x_sensor_ctx ctx;
+    struct bme69x_conf conf;
+    struct bme69x_heatr_conf heatr_conf;
+    struct bme69x_async op;
+    struct bme69x_data data[3];
+    uint8_t n_data;
+    uint16_t sample_count;
+    bool ready;
+};
+
+/* Bus 0 : I2C-1, bus 1 : SPI main */
+static const uint8_t bus_intf[N_BUSES] = { BME69X_I2C_INTF, BME69X_SPI_INTF };
+static const uint8_t bus_id[N_BUSES] = { 1, 0 };
+
+static const struct sensor_map sensor_map[] = {
+    { 0, BME69X_I2C_ADDR_HIGH }, { 0, BME69X_I2C_ADDR_LOW }, { 1, 0 }, { 1, 1 }
+};
+
+#define N_SENSORS     (sizeof(sensor_map) / sizeof(sensor_map[0]))
+
+/* Heater temperature in degree Celsius */
+static uint16_t temp_prof[10] = { 320, 100, 100, 100, 200, 200, 200, 320, 320, 320 };
+
+/* Multiplier to the shared heater duration */
+static uint16_t mul_prof[10] = { 5, 2, 10, 30, 5, 5, 5, 5, 5, 5 };
+
+static struct bme69x_bus buses[N_BUSES];
+static struct bme69x_loop loop;
+static struct sensor sensors[N_SENSORS];
+
+/* Number of sensors still reading */
+static uint8_t n_running;
+
+/***********************************************************************/
+/*                         Completion callback                         */
+/***********************************************************************/
+
+/* Prints the data of a sensor and starts its next read */
+static void read_done(struct bme69x_async *op, int8_t rslt, void *arg)
+{
+    struct sensor *s = (struct sensor *)arg;
+
+    (void)op;
+
+    if (rslt < BME69X_OK)
+    {
+        bme69x_check_rslt("bme69x_async_get_data", rslt);
+    }
+
+    for (uint8_t i = 0; (rslt == BME69X_OK) && (i < s->n_data) && (s->sample_count <= SAMPLE_COUNT); i++)
+    {
+#ifdef BME69X_USE_FPU
+        printf("%u, %u, %lu, %.2f, %.2f, %.2f, %.2f, 0x%x, %d\n",
+               (unsigned)(s - sensors),
+               s->sample_count,
+               (long unsigned int)(s->data[i].timestamp / 1000000),
+               s->data[i].temperature,
+               s->data[i].pressure,
+               s->data[i].humidity,
+               s->data[i].gas_resistance,
+               s->data[i].status,
+               s->data[i].gas_index);
+#else
+        printf("%u, %u, %lu, %d, %lu, %lu, %lu, 0x%x, %d\n",
+               (unsigned)(s - sensors),
+               s->sample_count,
+               (long unsigned int)(s->data[i].timestamp / 1000000),
+               s->data[i].temperature,
+               (long unsigned int)s->data[i].pressure,
+               (long unsigned int)s->data[i].humidity,
+               (long unsigned int)s->data[i].gas_resistance,
+               s->data[i].status,
+               s->data[i].gas_index);
+#endif
+        s->sample_count++;
+    }
+
+    /* A read that found no new data is simply restarted */
+    if ((rslt >= BME69X_OK) && (s->sample_count <= SAMPLE_COUNT))
+    {
+        rslt = bme69x_async_get_data(BME69X_PARALLEL_MODE, s->data, &s->n_data, &s->op);
+    }
+    else
+    {
+        rslt = BME69X_W_NO_NEW_DATA;
+    }
+
+    if (rslt != BME69X_OK)
+    {
+        n_running--;
+    }
+}
+
+/* Brings up a sensor in parallel mode once it is attached to its bus */
+static int8_t setup_sensor(struct sensor *s)
+{
+    int8_t rslt;
+
+    rslt = bme69x_init(&s->bme);
+    bme69x_check_rslt("bme69x_init", rslt);
+
+    if (rslt == BME69X_OK)
+    {
+        /* Timestamp the data with bme69x_dev.get_time_ns, the features are cleared by bme69x_init */
+        s->bme.features |= BME69X_FEAT_TIMESTAMP;
+
+        s->conf.filter = BME69X_FILTER_OFF;
+        s->conf.odr = BME69X_ODR_NONE;
+        s->conf.os_hum = BME69X_OS_1X;
+        s->conf.os_pres = BME69X_OS_16X;
+        s->conf.os_temp = BME69X_OS_2X;
+        rslt = bme69x_set_conf(&s->conf, &s->bme);
+        bme69x_check_rslt("bme69x_set_conf", rslt);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        s->heatr_conf.enable = BME69X_ENABLE;
+        s->heatr_conf.heatr_temp_prof = temp_prof;
+        s->heatr_conf.heatr_dur_prof = mul_prof;
+        s->heatr_conf.shared_heatr_dur =
+            (uint16_t)(140 - (bme69x_get_meas_dur(BME69X_PARALLEL_MODE, &s->conf, &s->bme) / 1000));
+        s->heatr_conf.profile_len = 10;
+        rslt = bme69x_set_heatr_conf(BME69X_PARALLEL_MODE, &s->heatr_conf, &s->bme);
+        bme69x_check_rslt("bme69x_set_heatr_conf", rslt);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_set_op_mode(BME69X_PARALLEL_MODE, &s->bme);
+        bme69x_check_rslt("bme69x_set_op_mode", rslt);
+    }
+
+    return rslt;
+}
+
+/***********************************************************************/
+/*                         Test code                                   */
+/***********************************************************************/
+
+int main(void)
+{
+    int8_t rslt;
+    uint8_t i;
+
+    /* All the transfers of all the sensors are completed by this thread */
+    rslt = bme69x_loop_init(&loop);
+    bme69x_check_rslt("bme69x_loop_init", rslt);
+    if (rslt != BME69X_OK)
+    {
+        return 1;
+    }
+
+    for (i = 0; i < N_BUSES; i++)
+    {
+        rslt = bme69x_bus_open(&buses[i], bus_intf[i], bus_id[i]);
+        bme69x_check_rslt("bme69x_bus_open", rslt);
+    }
+
+    for (i = 0; i < N_SENSORS; i++)
+    {
+        struct sensor *s = &sensors[i];
+
+        s->sample_count = 1;
+        rslt = bme69x_sensor_attach(&s->ctx, &buses[sensor_map[i].bus], sensor_map[i].addr, &s->bme);
+        if (rslt == BME69X_OK)
+        {
+            rslt = setup_sensor(s);
+        }
+
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_loop_add(&loop, &s->ctx);
+            bme69x_check_rslt("bme69x_loop_add", rslt);
+        }
+
+        if (rslt == BME69X_OK)
+        {
+            rslt = bme69x_async_init(&s->op, read_done, s, &s->bme);
+            bme69x_check_rslt("bme69x_async_init", rslt);
+        }
+
+        s->ready = (rslt == BME69X_OK);
+    }
+
+    rslt = bme69x_loop_start(&loop);
+    bme69x_check_rslt("bme69x_loop_start", rslt);
+
+    printf("Sensor, Sample, TimeStamp(ms), Temperature(deg C), Pressure(Pa), Humidity(%%), Gas resistance(ohm), Status, Gas index\n");
+
+    for (i = 0; (rslt == BME69X_OK) && (i < N_SENSORS); i++)
+    {
+        if (sensors[i].ready)
+        {
+            if (bme69x_async_get_data(BME69X_PARALLEL_MODE, sensors[i].data, &sensors[i].n_data,
+                                      &sensors[i].op) == BME69X_OK)
+            {
+                n_running++;
+            }
+        }
+    }
+
+    while (n_running > 0)
+    {
+        rslt = bme69x_loop_run(&loop, LOOP_TIMEOUT);
+        if (rslt < BME69X_OK)
+        {
+            bme69x_check_rslt("bme69x_loop_run", rslt);
+            break;
+        }
+    }
+
+    bme69x_loop_stop(&loop);
+
+    for (i = 0; i < N_SENSORS; i++)
+    {
+        if (sensors[i].ready)
+        {
+            (void)bme69x_set_op_mode(BME69X_SLEEP_MODE, &sensors[i].bme);
+        }
+    }
+
+    for (i = 0; i < N_BUSES; i++)
+    {
+        bme69x_bus_close(&buses[i]);
+    }
+
+    (void)fflush(stdout);
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+
+#include "bme69x.h"
+#include "common.h"
+#include "capture.h"
+
+/***********************************************************************/
+/*                         Macros                                      */
+/***********************************************************************/
+
+/* Macro for count of samples to be captured */
+#define SAMPLE_COUNT  UINT16_C(300)
+
+/* Capture file */
+#define CAPTURE_PATH  "bme69x_capture.bin"
+
+/***********************************************************************/
+/*                         Test code                                   */
+/***********************************************************************/
+
+int main(void)
+{
+    struct bme69x_dev bme = { 0 };
+    int8_t rslt;
+    struct bme69x_conf conf;
+    struct bme69x_heatr_conf heatr_conf;
+    struct bme69x_data data;
+    struct bme69x_ring ring;
+    struct bme69x_frame frame;
+    struct bme69x_capture cap;
+    struct bme69x_capture_reader reader;
+    uint64_t time_ms = 0;
+    uint16_t sample_count = 1;
+    uint32_t i;
+
+    /* Interface preference is updated as a parameter
+     * For I2C : BME69X_I2C_INTF
+     * For SPI : BME69X_SPI_INTF
+     */
+    rslt = bme69x_interface_init(&bme, BME69X_I2C_INTF);
+    bme69x_check_rslt("bme69x_interface_init", rslt);
+
+    rslt = bme69x_init(&bme);
+    bme69x_check_rslt("bme69x_init", rslt);
+
+    /* Timestamp the data with bme69x_dev.get_time_ns, the features are cleared by bme69x_init */
+    bme.features |= BME69X_FEAT_TIMESTAMP;
+
+    /* Check if rslt == BME69X_OK, report or handle if otherwise */
+    conf.filter = BME69X_FILTER_OFF;
+    conf.odr = BME69X_ODR_NONE;
+    conf.os_hum = BME69X_OS_16X;
+    conf.os_pres = BME69X_OS_16X;
+    conf.os_temp = BME69X_OS_16X;
+    rslt = bme69x_set_conf(&conf, &bme);
+    bme69x_check_rslt("bme69x_set_conf", rslt);
+
+    /* Check if rslt == BME69X_OK, report or handle if otherwise */
+    heatr_conf.enable = BME69X_ENABLE;
+    heatr_conf.heatr_temp = 300;
+    heatr_conf.heatr_dur = 100;
+    rslt = bme69x_set_heatr_conf(BME69X_FORCED_MODE, &heatr_conf, &bme);
+    bme69x_check_rslt("bme69x_set_heatr_conf", rslt);
+
+    /* The raw fields are stored, the calibration is stored once in the file header */
+    rslt = bme69x_ring_init(&ring);
+    bme69x_check_rslt("bme69x_ring_init", rslt);
+
+    rslt = bme69x_capture_open(&cap, CAPTURE_PATH, &bme);
+    bme69x_check_rslt("bme69x_capture_open", rslt);
+
+    printf("Capturing %u samples to %s\n", SAMPLE_COUNT, CAPTURE_PATH);
+
+    while ((sample_count <= SAMPLE_COUNT) && (rslt >= BME69X_OK))
+    {
+        rslt = bme69x_set_op_mode(BME69X_FORCED_MODE, &bme);
+        bme69x_check_rslt("bme69x_set_op_mode", rslt);
+
+        /* Sleeps for the predicted measurement duration, then polls the status register */
+        rslt = bme69x_wait_data(BME69X_FORCED_MODE, &conf, &heatr_conf, &bme);
+        bme69x_check_rslt("bme69x_wait_data", rslt);
+
+        /* Check if rslt == BME69X_OK, report or handle if otherwise.
+         * The frames are stamped by the driver, BME69X_FEAT_TIMESTAMP is selected. */
+        rslt = bme69x_ring_acquire(BME69X_FORCED_MODE, 0, &ring, &bme);
+        bme69x_check_rslt("bme69x_ring_acquire", rslt);
+
+        while (bme69x_ring_pop(&ring, &frame) == BME69X_OK)
+        {
+            rslt = bme69x_capture_write(&cap, &frame);
+            bme69x_check_rslt("bme69x_capture_write", rslt);
+            sample_count++;
+        }
+    }
+
+    rslt = bme69x_capture_close(&cap);
+    bme69x_check_rslt("bme69x_capture_close", rslt);
+
+    /* Replay the capture, the records are compensated as they are accessed */
+    rslt = bme69x_capture_map(&reader, CAPTURE_PATH);
+    bme69x_check_rslt("bme69x_capture_map", rslt);
+
+    printf("Record, TimeStamp(ms), Temperature(deg C), Pressure(Pa), Humidity(%%), Gas resistance(ohm), Status\n");
+
+    for (i = 0; (i < reader.n_records) && (rslt == BME69X_OK); i++)
+    {
+        if (bme69x_capture_get(&reader, i, &data, &time_ms) != BME69X_OK)
+        {
+            /* Key record */
+            continue;
+        }
+
+#ifdef BME69X_USE_FPU
+        printf("%lu, %lu, %.2f, %.2f, %.2f, %.2f, 0x%x\n",
+               (long unsigned int)i,
+               (long unsigned int)time_ms,
+               data.temperature,
+               data.pressure,
+               data.humidity,
+               data.gas_resistance,
+               data.status);
+#else
+        printf("%lu, %lu, %d, %ld, %ld, %ld, 0x%x\n",
+               (long unsigned int)i,
+               (long unsigned int)time_ms,
+               data.temperature,
+               (long int)data.pressure,
+               (long int)data.humidity,
+               (long int)data.gas_resistance,
+               data.status);
+#endif
+    }
+
+    bme69x_capture_unmap(&reader);
+
+    bme69x_pigpio_deinit();
+
+    return rslt;
+}
@@ -0,0 +1,371 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <poll.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+#include "bme69x.h"
+#include "common.h"
+#include "async.h"
+
+/******************************************************************************/
+/*!                       Macro definitions                                   */
+
+/*! Slot without transfer */
+#define SLOT_IDLE      UINT8_C(0)
+
+/*! Read or write waiting for the worker of its bus */
+#define SLOT_QUEUED    UINT8_C(1)
+
+/*! Read or write running on the worker of its bus */
+#define SLOT_RUNNING   UINT8_C(2)
+
+/*! Read or write finished, waiting for bme69x_loop_run */
+#define SLOT_DONE      UINT8_C(3)
+
+/*! Wait until the deadline of the slot */
+#define SLOT_WAITING   UINT8_C(4)
+
+/*! Longest time a worker sleeps before checking whether its bus is stopped, in nanoseconds */
+#define WORKER_IDLE_NS INT32_C(10000000)
+
+/******************************************************************************/
+/*!                 Static function definitions                               */
+
+/*!
+ * Time of CLOCK_MONOTONIC in microseconds
+ */
+static uint64_t now_us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * UINT64_C(1000000)) + ((uint64_t)ts.tv_nsec / 1000);
+}
+
+/*!
+ * Wakes up the thread of bme69x_loop_run
+ */
+static void wake_loop(const struct bme69x_loop *loop)
+{
+    uint64_t one = 1;
+
+    (void)!write(loop->efd, &one, sizeof(one));
+}
+
+/*!
+ * Worker of a bus, runs the queued transfers of its sensors one at a time
+ */
+static void loop_worker(struct bme69x_bus *bus, void *arg)
+{
+    struct bme69x_loop *loop = (struct bme69x_loop *)arg;
+    struct bme69x_loop_slot *slot = NULL;
+    const struct bme69x_xfer *xfer;
+    struct bme69x_dev *dev;
+    BME69X_INTF_RET_TYPE rslt;
+    struct timespec ts;
+    uint8_t i;
+
+    (void)pthread_mutex_lock(&loop->lock);
+
+    for (i = 0; i < loop->n_slots; i++)
+    {
+        if ((loop->slots[i].state == SLOT_QUEUED) && (loop->slots[i].ctx->bus == bus))
+        {
+            slot = &loop->slots[i];
+            break;
+        }
+    }
+
+    if (slot == NULL)
+    {
+        /* Nothing queued, sleep until a transfer is queued or the bus may have been stopped */
+        (void)clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_nsec += WORKER_IDLE_NS;
+        if (ts.tv_nsec >= 1000000000L)
+        {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000L;
+        }
+
+        (void)pthread_cond_timedwait(&loop->work, &loop->lock, &ts);
+        (void)pthread_mutex_unlock(&loop->lock);
+
+        return;
+    }
+
+    slot->state = SLOT_RUNNING;
+    xfer = slot->xfer;
+    dev = slot->ctx->dev;
+    (void)pthread_mutex_unlock(&loop->lock);
+
+    /* Blocking transfer, the bus lock of the sensor context serializes it */
+    if (xfer->type == BME69X_XFER_READ)
+    {
+        rslt = dev->read(xfer->reg_addr, xfer->reg_data, xfer->len, dev->intf_ptr);
+    }
+    else
+    {
+        rslt = dev->write(xfer->reg_addr, xfer->reg_data, xfer->len, dev->intf_ptr);
+    }
+
+    (void)pthread_mutex_lock(&loop->lock);
+    slot->rslt = rslt;
+    slot->state = SLOT_DONE;
+    (void)pthread_mutex_unlock(&loop->lock);
+
+    wake_loop(loop);
+}
+
+/******************************************************************************/
+/*!                User interface functions                                   */
+
+int8_t bme69x_loop_init(struct bme69x_loop *loop)
+{
+    if (loop == NULL)
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    memset(loop, 0, sizeof(*loop));
+
+    loop->efd = eventfd(0, EFD_NONBLOCK);
+    if (loop->efd < 0)
+    {
+        return BME69X_E_COM_FAIL;
+    }
+
+    (void)pthread_mutex_init(&loop->lock, NULL);
+    (void)pthread_cond_init(&loop->work, NULL);
+
+    return BME69X_OK;
+}
+
+int8_t bme69x_loop_add(struct bme69x_loop *loop, struct bme69x_sensor_ctx *ctx)
+{
+    struct bme69x_loop_slot *slot;
+    uint8_t i;
+
+    if ((loop == NULL) || (ctx == NULL) || (ctx->bus == NULL) || (ctx->dev == NULL))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    if (loop->n_slots >= BME69X_LOOP_MAX_SENSORS)
+    {
+        return BME69X_E_INVALID_LENGTH;
+    }
+
+    i = 0;
+    while ((i < loop->n_buses) && (loop->buses[i] != ctx->bus))
+    {
+        i++;
+    }
+
+    if (i == loop->n_buses)
+    {
+        if (loop->n_buses >= BME69X_LOOP_MAX_BUSES)
+        {
+            return BME69X_E_INVALID_LENGTH;
+        }
+
+        loop->buses[loop->n_buses++] = ctx->bus;
+    }
+
+    slot = &loop->slots[loop->n_slots++];
+    slot->loop = loop;
+    slot->ctx = ctx;
+    slot->op = NULL;
+    slot->state = SLOT_IDLE;
+
+    ctx->slot = slot;
+    ctx->dev->submit = bme69x_loop_submit;
+
+    return BME69X_OK;
+}
+
+int8_t bme69x_loop_start(struct bme69x_loop *loop)
+{
+    int8_t rslt = BME69X_OK;
+    uint8_t i;
+
+    if (loop == NULL)
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    for (i = 0; (i < loop->n_buses) && (rslt == BME69X_OK); i++)
+    {
+        rslt = bme69x_bus_start(loop->buses[i], loop_worker, loop);
+    }
+
+    return rslt;
+}
+
+BME69X_INTF_RET_TYPE bme69x_loop_submit(const struct bme69x_xfer *xfer, struct bme69x_async *op, void *intf_ptr)
+{
+    struct bme69x_sensor_ctx *ctx = (struct bme69x_sensor_ctx *)intf_ptr;
+    struct bme69x_loop_slot *slot;
+    struct bme69x_loop *loop;
+    BME69X_INTF_RET_TYPE rslt = BME69X_INTF_RET_SUCCESS;
+
+    if ((ctx == NULL) || (ctx->slot == NULL) || (xfer == NULL) || (op == NULL))
+    {
+        return BME69X_E_COM_FAIL;
+    }
+
+    slot = ctx->slot;
+    loop = slot->loop;
+
+    (void)pthread_mutex_lock(&loop->lock);
+
+    if (slot->state != SLOT_IDLE)
+    {
+        rslt = BME69X_E_COM_FAIL;
+    }
+    else
+    {
+        slot->op = op;
+        slot->xfer = xfer;
+        if (xfer->type == BME69X_XFER_WAIT)
+        {
+            slot->deadline_us = now_us() + xfer->period;
+            slot->state = SLOT_WAITING;
+        }
+        else
+        {
+            slot->state = SLOT_QUEUED;
+
+            /* Workers of all the buses share the condition */
+            (void)pthread_cond_broadcast(&loop->work);
+        }
+    }
+
+    (void)pthread_mutex_unlock(&loop->lock);
+
+    /* A wait submitted from another thread may end before the current timeout of the loop */
+    if ((rslt == BME69X_INTF_RET_SUCCESS) && (xfer->type == BME69X_XFER_WAIT))
+    {
+        wake_loop(loop);
+    }
+
+    return rslt;
+}
+
+int8_t bme69x_loop_run(struct bme69x_loop *loop, uint32_t timeout_us)
+{
+    struct bme69x_async *ops[BME69X_LOOP_MAX_SENSORS];
+    BME69X_INTF_RET_TYPE rslts[BME69X_LOOP_MAX_SENSORS];
+    struct bme69x_loop_slot *slot;
+    struct pollfd pfd;
+    uint64_t wait_us = timeout_us;
+    uint64_t counter;
+    uint64_t now;
+    uint8_t n_ops = 0;
+    uint8_t i;
+
+    if (loop == NULL)
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    /* Sleep until the earliest deadline at most */
+    now = now_us();
+    (void)pthread_mutex_lock(&loop->lock);
+    for (i = 0; i < loop->n_slots; i++)
+    {
+        slot = &loop->slots[i];
+        if (slot->state == SLOT_DONE)
+        {
+            wait_us = 0;
+        }
+        else if (slot->state == SLOT_WAITING)
+        {
+            if (slot->deadline_us <= now)
+            {
+                wait_us = 0;
+            }
+            else if ((slot->deadline_us - now) < wait_us)
+            {
+                wait_us = slot->deadline_us - now;
+            }
+        }
+    }
+
+    (void)pthread_mutex_unlock(&loop->lock);
+
+    pfd.fd = loop->efd;
+    pfd.events = POLLIN;
+
+    /* Round up to whole milliseconds so that a wait never ends early */
+    if ((poll(&pfd, 1, (int)((wait_us + 999) / 1000)) < 0) && (errno != EINTR))
+    {
+        return BME69X_E_COM_FAIL;
+    }
+
+    if ((pfd.revents & POLLIN) != 0)
+    {
+        (void)!read(loop->efd, &counter, sizeof(counter));
+    }
+
+    /* Collect the finished transfers, the callbacks may submit again so they run unlocked */
+    now = now_us();
+    (void)pthread_mutex_lock(&loop->lock);
+    for (i = 0; i < loop->n_slots; i++)
+    {
+        slot = &loop->slots[i];
+        if ((slot->state == SLOT_DONE) || ((slot->state == SLOT_WAITING) && (slot->deadline_us <= now)))
+        {
+            ops[n_ops] = slot->op;
+            rslts[n_ops] = (slot->state == SLOT_DONE) ? slot->rslt : BME69X_INTF_RET_SUCCESS;
+            n_ops++;
+            slot->op = NULL;
+            slot->state = SLOT_IDLE;
+        }
+    }
+
+    (void)pthread_mutex_unlock(&loop->lock);
+
+    for (i = 0; i < n_ops; i++)
+    {
+        (void)bme69x_async_complete(ops[i], rslts[i]);
+    }
+
+    return (n_ops > 0) ? BME69X_OK : BME69X_W_NO_NEW_DATA;
+}
+
+void bme69x_loop_stop(struct bme69x_loop *loop)
+{
+    uint8_t i;
+
+    if ((loop == NULL) || (loop->efd < 0))
+    {
+        return;
+    }
+
+    for (i = 0; i < loop->n_buses; i++)
+    {
+        bme69x_bus_stop(loop->buses[i]);
+    }
+
+    for (i = 0; i < loop->n_slots; i++)
+    {
+        loop->slots[i].ctx->slot = NULL;
+        loop->slots[i].ctx->dev->submit = NULL;
+    }
+
+    (void)close(loop->efd);
+    loop->efd = -1;
+    (void)pthread_cond_destroy(&loop->work);
+    (void)pthread_mutex_destroy(&loop->lock);
+}
@@ -0,0 +1,151 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ASYNC_H_
+#define ASYNC_H_
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include "bme69x.h"
+#include "common.h"
+
+/*! Maximum number of sensors served by one event loop */
+#define BME69X_LOOP_MAX_SENSORS  UINT8_C(32)
+
+/*! Maximum number of buses served by one event loop */
+#define BME69X_LOOP_MAX_BUSES    UINT8_C(4)
+
+/*!
+ * @brief Transfer slot of a sensor added to an event loop. A sensor has at most
+ * one operation, hence one transfer, in flight.
+ */
+struct bme69x_loop_slot
+{
+    /*! Event loop of the slot */
+    struct bme69x_loop *loop;
+
+    /*! Sensor of the slot */
+    struct bme69x_sensor_ctx *ctx;
+
+    /*! Operation of the submitted transfer, NULL while the slot is idle */
+    struct bme69x_async *op;
+
+    /*! Submitted transfer */
+    const struct bme69x_xfer *xfer;
+
+    /*! End of a wait, in microseconds of CLOCK_MONOTONIC */
+    uint64_t deadline_us;
+
+    /*! Result of the transfer */
+    BME69X_INTF_RET_TYPE rslt;
+
+    /*! State of the slot, see async.c */
+    uint8_t state;
+};
+
+/*!
+ * @brief Event loop completing the asynchronous operations of several sensors.
+ * The pigpio transfers are blocking, so every bus gets a worker thread running
+ * the queued transfers of its sensors. Waits are deadlines of the loop itself.
+ * Completions are signalled through an eventfd and run on the thread calling
+ * bme69x_loop_run, which is the only one calling bme69x_async_complete.
+ */
+struct bme69x_loop
+{
+    /*! eventfd signalled by the workers */
+    int efd;
+
+    /*! Protects the slots */
+    pthread_mutex_t lock;
+
+    /*! Signalled when a transfer is queued */
+    pthread_cond_t work;
+
+    /*! Slots of the added sensors */
+    struct bme69x_loop_slot slots[BME69X_LOOP_MAX_SENSORS];
+
+    /*! Number of added sensors */
+    uint8_t n_slots;
+
+    /*! Buses of the added sensors */
+    struct bme69x_bus *buses[BME69X_LOOP_MAX_BUSES];
+
+    /*! Number of buses */
+    uint8_t n_buses;
+};
+
+/*!
+ *  @brief Initializes an event loop
+ *
+ *  @param[out] loop    : Event loop
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_loop_init(struct bme69x_loop *loop);
+
+/*!
+ *  @brief Adds an attached sensor to an event loop, in place of its bme69x_dev.submit.
+ *  Sensors are added before bme69x_loop_start.
+ *
+ *  @param[in,out] loop : Event loop
+ *  @param[in,out] ctx  : Sensor context, attached with bme69x_sensor_attach
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_loop_add(struct bme69x_loop *loop, struct bme69x_sensor_ctx *ctx);
+
+/*!
+ *  @brief Starts the worker thread of every bus of the loop, see bme69x_bus_start
+ *
+ *  @param[in,out] loop : Event loop
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_loop_start(struct bme69x_loop *loop);
+
+/*!
+ *  @brief Waits for finished transfers and expired waits, then completes them.
+ *  Completion callbacks run from this call and may start the next operation.
+ *
+ *  @param[in,out] loop     : Event loop
+ *  @param[in] timeout_us   : Longest time to wait when nothing is finished
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success, at least one transfer was completed
+ *  @retval > 0 -> Warning, BME69X_W_NO_NEW_DATA on timeout
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_loop_run(struct bme69x_loop *loop, uint32_t timeout_us);
+
+/*!
+ *  @brief Stops the workers and releases the loop. Operations still in flight are dropped.
+ *
+ *  @param[in,out] loop : Event loop
+ *
+ *  @return void.
+ */
+void bme69x_loop_stop(struct bme69x_loop *loop);
+
+/*!
+ *  @brief Queues a transfer on the event loop of the sensor. See bme69x_submit_fptr_t
+ */
+BME69X_INTF_RET_TYPE bme69x_loop_submit(const struct bme69x_xfer *xfer, struct bme69x_async *op, void *intf_ptr);
+
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* ASYNC_H_ */
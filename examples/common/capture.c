@@ -0,0 +1,416 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "bme69x.h"
+#include "capture.h"
+
+/******************************************************************************/
+/*!                       Macro definitions                                   */
+
+/*! Offset of the calibration coefficients in the header */
+#define CAPTURE_HDR_COEFF     UINT8_C(16)
+
+/*! Largest meas index increment stored in a data record */
+#define CAPTURE_MAX_MEAS_INC  UINT8_C(3)
+
+/*! Magic at the start of a capture file */
+static const uint8_t capture_magic[8] = { 'B', 'M', 'E', '6', '9', 'X', 'C', 'P' };
+
+/******************************************************************************/
+/*!                 Static function definitions                               */
+
+/*!
+ * Stores a little endian value of len bytes
+ */
+static void put_le(uint8_t *buf, uint64_t val, uint8_t len)
+{
+    uint8_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = (uint8_t)(val >> (8 * i));
+    }
+}
+
+/*!
+ * Loads a little endian value of len bytes
+ */
+static uint64_t get_le(const uint8_t *buf, uint8_t len)
+{
+    uint64_t val = 0;
+    uint8_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        val |= (uint64_t)buf[i] << (8 * i);
+    }
+
+    return val;
+}
+
+/*!
+ * Writes one record
+ */
+static int8_t write_record(struct bme69x_capture *cap, const uint8_t *rec)
+{
+    if (fwrite(rec, BME69X_CAPTURE_REC_LEN, 1, cap->file) != 1)
+    {
+        return BME69X_E_COM_FAIL;
+    }
+
+    cap->n_records++;
+
+    return BME69X_OK;
+}
+
+/*!
+ * Returns the record at index
+ */
+static const uint8_t *record_at(const struct bme69x_capture_reader *reader, uint32_t index)
+{
+    return &reader->map[BME69X_CAPTURE_HDR_LEN + ((size_t)index * BME69X_CAPTURE_REC_LEN)];
+}
+
+/*!
+ * Tells if a record is a key record
+ */
+static bool is_key(const uint8_t *rec)
+{
+    return get_le(rec, 2) == BME69X_CAPTURE_KEY;
+}
+
+/*!
+ * Applies the deltas of a data record, or loads the values of a key record
+ */
+static void advance(const uint8_t *rec, uint64_t *ts, uint8_t *meas)
+{
+    if (is_key(rec))
+    {
+        *ts = get_le(&rec[2], 8);
+        *meas = rec[10];
+    }
+    else
+    {
+        *ts += get_le(rec, 2);
+        *meas = (uint8_t)(*meas + (rec[12] >> 6));
+    }
+}
+
+/******************************************************************************/
+/*!                User interface functions                                   */
+
+int8_t bme69x_capture_open(struct bme69x_capture *cap, const char *path, struct bme69x_dev *dev)
+{
+    uint8_t hdr[BME69X_CAPTURE_HDR_LEN] = { 0 };
+    int8_t rslt;
+
+    if ((cap == NULL) || (path == NULL) || (dev == NULL))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    memcpy(hdr, capture_magic, sizeof(capture_magic));
+    hdr[8] = BME69X_CAPTURE_VERSION;
+    hdr[9] = BME69X_CAPTURE_REC_LEN;
+    hdr[10] = dev->chip_id;
+    hdr[11] = dev->variant_id;
+
+    /* The raw coefficients, a reader derives the calibration the same way as bme69x_init */
+    rslt = bme69x_get_coeff(&hdr[CAPTURE_HDR_COEFF], dev);
+    if (rslt != BME69X_OK)
+    {
+        return rslt;
+    }
+
+    cap->file = fopen(path, "wb");
+    if (cap->file == NULL)
+    {
+        return BME69X_E_COM_FAIL;
+    }
+
+    cap->n_records = 0;
+    cap->timestamp = 0;
+    cap->meas_index = 0;
+
+    if (fwrite(hdr, sizeof(hdr), 1, cap->file) != 1)
+    {
+        (void)fclose(cap->file);
+        cap->file = NULL;
+
+        return BME69X_E_COM_FAIL;
+    }
+
+    return BME69X_OK;
+}
+
+int8_t bme69x_capture_write(struct bme69x_capture *cap, const struct bme69x_frame *frame)
+{
+    uint8_t rec[BME69X_CAPTURE_REC_LEN] = { 0 };
+    struct bme69x_raw_field raw;
+    uint64_t ts;
+    uint64_t dt;
+    uint8_t inc;
+    int8_t rslt;
+
+    if ((cap == NULL) || (cap->file == NULL) || (frame == NULL))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    (void)bme69x_parse_field(frame->field, &raw);
+
+    /* Records are stamped in milliseconds */
+    ts = frame->timestamp / 1000000;
+    dt = ts - cap->timestamp;
+    inc = (uint8_t)(raw.meas_index - cap->meas_index);
+
+    /* Start a block, or restart the deltas when they do not fit */
+    if (((cap->n_records % BME69X_CAPTURE_KEY_PERIOD) == 0) || (ts < cap->timestamp) ||
+        (dt >= BME69X_CAPTURE_KEY) || (inc > CAPTURE_MAX_MEAS_INC))
+    {
+        put_le(rec, BME69X_CAPTURE_KEY, 2);
+        put_le(&rec[2], ts, 8);
+        rec[10] = raw.meas_index;
+
+        rslt = write_record(cap, rec);
+        if (rslt != BME69X_OK)
+        {
+            return rslt;
+        }
+
+        memset(rec, 0, sizeof(rec));
+        dt = 0;
+        inc = 0;
+    }
+
+    put_le(rec, dt, 2);
+    rec[2] = (uint8_t)(raw.status | raw.gas_index);
+    put_le(&rec[3], raw.pres_adc, 3);
+    put_le(&rec[6], raw.temp_adc, 3);
+    put_le(&rec[9], raw.hum_adc, 2);
+    put_le(&rec[11], (uint64_t)raw.gas_adc | ((uint64_t)raw.gas_range << 10) | ((uint64_t)inc << 14), 2);
+    rec[13] = frame->res_heat;
+    rec[14] = frame->idac;
+    rec[15] = frame->gas_wait;
+
+    rslt = write_record(cap, rec);
+    if (rslt == BME69X_OK)
+    {
+        cap->timestamp = ts;
+        cap->meas_index = raw.meas_index;
+    }
+
+    return rslt;
+}
+
+int8_t bme69x_capture_close(struct bme69x_capture *cap)
+{
+    int8_t rslt = BME69X_OK;
+
+    if ((cap == NULL) || (cap->file == NULL))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    if (fclose(cap->file) != 0)
+    {
+        rslt = BME69X_E_COM_FAIL;
+    }
+
+    cap->file = NULL;
+
+    return rslt;
+}
+
+int8_t bme69x_capture_map(struct bme69x_capture_reader *reader, const char *path)
+{
+    struct stat st;
+    void *map;
+    int fd;
+    int8_t rslt = BME69X_OK;
+
+    if ((reader == NULL) || (path == NULL))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return BME69X_E_COM_FAIL;
+    }
+
+    if ((fstat(fd, &st) != 0) || ((size_t)st.st_size < BME69X_CAPTURE_HDR_LEN))
+    {
+        (void)close(fd);
+
+        return BME69X_E_INVALID_LENGTH;
+    }
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (map == MAP_FAILED)
+    {
+        return BME69X_E_COM_FAIL;
+    }
+
+    reader->map = (const uint8_t *)map;
+    reader->size = (size_t)st.st_size;
+
+    if ((memcmp(reader->map, capture_magic, sizeof(capture_magic)) != 0) ||
+        (reader->map[8] != BME69X_CAPTURE_VERSION) || (reader->map[9] != BME69X_CAPTURE_REC_LEN))
+    {
+        rslt = BME69X_E_INVALID_LENGTH;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_parse_calib(&reader->map[CAPTURE_HDR_COEFF], &reader->calib);
+    }
+
+    if (rslt != BME69X_OK)
+    {
+        bme69x_capture_unmap(reader);
+
+        return rslt;
+    }
+
+    reader->n_records = (uint32_t)((reader->size - BME69X_CAPTURE_HDR_LEN) / BME69X_CAPTURE_REC_LEN);
+    reader->chip_id = reader->map[10];
+    reader->variant_id = reader->map[11];
+    reader->cursor = 0;
+    reader->cursor_valid = false;
+
+    return BME69X_OK;
+}
+
+int8_t bme69x_capture_get_raw(struct bme69x_capture_reader *reader,
+                              uint32_t index,
+                              struct bme69x_raw_field *raw,
+                              uint64_t *timestamp)
+{
+    const uint8_t *rec;
+    uint64_t ts = 0;
+    uint8_t meas = 0;
+    uint32_t key;
+    uint32_t i;
+
+    if ((reader == NULL) || (reader->map == NULL) || (raw == NULL))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    if (index >= reader->n_records)
+    {
+        return BME69X_E_INVALID_LENGTH;
+    }
+
+    rec = record_at(reader, index);
+
+    if (reader->cursor_valid && (index == (reader->cursor + 1)))
+    {
+        /* Next record in order */
+        ts = reader->cursor_ts;
+        meas = reader->cursor_meas;
+        advance(rec, &ts, &meas);
+    }
+    else
+    {
+        /* Replay the deltas from the key record the block starts with */
+        key = index;
+        while (!is_key(record_at(reader, key)))
+        {
+            if (key == 0)
+            {
+                return BME69X_E_INVALID_LENGTH;
+            }
+
+            key--;
+        }
+
+        for (i = key; i <= index; i++)
+        {
+            advance(record_at(reader, i), &ts, &meas);
+        }
+    }
+
+    reader->cursor = index;
+    reader->cursor_valid = true;
+    reader->cursor_ts = ts;
+    reader->cursor_meas = meas;
+
+    if (is_key(rec))
+    {
+        return BME69X_W_NO_NEW_DATA;
+    }
+
+    raw->status = rec[2] & (BME69X_NEW_DATA_MSK | BME69X_GASM_VALID_MSK | BME69X_HEAT_STAB_MSK);
+    raw->gas_index = rec[2] & BME69X_GAS_INDEX_MSK;
+    raw->meas_index = meas;
+    raw->pres_adc = (uint32_t)get_le(&rec[3], 3);
+    raw->temp_adc = (uint32_t)get_le(&rec[6], 3);
+    raw->hum_adc = (uint16_t)get_le(&rec[9], 2);
+    raw->gas_adc = (uint16_t)(get_le(&rec[11], 2) & 0x3ff);
+    raw->gas_range = (uint8_t)((rec[12] >> 2) & BME69X_GAS_RANGE_MSK);
+    raw->res_heat = rec[13];
+    raw->idac = rec[14];
+    raw->gas_wait = rec[15];
+    raw->timestamp = ts * 1000000;
+
+    if (timestamp != NULL)
+    {
+        *timestamp = ts;
+    }
+
+    return BME69X_OK;
+}
+
+int8_t bme69x_capture_get(struct bme69x_capture_reader *reader,
+                          uint32_t index,
+                          struct bme69x_data *data,
+                          uint64_t *timestamp)
+{
+    struct bme69x_raw_field raw;
+    int8_t rslt;
+
+    if (data == NULL)
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    rslt = bme69x_capture_get_raw(reader, index, &raw, timestamp);
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_compensate(&reader->calib, &raw, data);
+    }
+
+    return rslt;
+}
+
+const uint8_t *bme69x_capture_coeff(const struct bme69x_capture_reader *reader)
+{
+    return &reader->map[CAPTURE_HDR_COEFF];
+}
+
+void bme69x_capture_unmap(struct bme69x_capture_reader *reader)
+{
+    if ((reader != NULL) && (reader->map != NULL))
+    {
+        (void)munmap((void *)reader->map, reader->size);
+        reader->map = NULL;
+        reader->n_records = 0;
+        reader->cursor_valid = false;
+    }
+}
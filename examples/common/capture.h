@@ -0,0 +1,229 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include "bme69x.h"
+
+/*
+ * Capture file layout, all values little endian
+ *
+ * Header, BME69X_CAPTURE_HDR_LEN bytes
+ *   0..7   : Magic "BME69XCP"
+ *   8      : Format version
+ *   9      : Record length
+ *   10     : Chip ID
+ *   11     : Variant ID
+ *   12..15 : Reserved
+ *   16..57 : Calibration coefficient registers, see bme69x_get_coeff
+ *   58..63 : Reserved
+ *
+ * Data record, BME69X_CAPTURE_REC_LEN bytes
+ *   0..1   : Milliseconds since the previous record
+ *   2      : new_data, gasm_valid & heat_stab flags | gas index
+ *   3..5   : Raw pressure
+ *   6..8   : Raw temperature
+ *   9..10  : Raw humidity
+ *   11..12 : Raw gas (bits 0..9), gas range (bits 10..13), meas index
+ *            increment since the previous record (bits 14..15)
+ *   13     : Heater resistance
+ *   14     : Heater current DAC
+ *   15     : Gas wait
+ *
+ * Key record, starting every BME69X_CAPTURE_KEY_PERIOD records and whenever
+ * a delta does not fit in a data record
+ *   0..1   : BME69X_CAPTURE_KEY
+ *   2..9   : Timestamp in milliseconds
+ *   10     : Meas index
+ *   11..15 : Reserved
+ */
+
+/*! Length of the file header */
+#define BME69X_CAPTURE_HDR_LEN     UINT8_C(64)
+
+/*! Length of a record */
+#define BME69X_CAPTURE_REC_LEN     UINT8_C(16)
+
+/*! Version of the capture format */
+#define BME69X_CAPTURE_VERSION     UINT8_C(1)
+
+/*! Time delta marking a key record */
+#define BME69X_CAPTURE_KEY         UINT16_C(0xffff)
+
+/*! A key record starts every block of this many records, bounding the random access cost */
+#define BME69X_CAPTURE_KEY_PERIOD  UINT8_C(64)
+
+/*!
+ * @brief Capture writer storing raw frames
+ */
+struct bme69x_capture
+{
+    /*! Capture file */
+    FILE *file;
+
+    /*! Number of records written */
+    uint32_t n_records;
+
+    /*! Timestamp of the last record, in milliseconds */
+    uint64_t timestamp;
+
+    /*! Meas index of the last record */
+    uint8_t meas_index;
+};
+
+/*!
+ * @brief Memory-mapped capture reader, records are compensated when accessed
+ */
+struct bme69x_capture_reader
+{
+    /*! Mapped file */
+    const uint8_t *map;
+
+    /*! Length of the mapped file */
+    size_t size;
+
+    /*! Number of records */
+    uint32_t n_records;
+
+    /*! Chip ID of the captured sensor */
+    uint8_t chip_id;
+
+    /*! Variant ID of the captured sensor */
+    uint8_t variant_id;
+
+    /*! Calibration coefficients of the captured sensor */
+    struct bme69x_calib_data calib;
+
+    /*! Last decoded record, to decode the records in order without searching the key */
+    uint32_t cursor;
+
+    /*! Set once cursor is valid */
+    bool cursor_valid;
+
+    /*! Timestamp of the cursor record, in milliseconds */
+    uint64_t cursor_ts;
+
+    /*! Meas index of the cursor record */
+    uint8_t cursor_meas;
+};
+
+/*!
+ *  @brief Creates a capture file, storing the calibration coefficients of the sensor in its header
+ *
+ *  @param[out] cap     : Capture writer
+ *  @param[in] path     : Path of the file to create
+ *  @param[in,out] dev  : Structure instance of bme69x_dev, initialized
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_capture_open(struct bme69x_capture *cap, const char *path, struct bme69x_dev *dev);
+
+/*!
+ *  @brief Appends a raw frame. The frame timestamp is in nanoseconds, it is recorded in milliseconds.
+ *
+ *  @param[in,out] cap  : Capture writer
+ *  @param[in] frame    : Raw frame, see bme69x_ring_acquire
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_capture_write(struct bme69x_capture *cap, const struct bme69x_frame *frame);
+
+/*!
+ *  @brief Flushes and closes a capture file
+ *
+ *  @param[in,out] cap  : Capture writer
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_capture_close(struct bme69x_capture *cap);
+
+/*!
+ *  @brief Maps a capture file and parses the calibration coefficients of its header
+ *
+ *  @param[out] reader  : Capture reader
+ *  @param[in] path     : Path of the capture file
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_capture_map(struct bme69x_capture_reader *reader, const char *path);
+
+/*!
+ *  @brief Decodes and compensates one record. Reading the records in order
+ *  costs one record each, any other record costs up to one key period.
+ *
+ *  @param[in,out] reader   : Capture reader
+ *  @param[in] index        : Index of the record
+ *  @param[out] data        : Compensated data
+ *  @param[out] timestamp   : Timestamp of the data in milliseconds, can be NULL
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval > 0 -> Warning, BME69X_W_NO_NEW_DATA for a key record
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_capture_get(struct bme69x_capture_reader *reader,
+                          uint32_t index,
+                          struct bme69x_data *data,
+                          uint64_t *timestamp);
+
+/*!
+ *  @brief Decodes one record without compensating it, see bme69x_capture_get
+ *
+ *  @param[in,out] reader   : Capture reader
+ *  @param[in] index        : Index of the record
+ *  @param[out] raw         : Raw values
+ *  @param[out] timestamp   : Timestamp of the data in milliseconds, can be NULL
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval > 0 -> Warning, BME69X_W_NO_NEW_DATA for a key record
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_capture_get_raw(struct bme69x_capture_reader *reader,
+                              uint32_t index,
+                              struct bme69x_raw_field *raw,
+                              uint64_t *timestamp);
+
+/*!
+ *  @brief Calibration coefficient registers stored in the header of a mapped capture
+ *
+ *  @param[in] reader   : Capture reader
+ *
+ *  @return Buffer of BME69X_LEN_COEFF_ALL bytes
+ */
+const uint8_t *bme69x_capture_coeff(const struct bme69x_capture_reader *reader);
+
+/*!
+ *  @brief Unmaps a capture file
+ *
+ *  @param[in,out] reader   : Capture reader
+ *
+ *  @return void.
+ */
+void bme69x_capture_unmap(struct bme69x_capture_reader *reader);
+
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* CAPTURE_H_ */
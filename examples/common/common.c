@@ -1,281 +1,806 @@
-/**
- * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
- *
- * SPDX-License-Identifier: BSD-3-Clause
- */
-
-#include <stdint.h>
-#include <stdlib.h>
-#include <stdio.h>
-#include <stdbool.h>
-#include <unistd.h>
-#include <time.h>
-#include <sys/time.h>
-#include <pigpio.h>
-#include <string.h>
-#include "bme69x.h"
-#include "common.h"
-
-/******************************************************************************/
-/*!                 Macro definitions                                         */
-/*! Default I2C bus for Raspberry Pi */
-#define BME69X_I2C_BUS          1
-
-/*! Default SPI bus for Raspberry Pi */
-#define BME69X_SPI_BUS          0
-
-/*! Default SPI speed */
-#define BME69X_SPI_SPEED        1000000  /* 1 MHz */
-
-/******************************************************************************/
-/*!                Static variable definition                                 */
-static uint8_t dev_addr;
-static int i2c_handle = -1;
-static int spi_handle = -1;
-
-/******************************************************************************/
-/*!                User interface functions                                   */
-
-/*!
- * I2C read function using pigpio
- */
-BME69X_INTF_RET_TYPE bme69x_i2c_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
-{
-    int result;
-    
-    (void)intf_ptr;
-
-    if (i2c_handle < 0) {
-        return BME69X_E_COM_FAIL;
-    }
-
-    result = i2cWriteDevice(i2c_handle, (char*)&reg_addr, 1);
-    if (result < 0) {
-        return BME69X_E_COM_FAIL;
-    }
-
-    result = i2cReadDevice(i2c_handle, (char*)reg_data, len);
-    if (result != (int)len) {
-        return BME69X_E_COM_FAIL;
-    }
-
-    return BME69X_INTF_RET_SUCCESS;
-}
-
-/*!
- * I2C write function using pigpio
- */
-BME69X_INTF_RET_TYPE bme69x_i2c_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
-{
-    int result;
-    char buffer[len + 1];
-    
-    (void)intf_ptr;
-
-    if (i2c_handle < 0) {
-        return BME69X_E_COM_FAIL;
-    }
-
-    buffer[0] = reg_addr;
-    for (uint32_t i = 0; i < len; i++) {
-        buffer[i + 1] = reg_data[i];
-    }
-
-    result = i2cWriteDevice(i2c_handle, buffer, len + 1);
-    if (result < 0) {
-        return BME69X_E_COM_FAIL;
-    }
-
-    return BME69X_INTF_RET_SUCCESS;
-}
-
-/*!
- * SPI read function using pigpio
- */
-BME69X_INTF_RET_TYPE bme69x_spi_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
-{
-    int result;
-    char tx_buffer[len + 1];
-    char rx_buffer[len + 1];
-    
-    (void)intf_ptr;
-
-    if (spi_handle < 0) {
-        return BME69X_E_COM_FAIL;
-    }
-
-    tx_buffer[0] = reg_addr | 0x80;
-    for (uint32_t i = 1; i <= len; i++) {
-        tx_buffer[i] = 0;
-    }
-
-    result = spiXfer(spi_handle, tx_buffer, rx_buffer, len + 1);
-    if (result < 0) {
-        return BME69X_E_COM_FAIL;
-    }
-
-    for (uint32_t i = 0; i < len; i++) {
-        reg_data[i] = rx_buffer[i + 1];
-    }
-
-    return BME69X_INTF_RET_SUCCESS;
-}
-
-/*!
- * SPI write function using pigpio
- */
-BME69X_INTF_RET_TYPE bme69x_spi_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
-{
-    int result;
-    char tx_buffer[len + 1];
-    
-    (void)intf_ptr;
-
-    if (spi_handle < 0) {
-        return BME69X_E_COM_FAIL;
-    }
-
-    tx_buffer[0] = reg_addr & 0x7F;
-    for (uint32_t i = 0; i < len; i++) {
-        tx_buffer[i + 1] = reg_data[i];
-    }
-
-    result = spiWrite(spi_handle, tx_buffer, len + 1);
-    if (result < 0) {
-        return BME69X_E_COM_FAIL;
-    }
-
-    return BME69X_INTF_RET_SUCCESS;
-}
-
-/*!
- * Delay function using pigpio
- */
-void bme69x_delay_us(uint32_t period, void *intf_ptr)
-{
-    (void)intf_ptr;
-    gpioDelay(period);
-}
-
-uint32_t bme69x_get_millis(void)
-{
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return (uint32_t)((tv.tv_sec * 1000) + (tv.tv_usec / 1000));
-}
-
-void bme69x_check_rslt(const char api_name[], int8_t rslt)
-{
-    switch (rslt)
-    {
-        case BME69X_OK:
-
-            /* Do nothing */
-            break;
-        case BME69X_E_NULL_PTR:
-            printf("API name [%s]  Error [%d] : Null pointer\r\n", api_name, rslt);
-            break;
-        case BME69X_E_COM_FAIL:
-            printf("API name [%s]  Error [%d] : Communication failure\r\n", api_name, rslt);
-            break;
-        case BME69X_E_INVALID_LENGTH:
-            printf("API name [%s]  Error [%d] : Incorrect length parameter\r\n", api_name, rslt);
-            break;
-        case BME69X_E_DEV_NOT_FOUND:
-            printf("API name [%s]  Error [%d] : Device not found\r\n", api_name, rslt);
-            break;
-        case BME69X_E_SELF_TEST:
-            printf("API name [%s]  Error [%d] : Self test error\r\n", api_name, rslt);
-            break;
-        case BME69X_W_NO_NEW_DATA:
-            printf("API name [%s]  Warning [%d] : No new data found\r\n", api_name, rslt);
-            break;
-        default:
-            printf("API name [%s]  Error [%d] : Unknown error code\r\n", api_name, rslt);
-            break;
-    }
-}
-
-int8_t bme69x_interface_init(struct bme69x_dev *bme, uint8_t intf)
-{
-    int8_t rslt = BME69X_OK;
-
-    if (bme != NULL)
-    {
-        if (gpioInitialise() < 0)
-        {
-            printf("Failed to initialize pigpio library\n");
-            return BME69X_E_COM_FAIL;
-        }
-
-        printf("pigpio library initialized successfully\n");
-
-        if (intf == BME69X_I2C_INTF)
-        {
-            printf("I2C Interface\n");
-            dev_addr = BME69X_I2C_ADDR_HIGH;
-            
-            i2c_handle = i2cOpen(BME69X_I2C_BUS, dev_addr, 0);
-            if (i2c_handle < 0)
-            {
-                printf("Failed to open I2C bus %d, device 0x%02X\n", BME69X_I2C_BUS, dev_addr);
-                gpioTerminate();
-                return BME69X_E_COM_FAIL;
-            }
-            
-            printf("I2C connection opened successfully (handle: %d)\n", i2c_handle);
-            
-            bme->read = bme69x_i2c_read;
-            bme->write = bme69x_i2c_write;
-            bme->intf = BME69X_I2C_INTF;
-        }
-        /* Bus configuration : SPI */
-        else if (intf == BME69X_SPI_INTF)
-        {
-            printf("SPI Interface\n");
-            
-            spi_handle = spiOpen(BME69X_SPI_BUS, BME69X_SPI_SPEED, 0);
-            if (spi_handle < 0)
-            {
-                printf("Failed to open SPI bus %d\n", BME69X_SPI_BUS);
-                gpioTerminate();
-                return BME69X_E_COM_FAIL;
-            }
-            
-            printf("SPI connection opened successfully (handle: %d)\n", spi_handle);
-            
-            bme->read = bme69x_spi_read;
-            bme->write = bme69x_spi_write;
-            bme->intf = BME69X_SPI_INTF;
-        }
-
-        bme->delay_us = bme69x_delay_us;
-        bme->intf_ptr = &dev_addr;
-        bme->amb_temp = 25; /* The ambient temperature in deg C is used for defining the heater temperature */
-    }
-    else
-    {
-        rslt = BME69X_E_NULL_PTR;
-    }
-
-    return rslt;
-}
-
-void bme69x_pigpio_deinit(void)
-{
-    (void)fflush(stdout);
-
-    if (i2c_handle >= 0)
-    {
-        i2cClose(i2c_handle);
-        i2c_handle = -1;
-    }
-
-    if (spi_handle >= 0)
-    {
-        spiClose(spi_handle);
-        spi_handle = -1;
-    }
-
-    gpioTerminate();
-}
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <time.h>
+#include <string.h>
+#ifdef BME69X_USE_KERNEL_INTF
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+#else
+#include <pigpio.h>
+#endif
+#include "bme69x.h"
+#include "common.h"
+
+/******************************************************************************/
+/*!                 Macro definitions                                         */
+/*! Default I2C bus for Raspberry Pi */
+#define BME69X_I2C_BUS          1
+
+/*! Default SPI bus for Raspberry Pi */
+#define BME69X_SPI_BUS          0
+
+/*! Default SPI speed */
+#define BME69X_SPI_SPEED        1000000  /* 1 MHz */
+
+/*
+ * The transfers go through pigpio by default. With BME69X_USE_KERNEL_INTF
+ * defined they go through the i2c-dev and spidev drivers of the kernel
+ * instead, which needs neither pigpio nor root, and lets other processes
+ * share the bus. An I2C register read is then a single I2C_RDWR call with a
+ * repeated start between the address and the data, an SPI transfer a single
+ * SPI_IOC_MESSAGE with the chip select held.
+ */
+
+/******************************************************************************/
+/*!                Static variable definition                                 */
+/*! Bus and sensor context used by bme69x_interface_init */
+static struct bme69x_bus default_bus;
+static struct bme69x_sensor_ctx default_ctx;
+
+#ifndef BME69X_USE_KERNEL_INTF
+
+/*! Number of opened buses, pigpio is initialized while it is not zero */
+static uint8_t pigpio_users;
+static pthread_mutex_t pigpio_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/******************************************************************************/
+/*!                User interface functions                                   */
+
+#ifdef BME69X_USE_KERNEL_INTF
+
+/*!
+ * I2C read function using i2c-dev, the address and the data phase in one call
+ */
+BME69X_INTF_RET_TYPE bme69x_i2c_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bme69x_sensor_ctx *ctx = (struct bme69x_sensor_ctx *)intf_ptr;
+    struct i2c_msg msgs[2];
+    struct i2c_rdwr_ioctl_data xfer;
+    BME69X_INTF_RET_TYPE rslt = BME69X_INTF_RET_SUCCESS;
+
+    if ((ctx == NULL) || (ctx->handle < 0)) {
+        return BME69X_E_COM_FAIL;
+    }
+
+    msgs[0].addr = ctx->addr;
+    msgs[0].flags = 0;
+    msgs[0].len = 1;
+    msgs[0].buf = &reg_addr;
+    msgs[1].addr = ctx->addr;
+    msgs[1].flags = I2C_M_RD;
+    msgs[1].len = (uint16_t)len;
+    msgs[1].buf = reg_data;
+    xfer.msgs = msgs;
+    xfer.nmsgs = 2;
+
+    (void)pthread_mutex_lock(&ctx->bus->lock);
+
+    if (ioctl(ctx->handle, I2C_RDWR, &xfer) != 2) {
+        rslt = BME69X_E_COM_FAIL;
+    }
+
+    (void)pthread_mutex_unlock(&ctx->bus->lock);
+
+    return rslt;
+}
+
+/*!
+ * I2C write function using i2c-dev, sending the address and the data in place
+ */
+BME69X_INTF_RET_TYPE bme69x_i2c_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bme69x_sensor_ctx *ctx = (struct bme69x_sensor_ctx *)intf_ptr;
+    struct i2c_msg msg;
+    struct i2c_rdwr_ioctl_data xfer;
+    BME69X_INTF_RET_TYPE rslt = BME69X_INTF_RET_SUCCESS;
+
+    (void)reg_addr;
+
+    if ((ctx == NULL) || (ctx->handle < 0)) {
+        return BME69X_E_COM_FAIL;
+    }
+
+    /* reg_data[-1] is reg_addr, see bme69x_write_fptr_t. The kernel does not modify a write message. */
+    msg.addr = ctx->addr;
+    msg.flags = 0;
+    msg.len = (uint16_t)(len + 1);
+    msg.buf = (uint8_t *)(uintptr_t)(reg_data - 1);
+    xfer.msgs = &msg;
+    xfer.nmsgs = 1;
+
+    (void)pthread_mutex_lock(&ctx->bus->lock);
+
+    if (ioctl(ctx->handle, I2C_RDWR, &xfer) != 1) {
+        rslt = BME69X_E_COM_FAIL;
+    }
+
+    (void)pthread_mutex_unlock(&ctx->bus->lock);
+
+    return rslt;
+}
+
+/*!
+ * Sends the register address, then reads the data, in one spidev message
+ */
+static BME69X_INTF_RET_TYPE spi_xfer(struct bme69x_sensor_ctx *ctx, uint8_t addr_byte, uint8_t *rx, uint32_t len)
+{
+    struct spi_ioc_transfer xfer[2];
+    int result;
+
+    (void)memset(xfer, 0, sizeof(xfer));
+    xfer[0].tx_buf = (uintptr_t)&addr_byte;
+    xfer[0].len = 1;
+    xfer[0].speed_hz = BME69X_SPI_SPEED;
+    xfer[0].bits_per_word = 8;
+    xfer[1].rx_buf = (uintptr_t)rx;
+    xfer[1].len = len;
+    xfer[1].speed_hz = BME69X_SPI_SPEED;
+    xfer[1].bits_per_word = 8;
+
+    (void)pthread_mutex_lock(&ctx->bus->lock);
+    result = ioctl(ctx->handle, SPI_IOC_MESSAGE(2), xfer);
+    (void)pthread_mutex_unlock(&ctx->bus->lock);
+
+    return (result < (int)(len + 1)) ? BME69X_E_COM_FAIL : BME69X_INTF_RET_SUCCESS;
+}
+
+/*!
+ * SPI read function using spidev
+ */
+BME69X_INTF_RET_TYPE bme69x_spi_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bme69x_sensor_ctx *ctx = (struct bme69x_sensor_ctx *)intf_ptr;
+
+    if ((ctx == NULL) || (ctx->handle < 0)) {
+        return BME69X_E_COM_FAIL;
+    }
+
+    return spi_xfer(ctx, reg_addr | 0x80, reg_data, len);
+}
+
+/*!
+ * SPI write function using spidev, sending the address and the data in place
+ */
+BME69X_INTF_RET_TYPE bme69x_spi_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bme69x_sensor_ctx *ctx = (struct bme69x_sensor_ctx *)intf_ptr;
+    struct spi_ioc_transfer xfer;
+    int result;
+
+    (void)reg_addr;
+
+    if ((ctx == NULL) || (ctx->handle < 0)) {
+        return BME69X_E_COM_FAIL;
+    }
+
+    /* reg_data[-1] is reg_addr with the SPI write bit cleared, see bme69x_write_fptr_t */
+    (void)memset(&xfer, 0, sizeof(xfer));
+    xfer.tx_buf = (uintptr_t)(reg_data - 1);
+    xfer.len = len + 1;
+    xfer.speed_hz = BME69X_SPI_SPEED;
+    xfer.bits_per_word = 8;
+
+    (void)pthread_mutex_lock(&ctx->bus->lock);
+    result = ioctl(ctx->handle, SPI_IOC_MESSAGE(1), &xfer);
+    (void)pthread_mutex_unlock(&ctx->bus->lock);
+
+    return (result < (int)(len + 1)) ? BME69X_E_COM_FAIL : BME69X_INTF_RET_SUCCESS;
+}
+
+/*!
+ * Delay function sleeping the calling thread
+ */
+void bme69x_delay_us(uint32_t period, void *intf_ptr)
+{
+    struct timespec ts;
+
+    (void)intf_ptr;
+
+    ts.tv_sec = (time_t)(period / 1000000);
+    ts.tv_nsec = (long)(period % 1000000) * 1000;
+    while ((nanosleep(&ts, &ts) != 0) && (errno == EINTR))
+    {
+        /* Sleep the remaining time after a signal */
+    }
+}
+
+#else
+
+/*!
+ * I2C read function using pigpio
+ */
+BME69X_INTF_RET_TYPE bme69x_i2c_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bme69x_sensor_ctx *ctx = (struct bme69x_sensor_ctx *)intf_ptr;
+    BME69X_INTF_RET_TYPE rslt = BME69X_INTF_RET_SUCCESS;
+
+    if ((ctx == NULL) || (ctx->handle < 0)) {
+        return BME69X_E_COM_FAIL;
+    }
+
+    (void)pthread_mutex_lock(&ctx->bus->lock);
+
+    if (i2cWriteDevice(ctx->handle, (char*)&reg_addr, 1) < 0) {
+        rslt = BME69X_E_COM_FAIL;
+    } else if (i2cReadDevice(ctx->handle, (char*)reg_data, len) != (int)len) {
+        rslt = BME69X_E_COM_FAIL;
+    }
+
+    (void)pthread_mutex_unlock(&ctx->bus->lock);
+
+    return rslt;
+}
+
+/*!
+ * I2C write function using pigpio, sending the address and the data in place
+ */
+BME69X_INTF_RET_TYPE bme69x_i2c_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bme69x_sensor_ctx *ctx = (struct bme69x_sensor_ctx *)intf_ptr;
+    BME69X_INTF_RET_TYPE rslt = BME69X_INTF_RET_SUCCESS;
+
+    (void)reg_addr;
+
+    if ((ctx == NULL) || (ctx->handle < 0)) {
+        return BME69X_E_COM_FAIL;
+    }
+
+    (void)pthread_mutex_lock(&ctx->bus->lock);
+
+    /* reg_data[-1] is reg_addr, see bme69x_write_fptr_t */
+    if (i2cWriteDevice(ctx->handle, (char*)(reg_data - 1), len + 1) < 0) {
+        rslt = BME69X_E_COM_FAIL;
+    }
+
+    (void)pthread_mutex_unlock(&ctx->bus->lock);
+
+    return rslt;
+}
+
+/*!
+ * SPI read function using pigpio, through the transfer buffers of the sensor context.
+ * A read longer than the buffers is split into bursts at consecutive addresses.
+ */
+BME69X_INTF_RET_TYPE bme69x_spi_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bme69x_sensor_ctx *ctx = (struct bme69x_sensor_ctx *)intf_ptr;
+    uint32_t n_chunk;
+    int result = 0;
+
+    if ((ctx == NULL) || (ctx->handle < 0)) {
+        return BME69X_E_COM_FAIL;
+    }
+
+    (void)pthread_mutex_lock(&ctx->bus->lock);
+
+    /* The rest of tx_buff stays zero from bme69x_sensor_attach */
+    while ((len > 0) && (result >= 0)) {
+        n_chunk = (len < (BME69X_INTF_BUF_LEN - 1)) ? len : (BME69X_INTF_BUF_LEN - 1);
+        ctx->tx_buff[0] = reg_addr | 0x80;
+        result = spiXfer(ctx->handle, (char*)ctx->tx_buff, (char*)ctx->rx_buff, n_chunk + 1);
+        if (result >= 0) {
+            (void)memcpy(reg_data, &ctx->rx_buff[1], n_chunk);
+            reg_addr = (uint8_t)(reg_addr + n_chunk);
+            reg_data += n_chunk;
+            len -= n_chunk;
+        }
+    }
+
+    (void)pthread_mutex_unlock(&ctx->bus->lock);
+
+    if (result < 0) {
+        return BME69X_E_COM_FAIL;
+    }
+
+    return BME69X_INTF_RET_SUCCESS;
+}
+
+/*!
+ * SPI write function using pigpio, sending the address and the data in place
+ */
+BME69X_INTF_RET_TYPE bme69x_spi_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bme69x_sensor_ctx *ctx = (struct bme69x_sensor_ctx *)intf_ptr;
+    int result;
+
+    (void)reg_addr;
+
+    if ((ctx == NULL) || (ctx->handle < 0)) {
+        return BME69X_E_COM_FAIL;
+    }
+
+    /* reg_data[-1] is reg_addr with the SPI write bit cleared, see bme69x_write_fptr_t */
+    (void)pthread_mutex_lock(&ctx->bus->lock);
+    result = spiWrite(ctx->handle, (char*)(reg_data - 1), len + 1);
+    (void)pthread_mutex_unlock(&ctx->bus->lock);
+
+    if (result < 0) {
+        return BME69X_E_COM_FAIL;
+    }
+
+    return BME69X_INTF_RET_SUCCESS;
+}
+
+/*!
+ * Delay function using pigpio
+ */
+void bme69x_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)intf_ptr;
+    gpioDelay(period);
+}
+
+#endif
+
+uint64_t bme69x_get_time_ns(void *intf_ptr)
+{
+    struct timespec ts;
+
+    (void)intf_ptr;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * UINT64_C(1000000000)) + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t bme69x_get_millis(void)
+{
+    return bme69x_get_time_ns(NULL) / 1000000;
+}
+
+void bme69x_check_rslt(const char api_name[], int8_t rslt)
+{
+    switch (rslt)
+    {
+        case BME69X_OK:
+
+            /* Do nothing */
+            break;
+        case BME69X_E_NULL_PTR:
+            printf("API name [%s]  Error [%d] : Null pointer\r\n", api_name, rslt);
+            break;
+        case BME69X_E_COM_FAIL:
+            printf("API name [%s]  Error [%d] : Communication failure\r\n", api_name, rslt);
+            break;
+        case BME69X_E_INVALID_LENGTH:
+            printf("API name [%s]  Error [%d] : Incorrect length parameter\r\n", api_name, rslt);
+            break;
+        case BME69X_E_DEV_NOT_FOUND:
+            printf("API name [%s]  Error [%d] : Device not found\r\n", api_name, rslt);
+            break;
+        case BME69X_E_SELF_TEST:
+            printf("API name [%s]  Error [%d] : Self test error\r\n", api_name, rslt);
+            break;
+        case BME69X_E_BUSY:
+            printf("API name [%s]  Error [%d] : Operation in progress\r\n", api_name, rslt);
+            break;
+        case BME69X_W_NO_NEW_DATA:
+            printf("API name [%s]  Warning [%d] : No new data found\r\n", api_name, rslt);
+            break;
+        case BME69X_W_RING_FULL:
+            printf("API name [%s]  Warning [%d] : Ring full, frame dropped\r\n", api_name, rslt);
+            break;
+        case BME69X_W_WARM_MISS:
+            printf("API name [%s]  Warning [%d] : Warm start blob rebuilt\r\n", api_name, rslt);
+            break;
+        default:
+            printf("API name [%s]  Error [%d] : Unknown error code\r\n", api_name, rslt);
+            break;
+    }
+}
+
+#ifdef BME69X_USE_KERNEL_INTF
+
+/*!
+ * The kernel drivers need no library, every sensor opens its own device node
+ */
+static int8_t pigpio_acquire(void)
+{
+    return BME69X_OK;
+}
+
+static void pigpio_release(void)
+{
+}
+
+#else
+
+/*!
+ * Takes a reference on the pigpio library, initializing it for the first user
+ */
+static int8_t pigpio_acquire(void)
+{
+    int8_t rslt = BME69X_OK;
+
+    (void)pthread_mutex_lock(&pigpio_lock);
+    if (pigpio_users == 0)
+    {
+        if (gpioInitialise() < 0)
+        {
+            printf("Failed to initialize pigpio library\n");
+            rslt = BME69X_E_COM_FAIL;
+        }
+        else
+        {
+            printf("pigpio library initialized successfully\n");
+        }
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        pigpio_users++;
+    }
+
+    (void)pthread_mutex_unlock(&pigpio_lock);
+
+    return rslt;
+}
+
+/*!
+ * Releases a reference on the pigpio library, terminating it with the last user
+ */
+static void pigpio_release(void)
+{
+    (void)pthread_mutex_lock(&pigpio_lock);
+    if (pigpio_users > 0)
+    {
+        pigpio_users--;
+        if (pigpio_users == 0)
+        {
+            gpioTerminate();
+        }
+    }
+
+    (void)pthread_mutex_unlock(&pigpio_lock);
+}
+
+#endif
+
+#ifdef BME69X_USE_KERNEL_INTF
+
+/*!
+ * Opens the i2c-dev node of a bus, the address of the sensor is given with each message
+ */
+static int open_i2c(uint8_t bus_id, uint8_t addr)
+{
+    char path[32];
+
+    (void)addr;
+    (void)snprintf(path, sizeof(path), "/dev/i2c-%u", (unsigned)bus_id);
+
+    return open(path, O_RDWR);
+}
+
+/*!
+ * Opens and configures the spidev node of a chip select
+ */
+static int open_spi(uint8_t bus_id, uint8_t cs)
+{
+    char path[32];
+    uint8_t mode = SPI_MODE_0;
+    uint8_t bits = 8;
+    uint32_t speed = BME69X_SPI_SPEED;
+    int fd;
+
+    (void)snprintf(path, sizeof(path), "/dev/spidev%u.%u", (unsigned)bus_id, (unsigned)cs);
+
+    fd = open(path, O_RDWR);
+    if ((fd >= 0) &&
+        ((ioctl(fd, SPI_IOC_WR_MODE, &mode) < 0) || (ioctl(fd, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0) ||
+         (ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &speed) < 0)))
+    {
+        (void)close(fd);
+        fd = -1;
+    }
+
+    return fd;
+}
+
+/*!
+ * Closes the device node of a sensor
+ */
+static void close_handle(uint8_t intf, int handle)
+{
+    (void)intf;
+    (void)close(handle);
+}
+
+#else
+
+/*!
+ * Opens the pigpio handle of an I2C device
+ */
+static int open_i2c(uint8_t bus_id, uint8_t addr)
+{
+    return i2cOpen(bus_id, addr, 0);
+}
+
+/*!
+ * Opens the pigpio handle of an SPI channel
+ */
+static int open_spi(uint8_t bus_id, uint8_t cs)
+{
+    /* Bit 8 of the pigpio SPI flags selects the auxiliary SPI */
+    return spiOpen(cs, BME69X_SPI_SPEED, (bus_id != 0) ? 0x100 : 0);
+}
+
+/*!
+ * Closes the pigpio handle of a sensor
+ */
+static void close_handle(uint8_t intf, int handle)
+{
+    if (intf == BME69X_I2C_INTF)
+    {
+        i2cClose(handle);
+    }
+    else
+    {
+        spiClose(handle);
+    }
+}
+
+#endif
+
+/*!
+ * Poller thread of a bus
+ */
+static void *bus_poller(void *arg)
+{
+    struct bme69x_bus *bus = (struct bme69x_bus *)arg;
+
+    while (bus->running)
+    {
+        bus->poll(bus, bus->poll_arg);
+    }
+
+    return NULL;
+}
+
+int8_t bme69x_bus_open(struct bme69x_bus *bus, uint8_t intf, uint8_t bus_id)
+{
+    int8_t rslt;
+
+    if ((bus == NULL) || ((intf != BME69X_I2C_INTF) && (intf != BME69X_SPI_INTF)))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    rslt = pigpio_acquire();
+    if (rslt == BME69X_OK)
+    {
+        (void)memset(bus, 0, sizeof(*bus));
+        bus->intf = intf;
+        bus->bus_id = bus_id;
+        if (pthread_mutex_init(&bus->lock, NULL) != 0)
+        {
+            pigpio_release();
+            rslt = BME69X_E_COM_FAIL;
+        }
+    }
+
+    return rslt;
+}
+
+void bme69x_bus_close(struct bme69x_bus *bus)
+{
+    if (bus == NULL)
+    {
+        return;
+    }
+
+    bme69x_bus_stop(bus);
+
+    while (bus->n_sensors > 0)
+    {
+        bme69x_sensor_detach(bus->sensors[bus->n_sensors - 1]);
+    }
+
+    (void)pthread_mutex_destroy(&bus->lock);
+    pigpio_release();
+}
+
+int8_t bme69x_sensor_attach(struct bme69x_sensor_ctx *ctx, struct bme69x_bus *bus, uint8_t addr, struct bme69x_dev *bme)
+{
+    int8_t rslt = BME69X_OK;
+
+    if ((ctx == NULL) || (bus == NULL) || (bme == NULL))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    /* Only set once the sensor is on the bus, bme69x_bus_close would close it otherwise */
+    ctx->bus = NULL;
+    ctx->addr = addr;
+    ctx->dev = bme;
+    ctx->slot = NULL;
+    (void)memset(ctx->tx_buff, 0, sizeof(ctx->tx_buff));
+
+    if (bus->intf == BME69X_I2C_INTF)
+    {
+        ctx->handle = open_i2c(bus->bus_id, addr);
+        if (ctx->handle < 0)
+        {
+            printf("Failed to open I2C bus %d, device 0x%02X\n", bus->bus_id, addr);
+
+            return BME69X_E_COM_FAIL;
+        }
+
+        bme->read = bme69x_i2c_read;
+        bme->write = bme69x_i2c_write;
+        bme->intf = BME69X_I2C_INTF;
+    }
+    else
+    {
+        ctx->handle = open_spi(bus->bus_id, addr);
+        if (ctx->handle < 0)
+        {
+            printf("Failed to open SPI bus %d, chip select %d\n", bus->bus_id, addr);
+
+            return BME69X_E_COM_FAIL;
+        }
+
+        bme->read = bme69x_spi_read;
+        bme->write = bme69x_spi_write;
+        bme->intf = BME69X_SPI_INTF;
+    }
+
+    bme->delay_us = bme69x_delay_us;
+    bme->get_time_ns = bme69x_get_time_ns;
+    bme->intf_ptr = ctx;
+    bme->amb_temp = 25; /* The ambient temperature in deg C is used for defining the heater temperature */
+
+    (void)pthread_mutex_lock(&bus->lock);
+    if (bus->n_sensors >= BME69X_BUS_MAX_SENSORS)
+    {
+        rslt = BME69X_E_INVALID_LENGTH;
+    }
+    else
+    {
+        ctx->bus = bus;
+        bus->sensors[bus->n_sensors++] = ctx;
+    }
+
+    (void)pthread_mutex_unlock(&bus->lock);
+
+    if (rslt != BME69X_OK)
+    {
+        printf("Bus %d is full, sensor 0x%02X not attached\n", bus->bus_id, addr);
+        close_handle(bus->intf, ctx->handle);
+        ctx->handle = -1;
+    }
+
+    return rslt;
+}
+
+void bme69x_sensor_detach(struct bme69x_sensor_ctx *ctx)
+{
+    struct bme69x_bus *bus;
+    uint8_t i;
+
+    if ((ctx == NULL) || (ctx->bus == NULL))
+    {
+        return;
+    }
+
+    bus = ctx->bus;
+
+    (void)pthread_mutex_lock(&bus->lock);
+    for (i = 0; i < bus->n_sensors; i++)
+    {
+        if (bus->sensors[i] == ctx)
+        {
+            bus->sensors[i] = bus->sensors[bus->n_sensors - 1];
+            bus->n_sensors--;
+            break;
+        }
+    }
+
+    if (ctx->handle >= 0)
+    {
+        close_handle(bus->intf, ctx->handle);
+        ctx->handle = -1;
+    }
+
+    (void)pthread_mutex_unlock(&bus->lock);
+
+    ctx->bus = NULL;
+}
+
+int8_t bme69x_bus_start(struct bme69x_bus *bus, bme69x_bus_poll_fptr_t poll, void *arg)
+{
+    if ((bus == NULL) || (poll == NULL))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    if (bus->running)
+    {
+        return BME69X_OK;
+    }
+
+    bus->poll = poll;
+    bus->poll_arg = arg;
+    bus->running = true;
+    if (pthread_create(&bus->poller, NULL, bus_poller, bus) != 0)
+    {
+        bus->running = false;
+
+        return BME69X_E_COM_FAIL;
+    }
+
+    return BME69X_OK;
+}
+
+void bme69x_bus_stop(struct bme69x_bus *bus)
+{
+    if ((bus != NULL) && bus->running)
+    {
+        bus->running = false;
+        (void)pthread_join(bus->poller, NULL);
+    }
+}
+
+int8_t bme69x_interface_init(struct bme69x_dev *bme, uint8_t intf)
+{
+    int8_t rslt;
+    uint8_t addr;
+
+    if (bme == NULL)
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    if (intf == BME69X_I2C_INTF)
+    {
+        printf("I2C Interface\n");
+        rslt = bme69x_bus_open(&default_bus, BME69X_I2C_INTF, BME69X_I2C_BUS);
+        addr = BME69X_I2C_ADDR_HIGH;
+    }
+    /* Bus configuration : SPI */
+    else
+    {
+        printf("SPI Interface\n");
+        rslt = bme69x_bus_open(&default_bus, BME69X_SPI_INTF, BME69X_SPI_BUS);
+        addr = 0;
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = bme69x_sensor_attach(&default_ctx, &default_bus, addr, bme);
+        if (rslt == BME69X_OK)
+        {
+            printf("Connection opened successfully (handle: %d)\n", default_ctx.handle);
+        }
+        else
+        {
+            bme69x_bus_close(&default_bus);
+        }
+    }
+
+    return rslt;
+}
+
+void bme69x_pigpio_deinit(void)
+{
+    (void)fflush(stdout);
+
+    if (default_ctx.bus != NULL)
+    {
+        bme69x_bus_close(&default_bus);
+    }
+}
@@ -1,125 +1,286 @@
-/**
- * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
- *
- * SPDX-License-Identifier: BSD-3-Clause
- */
-
-#include <stdbool.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif /*__cplusplus */
-
-#include "bme69x.h"
-
-/*!
- *  @brief Function to select the interface between SPI and I2C.
- *
- *  @param[in] bme      : Structure instance of bme69x_dev
- *  @param[in] intf     : Interface selection parameter
- *
- *  @return Status of execution
- *  @retval 0 -> Success
- *  @retval < 0 -> Failure Info
- */
-int8_t bme69x_interface_init(struct bme69x_dev *bme, uint8_t intf);
-
-/*!
- *  @brief Function for reading the sensor's registers through I2C bus.
- *
- *  @param[in] reg_addr     : Register address.
- *  @param[out] reg_data    : Pointer to the data buffer to store the read data.
- *  @param[in] len          : No of bytes to read.
- *  @param[in] intf_ptr     : Interface pointer
- *
- *  @return Status of execution
- *  @retval = BME69X_INTF_RET_SUCCESS -> Success
- *  @retval != BME69X_INTF_RET_SUCCESS  -> Failure Info
- *
- */
-BME69X_INTF_RET_TYPE bme69x_i2c_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
-
-/*!
- *  @brief Function for writing the sensor's registers through I2C bus.
- *
- *  @param[in] reg_addr     : Register address.
- *  @param[in] reg_data     : Pointer to the data buffer whose value is to be written.
- *  @param[in] len          : No of bytes to write.
- *  @param[in] intf_ptr     : Interface pointer
- *
- *  @return Status of execution
- *  @retval = BME69X_INTF_RET_SUCCESS -> Success
- *  @retval != BME69X_INTF_RET_SUCCESS  -> Failure Info
- *
- */
-BME69X_INTF_RET_TYPE bme69x_i2c_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
-
-/*!
- *  @brief Function for reading the sensor's registers through SPI bus.
- *
- *  @param[in] reg_addr     : Register address.
- *  @param[out] reg_data    : Pointer to the data buffer to store the read data.
- *  @param[in] len          : No of bytes to read.
- *  @param[in] intf_ptr     : Interface pointer
- *
- *  @return Status of execution
- *  @retval = BME69X_INTF_RET_SUCCESS -> Success
- *  @retval != BME69X_INTF_RET_SUCCESS  -> Failure Info
- *
- */
-BME69X_INTF_RET_TYPE bme69x_spi_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
-
-/*!
- *  @brief Function for writing the sensor's registers through SPI bus.
- *
- *  @param[in] reg_addr     : Register address.
- *  @param[in] reg_data     : Pointer to the data buffer whose data has to be written.
- *  @param[in] len          : No of bytes to write.
- *  @param[in] intf_ptr     : Interface pointer
- *
- *  @return Status of execution
- *  @retval = BME69X_INTF_RET_SUCCESS -> Success
- *  @retval != BME69X_INTF_RET_SUCCESS  -> Failure Info
- *
- */
-BME69X_INTF_RET_TYPE bme69x_spi_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
-
-/*!
- * @brief This function provides the delay for required time (Microsecond) as per the input provided in some of the
- * APIs.
- *
- *  @param[in] period       : The required wait time in microsecond.
- *  @param[in] intf_ptr     : Interface pointer
- *
- *  @return void.
- *
- */
-void bme69x_delay_us(uint32_t period, void *intf_ptr);
-
-/*!
- *  @brief Prints the execution status of the APIs.
- *
- *  @param[in] api_name : Name of the API whose execution status has to be printed.
- *  @param[in] rslt     : Error code returned by the API whose execution status has to be printed.
- *
- *  @return void.
- */
-void bme69x_check_rslt(const char api_name[], int8_t rslt);
-
-/*!
- *  @brief Deinitializes pigpio platform
- *
- *  @return void.
- */
-void bme69x_pigpio_deinit(void);
-
-/*!
- *  @brief Get current time in milliseconds
- *
- *  @return Current time in milliseconds
- */
-uint32_t bme69x_get_millis(void);
-
-#ifdef __cplusplus
-}
-#endif /*__cplusplus */
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef COMMON_H_
+#define COMMON_H_
+
+#include <stdbool.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include "bme69x.h"
+
+/*! Maximum number of sensors that can share one bus */
+#define BME69X_BUS_MAX_SENSORS  UINT8_C(16)
+
+/*! Length of the transfer buffers of a sensor context, a longer SPI read is split into several bursts */
+#define BME69X_INTF_BUF_LEN     UINT8_C(64)
+
+struct bme69x_bus;
+struct bme69x_loop_slot;
+
+/*!
+ * @brief Per-sensor interface context. An instance of this structure is linked
+ * to bme69x_dev.intf_ptr, so that every sensor carries its own handle while
+ * sharing the bus it is attached to.
+ */
+struct bme69x_sensor_ctx
+{
+    /*! Bus the sensor is attached to */
+    struct bme69x_bus *bus;
+
+    /*! pigpio handle, or file descriptor with BME69X_USE_KERNEL_INTF, of the I2C device or of the SPI channel */
+    int handle;
+
+    /*! I2C address or SPI chip select of the sensor */
+    uint8_t addr;
+
+    /*! Device structure linked to this context */
+    struct bme69x_dev *dev;
+
+    /*! Event loop slot of the sensor, NULL unless added with bme69x_loop_add */
+    struct bme69x_loop_slot *slot;
+
+    /*! SPI transmit buffer, zero but for the register address */
+    uint8_t tx_buff[BME69X_INTF_BUF_LEN];
+
+    /*! SPI receive buffer, the register address slot followed by the data */
+    uint8_t rx_buff[BME69X_INTF_BUF_LEN];
+};
+
+/*!
+ * @brief Poller callback, called repeatedly from the bus thread until the bus is stopped
+ *
+ * @param[in,out] bus : Bus on which the poller runs
+ * @param[in,out] arg : User argument given to bme69x_bus_start
+ */
+typedef void (*bme69x_bus_poll_fptr_t)(struct bme69x_bus *bus, void *arg);
+
+/*!
+ * @brief Bus context shared by all the sensors attached to one I2C or SPI bus
+ */
+struct bme69x_bus
+{
+    /*! SPI/I2C interface. Refer enum bme69x_intf */
+    uint8_t intf;
+
+    /*! I2C bus number, or SPI bus (0 : main, 1 : auxiliary) */
+    uint8_t bus_id;
+
+    /*! Serializes the transfers of the attached sensors */
+    pthread_mutex_t lock;
+
+    /*! Sensors attached to the bus */
+    struct bme69x_sensor_ctx *sensors[BME69X_BUS_MAX_SENSORS];
+
+    /*! Number of attached sensors */
+    uint8_t n_sensors;
+
+    /*! Poller thread of the bus */
+    pthread_t poller;
+
+    /*! Poller callback */
+    bme69x_bus_poll_fptr_t poll;
+
+    /*! Argument of the poller callback */
+    void *poll_arg;
+
+    /*! Set while the poller thread is running */
+    volatile bool running;
+};
+
+/*!
+ *  @brief Function to select the interface between SPI and I2C.
+ *
+ *  @param[in] bme      : Structure instance of bme69x_dev
+ *  @param[in] intf     : Interface selection parameter
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_interface_init(struct bme69x_dev *bme, uint8_t intf);
+
+/*!
+ *  @brief Opens a bus shared by several sensors. pigpio is initialized on the first opened bus.
+ *
+ *  @param[out] bus     : Bus context to initialize
+ *  @param[in] intf     : Interface of the bus, BME69X_I2C_INTF or BME69X_SPI_INTF
+ *  @param[in] bus_id   : I2C bus number, or SPI bus (0 : main, 1 : auxiliary)
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_bus_open(struct bme69x_bus *bus, uint8_t intf, uint8_t bus_id);
+
+/*!
+ *  @brief Closes a bus, detaching the remaining sensors. pigpio is terminated with the last bus.
+ *
+ *  @param[in,out] bus  : Bus context to close
+ *
+ *  @return void.
+ */
+void bme69x_bus_close(struct bme69x_bus *bus);
+
+/*!
+ *  @brief Attaches a sensor to a bus and links the context to the device structure
+ *
+ *  @param[out] ctx     : Sensor context, has to stay valid while the sensor is attached
+ *  @param[in,out] bus  : Bus the sensor is connected to
+ *  @param[in] addr     : I2C address or SPI chip select of the sensor
+ *  @param[out] bme     : Structure instance of bme69x_dev to link to the context
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_sensor_attach(struct bme69x_sensor_ctx *ctx, struct bme69x_bus *bus, uint8_t addr, struct bme69x_dev *bme);
+
+/*!
+ *  @brief Detaches a sensor from its bus and releases its handle
+ *
+ *  @param[in,out] ctx  : Sensor context
+ *
+ *  @return void.
+ */
+void bme69x_sensor_detach(struct bme69x_sensor_ctx *ctx);
+
+/*!
+ *  @brief Starts the poller thread of a bus
+ *
+ *  @param[in,out] bus  : Bus context
+ *  @param[in] poll     : Callback called repeatedly from the poller thread
+ *  @param[in] arg      : User argument passed to the callback
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_bus_start(struct bme69x_bus *bus, bme69x_bus_poll_fptr_t poll, void *arg);
+
+/*!
+ *  @brief Stops the poller thread of a bus and waits for it to return
+ *
+ *  @param[in,out] bus  : Bus context
+ *
+ *  @return void.
+ */
+void bme69x_bus_stop(struct bme69x_bus *bus);
+
+/*!
+ *  @brief Function for reading the sensor's registers through I2C bus.
+ *
+ *  @param[in] reg_addr     : Register address.
+ *  @param[out] reg_data    : Pointer to the data buffer to store the read data.
+ *  @param[in] len          : No of bytes to read.
+ *  @param[in] intf_ptr     : Interface pointer
+ *
+ *  @return Status of execution
+ *  @retval = BME69X_INTF_RET_SUCCESS -> Success
+ *  @retval != BME69X_INTF_RET_SUCCESS  -> Failure Info
+ *
+ */
+BME69X_INTF_RET_TYPE bme69x_i2c_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Function for writing the sensor's registers through I2C bus.
+ *
+ *  @param[in] reg_addr     : Register address.
+ *  @param[in] reg_data     : Pointer to the data buffer whose value is to be written.
+ *  @param[in] len          : No of bytes to write.
+ *  @param[in] intf_ptr     : Interface pointer
+ *
+ *  @return Status of execution
+ *  @retval = BME69X_INTF_RET_SUCCESS -> Success
+ *  @retval != BME69X_INTF_RET_SUCCESS  -> Failure Info
+ *
+ */
+BME69X_INTF_RET_TYPE bme69x_i2c_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Function for reading the sensor's registers through SPI bus.
+ *
+ *  @param[in] reg_addr     : Register address.
+ *  @param[out] reg_data    : Pointer to the data buffer to store the read data.
+ *  @param[in] len          : No of bytes to read.
+ *  @param[in] intf_ptr     : Interface pointer
+ *
+ *  @return Status of execution
+ *  @retval = BME69X_INTF_RET_SUCCESS -> Success
+ *  @retval != BME69X_INTF_RET_SUCCESS  -> Failure Info
+ *
+ */
+BME69X_INTF_RET_TYPE bme69x_spi_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Function for writing the sensor's registers through SPI bus.
+ *
+ *  @param[in] reg_addr     : Register address.
+ *  @param[in] reg_data     : Pointer to the data buffer whose data has to be written.
+ *  @param[in] len          : No of bytes to write.
+ *  @param[in] intf_ptr     : Interface pointer
+ *
+ *  @return Status of execution
+ *  @retval = BME69X_INTF_RET_SUCCESS -> Success
+ *  @retval != BME69X_INTF_RET_SUCCESS  -> Failure Info
+ *
+ */
+BME69X_INTF_RET_TYPE bme69x_spi_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This function provides the delay for required time (Microsecond) as per the input provided in some of the
+ * APIs.
+ *
+ *  @param[in] period       : The required wait time in microsecond.
+ *  @param[in] intf_ptr     : Interface pointer
+ *
+ *  @return void.
+ *
+ */
+void bme69x_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief Prints the execution status of the APIs.
+ *
+ *  @param[in] api_name : Name of the API whose execution status has to be printed.
+ *  @param[in] rslt     : Error code returned by the API whose execution status has to be printed.
+ *
+ *  @return void.
+ */
+void bme69x_check_rslt(const char api_name[], int8_t rslt);
+
+/*!
+ *  @brief Deinitializes pigpio platform
+ *
+ *  @return void.
+ */
+void bme69x_pigpio_deinit(void);
+
+/*!
+ *  @brief Function for reading CLOCK_MONOTONIC, linked to bme69x_dev.get_time_ns. See bme69x_time_ns_fptr_t
+ *
+ *  @param[in] intf_ptr     : Interface pointer, unused
+ *
+ *  @return Current time in nanoseconds
+ */
+uint64_t bme69x_get_time_ns(void *intf_ptr);
+
+/*!
+ *  @brief Get current time of CLOCK_MONOTONIC in milliseconds
+ *
+ *  @return Current time in milliseconds
+ */
+uint64_t bme69x_get_millis(void);
+
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* COMMON_H_ */
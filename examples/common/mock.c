@@ -0,0 +1,466 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "bme69x.h"
+#include "capture.h"
+#include "mock.h"
+
+/******************************************************************************/
+/*!                       Macro definitions                                   */
+
+/*! Variant ID reported by the simulated sensor */
+#define MOCK_VARIANT_ID  UINT8_C(0x01)
+
+/*! Heater current DAC of the simulated sensor, neither cleared nor saturated as the self-test expects */
+#define MOCK_IDAC_HEAT   UINT8_C(0x30)
+
+/*! Unique ID of the simulated sensor */
+static const uint8_t mock_unique_id[BME69X_LEN_UNIQUE_ID] = { 0x4d, 0x0c, 0x6b, 0x21 };
+
+/*! Calibration coefficients of the simulated sensor, not those of a real part */
+static const uint8_t mock_coeff[BME69X_LEN_COEFF_ALL] = {
+    0x3f, 0x67, 0x03, 0x10, 0x8c, 0x90, 0x7d, 0xd8, 0x58, 0x00, 0x1d, 0x2a, 0xe9, 0xff, 0x66, 0x1e,
+    0x00, 0x00, 0xee, 0xf9, 0xe6, 0x3c, 0x00, 0x3e, 0xc3, 0x28, 0x00, 0x2d, 0x00, 0x14, 0x78, 0x9c,
+    0x9b, 0x66, 0x8f, 0xb4, 0x12, 0xaa, 0x01, 0x28, 0x16, 0x19
+};
+
+/******************************************************************************/
+/*!                 Static function definitions                               */
+
+/*!
+ * Returns the register of the I2C map addressed by an SPI address on the current memory page
+ */
+static uint8_t spi_to_i2c(const struct bme69x_mock *mock, uint8_t spi_addr)
+{
+    spi_addr &= BME69X_SPI_WR_MSK;
+
+    /* The memory page register is on both pages */
+    if (spi_addr == (BME69X_REG_MEM_PAGE & BME69X_SPI_WR_MSK))
+    {
+        return BME69X_REG_MEM_PAGE;
+    }
+
+    if ((mock->regs[BME69X_REG_MEM_PAGE] & BME69X_MEM_PAGE_MSK) == BME69X_MEM_PAGE0)
+    {
+        return spi_addr;
+    }
+
+    return (uint8_t)(spi_addr | 0x80);
+}
+
+/*!
+ * Advances the virtual time by the duration of a transfer of len bytes after the register address
+ */
+static void bus_xfer(struct bme69x_mock *mock, uint32_t len, bool read)
+{
+    uint64_t bits;
+    uint64_t ns;
+
+    if (mock->intf == BME69X_I2C_INTF)
+    {
+        /* Device address, register address and data, each acknowledged, then start and stop.
+         * A read repeats the start and the device address. */
+        bits = (9 * (2 + (uint64_t)len)) + 2;
+        if (read)
+        {
+            bits += 9 + 1;
+        }
+    }
+    else
+    {
+        bits = 8 * (1 + (uint64_t)len);
+    }
+
+    ns = ((bits * UINT64_C(1000000000)) / mock->bus_hz) + mock->xfer_ns;
+    mock->now_ns += ns;
+    mock->stats.bus_ns += ns;
+}
+
+/*!
+ * Decodes a gas wait register into milliseconds
+ */
+static uint32_t gas_wait_ms(uint8_t reg)
+{
+    return (uint32_t)(reg & 0x3f) << (2 * (reg >> 6));
+}
+
+/*!
+ * Duration of the next measurement in nanoseconds
+ */
+static uint64_t meas_dur_ns(const struct bme69x_mock *mock, uint8_t mode)
+{
+    static const uint8_t os_to_meas_cycles[8] = { 0, 1, 2, 4, 8, 16, 16, 16 };
+    uint8_t ctrl_meas = mock->regs[BME69X_REG_CTRL_MEAS];
+    uint8_t ctrl_gas = mock->regs[BME69X_REG_CTRL_GAS_1];
+    uint64_t us;
+
+    us = os_to_meas_cycles[ctrl_meas >> 5];
+    us += os_to_meas_cycles[(ctrl_meas >> 2) & 0x07];
+    us += os_to_meas_cycles[mock->regs[BME69X_REG_CTRL_HUM] & BME69X_OSH_MSK];
+    us = (us * 1963) + (477 * 4) + (477 * 5);
+
+    if (mode != BME69X_PARALLEL_MODE)
+    {
+        us += 1000;
+    }
+
+    if (ctrl_gas & BME69X_RUN_GAS_MSK)
+    {
+        switch (mode)
+        {
+            case BME69X_FORCED_MODE:
+                us += (uint64_t)gas_wait_ms(mock->regs[BME69X_REG_GAS_WAIT0 + (ctrl_gas & BME69X_NBCONV_MSK)]) * 1000;
+                break;
+            case BME69X_SEQUENTIAL_MODE:
+                us += (uint64_t)gas_wait_ms(mock->regs[BME69X_REG_GAS_WAIT0 + mock->gas_step]) * 1000;
+                break;
+            default:
+                /* Shared heater duration in steps of 0.477 ms */
+                us += ((uint64_t)gas_wait_ms(mock->regs[BME69X_REG_SHD_HEATR_DUR]) * 477);
+                break;
+        }
+    }
+
+    return us * 1000;
+}
+
+/*!
+ * Fills raw values, from the trace or synthetic
+ */
+static void next_raw(struct bme69x_mock *mock, struct bme69x_raw_field *raw, uint8_t gas_index)
+{
+    uint32_t tries;
+
+    if (mock->trace != NULL)
+    {
+        for (tries = 0; tries < mock->trace->n_records; tries++)
+        {
+            if (mock->trace_pos >= mock->trace->n_records)
+            {
+                mock->trace_pos = 0;
+            }
+
+            if (bme69x_capture_get_raw(mock->trace, mock->trace_pos++, raw, NULL) == BME69X_OK)
+            {
+                return;
+            }
+        }
+    }
+
+    /* Slowly varying values, about 23 degC, 101.6 kPa and 45 %r.H. with the coefficients of the simulated sensor */
+    raw->temp_adc = UINT32_C(0xaa0000) + ((mock->stats.n_meas & 0xff) << 4);
+    raw->pres_adc = UINT32_C(0x030000) + ((mock->stats.n_meas & 0x7f) << 4);
+    raw->hum_adc = (uint16_t)(0xac00 + (mock->stats.n_meas & 0x3f));
+    raw->gas_adc = (uint16_t)(0x200 + (mock->stats.n_meas & 0x1f));
+
+    /* The gas resistance halves every 32 heater resistance steps, so it falls as the heater gets hotter */
+    raw->gas_range = (uint8_t)(mock->regs[BME69X_REG_RES_HEAT0 + (gas_index % 10)] >> 5);
+}
+
+/*!
+ * Stores the result of a measurement in a data field
+ */
+static void complete_meas(struct bme69x_mock *mock, uint8_t mode)
+{
+    struct bme69x_raw_field raw;
+    uint8_t nb_conv = mock->regs[BME69X_REG_CTRL_GAS_1] & BME69X_NBCONV_MSK;
+    uint8_t gas_index;
+    uint8_t *field;
+
+    if (mode == BME69X_FORCED_MODE)
+    {
+        field = &mock->regs[BME69X_REG_FIELD0];
+        gas_index = nb_conv;
+    }
+    else
+    {
+        field = &mock->regs[BME69X_REG_FIELD0 + (mock->field * BME69X_LEN_FIELD_OFFSET)];
+        mock->field = (uint8_t)((mock->field + 1) % 3);
+        gas_index = mock->gas_step;
+        mock->gas_step = (uint8_t)((mock->gas_step + 1) % ((nb_conv > 0) ? nb_conv : 1));
+    }
+
+    next_raw(mock, &raw, gas_index);
+
+    field[0] = (uint8_t)(BME69X_NEW_DATA_MSK | (gas_index & BME69X_GAS_INDEX_MSK));
+    field[1] = mock->meas_index++;
+    field[2] = (uint8_t)(raw.pres_adc >> 16);
+    field[3] = (uint8_t)(raw.pres_adc >> 8);
+    field[4] = (uint8_t)raw.pres_adc;
+    field[5] = (uint8_t)(raw.temp_adc >> 16);
+    field[6] = (uint8_t)(raw.temp_adc >> 8);
+    field[7] = (uint8_t)raw.temp_adc;
+    field[8] = (uint8_t)(raw.hum_adc >> 8);
+    field[9] = (uint8_t)raw.hum_adc;
+    field[15] = (uint8_t)(raw.gas_adc >> 2);
+    field[16] = (uint8_t)(((raw.gas_adc & 0x03) << 6) | (raw.gas_range & BME69X_GAS_RANGE_MSK));
+
+    if (mock->regs[BME69X_REG_CTRL_GAS_1] & BME69X_RUN_GAS_MSK)
+    {
+        field[16] |= BME69X_GASM_VALID_MSK | BME69X_HEAT_STAB_MSK;
+    }
+
+    mock->stats.n_meas++;
+}
+
+/*!
+ * Completes the measurements due by the current virtual time
+ */
+static void update(struct bme69x_mock *mock)
+{
+    uint8_t mode;
+
+    while ((mock->meas_done_ns != 0) && (mock->now_ns >= mock->meas_done_ns))
+    {
+        mode = mock->regs[BME69X_REG_CTRL_MEAS] & BME69X_MODE_MSK;
+        complete_meas(mock, mode);
+
+        if (mode == BME69X_FORCED_MODE)
+        {
+            /* Back to sleep */
+            mock->regs[BME69X_REG_CTRL_MEAS] &= (uint8_t)~BME69X_MODE_MSK;
+            mock->meas_done_ns = 0;
+        }
+        else
+        {
+            mock->meas_done_ns += meas_dur_ns(mock, mode);
+        }
+    }
+}
+
+/*!
+ * Puts the registers in their reset state, the calibration registers are kept
+ */
+static void reset(struct bme69x_mock *mock)
+{
+    memset(&mock->regs[BME69X_REG_FIELD0], 0, (BME69X_REG_CONFIG - BME69X_REG_FIELD0) + 1);
+    memset(&mock->regs[BME69X_REG_IDAC_HEAT0], MOCK_IDAC_HEAT, 10);
+    mock->regs[BME69X_REG_MEM_PAGE] = 0;
+    mock->regs[BME69X_REG_CHIP_ID] = BME69X_CHIP_ID;
+    mock->regs[BME69X_REG_VARIANT_ID] = MOCK_VARIANT_ID;
+    mock->meas_done_ns = 0;
+    mock->meas_index = 0;
+    mock->field = 0;
+    mock->gas_step = 0;
+}
+
+/*!
+ * Writes one register
+ */
+static void write_reg(struct bme69x_mock *mock, uint8_t reg_addr, uint8_t val)
+{
+    uint8_t mode;
+
+    switch (reg_addr)
+    {
+        case BME69X_REG_SOFT_RESET:
+            if (val == BME69X_SOFT_RESET_CMD)
+            {
+                reset(mock);
+            }
+
+            break;
+        case BME69X_REG_MEM_PAGE:
+            if ((val & BME69X_MEM_PAGE_MSK) != mock->regs[reg_addr])
+            {
+                mock->stats.n_page_switches++;
+            }
+
+            mock->regs[reg_addr] = val & BME69X_MEM_PAGE_MSK;
+            break;
+        case BME69X_REG_CTRL_MEAS:
+            mock->regs[reg_addr] = val;
+            mode = val & BME69X_MODE_MSK;
+            mock->gas_step = 0;
+            mock->meas_done_ns = (mode == BME69X_SLEEP_MODE) ? 0 : (mock->now_ns + meas_dur_ns(mock, mode));
+            break;
+        default:
+
+            /* Only the control and heater registers are writable */
+            if ((reg_addr >= BME69X_REG_IDAC_HEAT0) && (reg_addr <= BME69X_REG_CONFIG))
+            {
+                mock->regs[reg_addr] = val;
+            }
+
+            break;
+    }
+}
+
+/******************************************************************************/
+/*!                User interface functions                                   */
+
+void bme69x_mock_init(struct bme69x_mock *mock, uint8_t intf, uint32_t bus_hz)
+{
+    memset(mock, 0, sizeof(*mock));
+    mock->intf = intf;
+    mock->bus_hz = bus_hz;
+    bme69x_mock_load_coeff(mock, mock_coeff);
+    memcpy(&mock->regs[BME69X_REG_UNIQUE_ID], mock_unique_id, BME69X_LEN_UNIQUE_ID);
+    reset(mock);
+}
+
+void bme69x_mock_attach(struct bme69x_mock *mock, struct bme69x_dev *bme)
+{
+    bme->read = bme69x_mock_read;
+    bme->write = bme69x_mock_write;
+    bme->delay_us = bme69x_mock_delay_us;
+    bme->submit = bme69x_mock_submit;
+    bme->get_time_ns = bme69x_mock_time_ns;
+    bme->intf = mock->intf;
+    bme->intf_ptr = mock;
+    bme->amb_temp = 25;
+}
+
+void bme69x_mock_load_coeff(struct bme69x_mock *mock, const uint8_t *coeff)
+{
+    memcpy(&mock->regs[BME69X_REG_COEFF1], coeff, BME69X_LEN_COEFF1);
+    memcpy(&mock->regs[BME69X_REG_COEFF2], &coeff[BME69X_LEN_COEFF1], BME69X_LEN_COEFF2);
+    memcpy(&mock->regs[BME69X_REG_COEFF3], &coeff[BME69X_LEN_COEFF1 + BME69X_LEN_COEFF2], BME69X_LEN_COEFF3);
+}
+
+void bme69x_mock_set_trace(struct bme69x_mock *mock, struct bme69x_capture_reader *trace)
+{
+    mock->trace = trace;
+    mock->trace_pos = 0;
+
+    if (trace != NULL)
+    {
+        bme69x_mock_load_coeff(mock, bme69x_capture_coeff(trace));
+    }
+}
+
+uint64_t bme69x_mock_now_us(const struct bme69x_mock *mock)
+{
+    return mock->now_ns / 1000;
+}
+
+uint64_t bme69x_mock_time_ns(void *intf_ptr)
+{
+    return ((const struct bme69x_mock *)intf_ptr)->now_ns;
+}
+
+BME69X_INTF_RET_TYPE bme69x_mock_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bme69x_mock *mock = (struct bme69x_mock *)intf_ptr;
+    uint8_t reg;
+    uint32_t i;
+
+    bus_xfer(mock, len, true);
+    update(mock);
+
+    for (i = 0; i < len; i++)
+    {
+        if (mock->intf == BME69X_SPI_INTF)
+        {
+            reg = spi_to_i2c(mock, (uint8_t)(reg_addr + i));
+        }
+        else
+        {
+            reg = (uint8_t)(reg_addr + i);
+        }
+
+        reg_data[i] = mock->regs[reg];
+
+        /* Reading the data of a field consumes it, polling the status byte alone does not */
+        if ((reg >= BME69X_REG_FIELD0) && (reg < (BME69X_REG_FIELD0 + (3 * BME69X_LEN_FIELD_OFFSET))) &&
+            (((reg - BME69X_REG_FIELD0) % BME69X_LEN_FIELD_OFFSET) == 2))
+        {
+            mock->regs[reg - 2] &= (uint8_t)~BME69X_NEW_DATA_MSK;
+        }
+    }
+
+    mock->stats.n_reads++;
+    mock->stats.bytes_read += len;
+
+    return BME69X_INTF_RET_SUCCESS;
+}
+
+BME69X_INTF_RET_TYPE bme69x_mock_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bme69x_mock *mock = (struct bme69x_mock *)intf_ptr;
+    uint8_t reg = reg_addr;
+    uint32_t i;
+
+    bus_xfer(mock, len, false);
+    update(mock);
+
+    /* Register address and data pairs, the first address being reg_addr */
+    for (i = 0; i < len; i += 2)
+    {
+        if (i > 0)
+        {
+            reg = reg_data[i - 1];
+        }
+
+        if (mock->intf == BME69X_SPI_INTF)
+        {
+            reg = spi_to_i2c(mock, reg);
+        }
+
+        write_reg(mock, reg, reg_data[i]);
+    }
+
+    mock->stats.n_writes++;
+    mock->stats.bytes_written += len + 1;
+
+    return BME69X_INTF_RET_SUCCESS;
+}
+
+void bme69x_mock_delay_us(uint32_t period, void *intf_ptr)
+{
+    struct bme69x_mock *mock = (struct bme69x_mock *)intf_ptr;
+
+    mock->now_ns += (uint64_t)period * 1000;
+    mock->stats.delay_ns += (uint64_t)period * 1000;
+}
+
+BME69X_INTF_RET_TYPE bme69x_mock_submit(const struct bme69x_xfer *xfer, struct bme69x_async *op, void *intf_ptr)
+{
+    struct bme69x_mock *mock = (struct bme69x_mock *)intf_ptr;
+
+    /* One transfer in flight per sensor */
+    if (mock->op != NULL)
+    {
+        return BME69X_E_COM_FAIL;
+    }
+
+    mock->op = op;
+    mock->xfer = xfer;
+
+    return BME69X_INTF_RET_SUCCESS;
+}
+
+int8_t bme69x_mock_run(struct bme69x_mock *mock)
+{
+    struct bme69x_async *op = mock->op;
+    const struct bme69x_xfer *xfer = mock->xfer;
+    BME69X_INTF_RET_TYPE rslt = BME69X_INTF_RET_SUCCESS;
+
+    if (op == NULL)
+    {
+        return BME69X_W_NO_NEW_DATA;
+    }
+
+    /* The completion may submit the next transfer */
+    mock->op = NULL;
+
+    switch (xfer->type)
+    {
+        case BME69X_XFER_READ:
+            rslt = bme69x_mock_read(xfer->reg_addr, xfer->reg_data, xfer->len, mock);
+            break;
+        case BME69X_XFER_WRITE:
+            rslt = bme69x_mock_write(xfer->reg_addr, xfer->reg_data, xfer->len, mock);
+            break;
+        default:
+            bme69x_mock_delay_us(xfer->period, mock);
+            break;
+    }
+
+    return bme69x_async_complete(op, rslt);
+}
@@ -0,0 +1,202 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MOCK_H_
+#define MOCK_H_
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include "bme69x.h"
+#include "capture.h"
+
+/*! Standard mode I2C clock */
+#define BME69X_MOCK_I2C_100K  UINT32_C(100000)
+
+/*! Fast mode I2C clock */
+#define BME69X_MOCK_I2C_400K  UINT32_C(400000)
+
+/*! 1 MHz SPI clock */
+#define BME69X_MOCK_SPI_1M    UINT32_C(1000000)
+
+/*! 10 MHz SPI clock */
+#define BME69X_MOCK_SPI_10M   UINT32_C(10000000)
+
+/*!
+ * @brief Bus traffic of a simulated sensor
+ */
+struct bme69x_mock_stats
+{
+    /*! Number of read transactions */
+    uint32_t n_reads;
+
+    /*! Number of write transactions */
+    uint32_t n_writes;
+
+    /*! Number of data bytes read */
+    uint32_t bytes_read;
+
+    /*! Number of data bytes written, register addresses included */
+    uint32_t bytes_written;
+
+    /*! Number of SPI memory page switches */
+    uint32_t n_page_switches;
+
+    /*! Number of completed measurements */
+    uint32_t n_meas;
+
+    /*! Time spent on the bus, in nanoseconds */
+    uint64_t bus_ns;
+
+    /*! Time spent in delay_us, in nanoseconds */
+    uint64_t delay_ns;
+};
+
+/*!
+ * @brief Simulated sensor plugged into bme69x_dev.read, write and delay_us.
+ * Time is virtual, it only advances with the modelled bus transfers and the
+ * delays requested by the driver, so the simulation runs as fast as the host.
+ */
+struct bme69x_mock
+{
+    /*! Register map, in I2C addressing */
+    uint8_t regs[256];
+
+    /*! SPI/I2C interface. Refer enum bme69x_intf */
+    uint8_t intf;
+
+    /*! Bus clock in Hz */
+    uint32_t bus_hz;
+
+    /*! Fixed cost of every transaction in nanoseconds, e.g. the driver call of the host */
+    uint32_t xfer_ns;
+
+    /*! Virtual time in nanoseconds */
+    uint64_t now_ns;
+
+    /*! Virtual time of the next measurement completion, 0 if none is running */
+    uint64_t meas_done_ns;
+
+    /*! Sub-measurement index of the next measurement */
+    uint8_t meas_index;
+
+    /*! Field receiving the next measurement in parallel and sequential mode */
+    uint8_t field;
+
+    /*! Heater profile step of the next measurement in parallel and sequential mode */
+    uint8_t gas_step;
+
+    /*! Trace replayed through the data fields, NULL for synthetic data */
+    struct bme69x_capture_reader *trace;
+
+    /*! Next trace record */
+    uint32_t trace_pos;
+
+    /*! Bus traffic */
+    struct bme69x_mock_stats stats;
+
+    /*! Operation of the submitted transfer, NULL if none */
+    struct bme69x_async *op;
+
+    /*! Submitted transfer */
+    const struct bme69x_xfer *xfer;
+};
+
+/*!
+ *  @brief Initializes a simulated sensor in its reset state, with a fixed set of calibration coefficients
+ *
+ *  @param[out] mock    : Simulated sensor
+ *  @param[in] intf     : Interface to simulate, BME69X_I2C_INTF or BME69X_SPI_INTF
+ *  @param[in] bus_hz   : Bus clock in Hz, e.g. BME69X_MOCK_I2C_400K
+ *
+ *  @return void.
+ */
+void bme69x_mock_init(struct bme69x_mock *mock, uint8_t intf, uint32_t bus_hz);
+
+/*!
+ *  @brief Links a simulated sensor to a device structure, in place of bme69x_interface_init
+ *
+ *  @param[in,out] mock : Simulated sensor
+ *  @param[out] bme     : Structure instance of bme69x_dev
+ *
+ *  @return void.
+ */
+void bme69x_mock_attach(struct bme69x_mock *mock, struct bme69x_dev *bme);
+
+/*!
+ *  @brief Loads calibration coefficient registers, in the order of bme69x_get_coeff
+ *
+ *  @param[in,out] mock : Simulated sensor
+ *  @param[in] coeff    : Buffer of BME69X_LEN_COEFF_ALL bytes
+ *
+ *  @return void.
+ */
+void bme69x_mock_load_coeff(struct bme69x_mock *mock, const uint8_t *coeff);
+
+/*!
+ *  @brief Replays the data records of a capture as measurement results, looping at the end,
+ *  and loads its calibration coefficients.
+ *
+ *  @param[in,out] mock     : Simulated sensor
+ *  @param[in] trace        : Mapped capture, has to stay mapped while replayed
+ *
+ *  @return void.
+ */
+void bme69x_mock_set_trace(struct bme69x_mock *mock, struct bme69x_capture_reader *trace);
+
+/*!
+ *  @brief Virtual time of a simulated sensor
+ *
+ *  @param[in] mock : Simulated sensor
+ *
+ *  @return Virtual time in microseconds
+ */
+uint64_t bme69x_mock_now_us(const struct bme69x_mock *mock);
+
+/*!
+ *  @brief Virtual time of a simulated sensor in nanoseconds. See bme69x_time_ns_fptr_t
+ */
+uint64_t bme69x_mock_time_ns(void *intf_ptr);
+
+/*!
+ *  @brief Function for reading the registers of a simulated sensor. See bme69x_read_fptr_t
+ */
+BME69X_INTF_RET_TYPE bme69x_mock_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Function for writing the registers of a simulated sensor. See bme69x_write_fptr_t
+ */
+BME69X_INTF_RET_TYPE bme69x_mock_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Advances the virtual time of a simulated sensor. See bme69x_delay_us_fptr_t
+ */
+void bme69x_mock_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief Queues a transfer of an asynchronous operation. See bme69x_submit_fptr_t
+ */
+BME69X_INTF_RET_TYPE bme69x_mock_submit(const struct bme69x_xfer *xfer, struct bme69x_async *op, void *intf_ptr);
+
+/*!
+ *  @brief Performs the queued transfer and completes it, standing in for the event loop of a transport
+ *
+ *  @param[in,out] mock : Simulated sensor
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval > 0 -> Warning, BME69X_W_NO_NEW_DATA if no transfer was queued
+ */
+int8_t bme69x_mock_run(struct bme69x_mock *mock);
+
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* MOCK_H_ */
@@ -0,0 +1,689 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "bme69x.h"
+#include "sched.h"
+
+/******************************************************************************/
+/*!                       Static variables                                    */
+
+/*! Standby time of the ODR settings in microseconds, BME69X_ODR_0_59_MS to BME69X_ODR_NONE */
+static const uint32_t odr_us[] = { 590, 62500, 125000, 250000, 500000, 1000000, 10000, 20000, 0 };
+
+/******************************************************************************/
+/*!                 Static function definitions                               */
+
+/*!
+ * Monotonic time in microseconds
+ */
+static uint64_t sched_now_us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000u) + ((uint64_t)ts.tv_nsec / 1000u);
+}
+
+/*!
+ * Time of a device in nanoseconds, from the clock timestamping its data when it has one
+ */
+static uint64_t dev_now_ns(const struct bme69x_dev *dev)
+{
+    struct timespec ts;
+
+    if ((dev->features & BME69X_FEAT_TIMESTAMP) && (dev->get_time_ns != NULL))
+    {
+        return dev->get_time_ns(dev->intf_ptr);
+    }
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+/*!
+ * Nominal duration of the measurement of a heater profile step, from its start to the end of its gas
+ * conversion, in microseconds. Only the steps of the sequential mode differ from each other.
+ */
+static uint32_t step_us(const struct bme69x_sched_entry *entry, uint8_t gas_index)
+{
+    const struct bme69x_heatr_conf *heatr_conf = entry->heatr_conf;
+
+    if ((entry->op_mode == BME69X_SEQUENTIAL_MODE) && (heatr_conf != NULL) &&
+        (heatr_conf->enable == BME69X_ENABLE) && (heatr_conf->heatr_dur_prof != NULL) &&
+        (gas_index < heatr_conf->profile_len))
+    {
+        return bme69x_get_meas_dur(entry->op_mode, entry->conf, entry->dev) +
+               ((uint32_t)heatr_conf->heatr_dur_prof[gas_index] * 1000);
+    }
+
+    return entry->period_us;
+}
+
+/*!
+ * Estimates the midpoint of the measurement of the new fields of an entry, just read at read_ns.
+ * A forced mode measurement starts at its trigger. The measurements of a continuous mode follow
+ * each other, every step lasting its nominal duration and the standby time of the ODR.
+ */
+static void estimate_mid(struct bme69x_sched_entry *entry, uint64_t read_ns)
+{
+    struct bme69x_timebase *tb = &entry->timebase;
+    struct bme69x_data *data;
+    uint32_t standby_us = (entry->conf->odr < (sizeof(odr_us) / sizeof(odr_us[0]))) ? odr_us[entry->conf->odr] : 0;
+    uint8_t profile_len = 1;
+    uint64_t dur_ns, adv_ns;
+    int64_t end_ns;
+    uint8_t i, j, n, step;
+
+    if ((entry->heatr_conf != NULL) && (entry->heatr_conf->profile_len > 0))
+    {
+        profile_len = entry->heatr_conf->profile_len;
+    }
+
+    for (i = 0; (i < entry->n_data) && (i < 3); i++)
+    {
+        data = &entry->data[i];
+        if (data->timestamp == 0)
+        {
+            data->timestamp = read_ns;
+        }
+
+        dur_ns = (uint64_t)step_us(entry, data->gas_index) * 1000;
+        if (entry->op_mode == BME69X_FORCED_MODE)
+        {
+            entry->mid_ns[i] = entry->trigger_ns + (dur_ns / 2);
+        }
+        else
+        {
+            if (!tb->valid)
+            {
+                tb->offset_ns = (int64_t)data->timestamp;
+                tb->sensor_ns = 0;
+                tb->valid = 1;
+            }
+            else
+            {
+                /* Nominal time of the steps since the last measurement, the lost ones included */
+                n = (uint8_t)(data->meas_index - tb->last_index);
+                adv_ns = 0;
+                for (j = 0; j < n; j++)
+                {
+                    step = (uint8_t)((data->gas_index + profile_len - (j % profile_len)) % profile_len);
+                    adv_ns += ((uint64_t)step_us(entry, step) + standby_us) * 1000;
+                }
+
+                tb->sensor_ns += adv_ns;
+
+                /* The offset only rises by the tolerance, a field read right after its measurement lowers it */
+                tb->offset_ns += (int64_t)((adv_ns * BME69X_SCHED_DRIFT_PPM) / 1000000u);
+                end_ns = (int64_t)data->timestamp - (int64_t)tb->sensor_ns;
+                if (end_ns < tb->offset_ns)
+                {
+                    tb->offset_ns = end_ns;
+                }
+            }
+
+            tb->last_index = data->meas_index;
+            entry->mid_ns[i] = (uint64_t)(tb->offset_ns + (int64_t)tb->sensor_ns) - (dur_ns / 2);
+        }
+    }
+}
+
+/*!
+ * Swaps two heap slots
+ */
+static void heap_swap(struct bme69x_sched *sched, uint8_t a, uint8_t b)
+{
+    struct bme69x_sched_entry *tmp = sched->heap[a];
+
+    sched->heap[a] = sched->heap[b];
+    sched->heap[b] = tmp;
+}
+
+/*!
+ * Moves the entry at index up until its parent is due earlier
+ */
+static void heap_sift_up(struct bme69x_sched *sched, uint8_t index)
+{
+    uint8_t parent;
+
+    while (index > 0)
+    {
+        parent = (uint8_t)((index - 1) / 2);
+        if (sched->heap[parent]->deadline_us <= sched->heap[index]->deadline_us)
+        {
+            break;
+        }
+
+        heap_swap(sched, parent, index);
+        index = parent;
+    }
+}
+
+/*!
+ * Moves the entry at index down until its children are due later
+ */
+static void heap_sift_down(struct bme69x_sched *sched, uint8_t index)
+{
+    uint8_t child;
+
+    for (;;)
+    {
+        uint8_t min = index;
+
+        child = (uint8_t)((2 * index) + 1);
+        if ((child < sched->n_entries) && (sched->heap[child]->deadline_us < sched->heap[min]->deadline_us))
+        {
+            min = child;
+        }
+
+        child++;
+        if ((child < sched->n_entries) && (sched->heap[child]->deadline_us < sched->heap[min]->deadline_us))
+        {
+            min = child;
+        }
+
+        if (min == index)
+        {
+            break;
+        }
+
+        heap_swap(sched, min, index);
+        index = min;
+    }
+}
+
+/*!
+ * Restores the heap order after the deadlines of all the entries changed
+ */
+static void heap_build(struct bme69x_sched *sched)
+{
+    uint8_t index = (uint8_t)(sched->n_entries / 2);
+
+    while (index > 0)
+    {
+        index--;
+        heap_sift_down(sched, index);
+    }
+}
+
+/*!
+ * Energy of a power over a duration in nanojoules, split so that the product does not overflow
+ */
+static uint64_t energy_nj(uint64_t duration_us, uint32_t power_nw)
+{
+    return ((duration_us / 1000000u) * power_nw) + (((duration_us % 1000000u) * power_nw) / 1000000u);
+}
+
+/*!
+ * Sleeps the host for the remaining time until a deadline, returns the time of wake-up
+ */
+static uint64_t sleep_until(const struct bme69x_sched *sched, uint64_t deadline_us, uint64_t now)
+{
+    const struct bme69x_dev *dev = sched->heap[0]->dev;
+
+    if (deadline_us > now)
+    {
+        dev->delay_us((uint32_t)(deadline_us - now), dev->intf_ptr);
+        now = sched_now_us();
+    }
+
+    return now;
+}
+
+/*!
+ * Triggers a forced mode measurement and computes the deadline of an entry
+ */
+static int8_t arm_entry(struct bme69x_sched_entry *entry, uint64_t now)
+{
+    int8_t rslt = BME69X_OK;
+
+    if (entry->op_mode == BME69X_FORCED_MODE)
+    {
+        rslt = bme69x_set_op_mode(BME69X_FORCED_MODE, entry->dev);
+        entry->trigger_ns = dev_now_ns(entry->dev);
+        now = sched_now_us();
+    }
+
+    entry->deadline_us = now + entry->period_us;
+
+    return rslt;
+}
+
+/*!
+ * Records the result of an access to an entry, a failed device gets the deadline of its backoff
+ */
+static int8_t account_entry(const struct bme69x_sched *sched, struct bme69x_sched_entry *entry, int8_t rslt)
+{
+    if (bme69x_health_update(&entry->health, &sched->health_conf, rslt, entry->dev, sched_now_us()) !=
+        BME69X_HEALTH_OK)
+    {
+        entry->deadline_us = entry->health.retry_us;
+    }
+
+    return rslt;
+}
+
+/*!
+ * Re-probes a quarantined device: initializes it again, restores its configuration and re-arms it
+ */
+static int8_t probe_entry(struct bme69x_sched_entry *entry)
+{
+    uint8_t features = entry->dev->features;
+    int8_t rslt;
+
+    entry->health.n_probes++;
+    entry->timebase.valid = 0;
+
+    /* bme69x_init clears the features selected by the application */
+    rslt = bme69x_init(entry->dev);
+    if (rslt == BME69X_OK)
+    {
+        entry->dev->features = features;
+        rslt = bme69x_set_conf(entry->conf, entry->dev);
+    }
+
+    if ((rslt == BME69X_OK) && (entry->heatr_conf != NULL))
+    {
+        rslt = bme69x_set_heatr_conf(entry->op_mode, entry->heatr_conf, entry->dev);
+    }
+
+    if ((rslt == BME69X_OK) && (entry->op_mode != BME69X_FORCED_MODE))
+    {
+        rslt = bme69x_set_op_mode(entry->op_mode, entry->dev);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        rslt = arm_entry(entry, sched_now_us());
+    }
+
+    return rslt;
+}
+
+/******************************************************************************/
+/*!                User interface functions                                   */
+
+uint32_t bme69x_sched_period(uint8_t op_mode,
+                             struct bme69x_conf *conf,
+                             const struct bme69x_heatr_conf *heatr_conf,
+                             struct bme69x_dev *dev)
+{
+    uint32_t period = bme69x_get_meas_dur(op_mode, conf, dev);
+
+    if ((heatr_conf != NULL) && (heatr_conf->enable == BME69X_ENABLE))
+    {
+        switch (op_mode)
+        {
+            case BME69X_FORCED_MODE:
+                period += (uint32_t)heatr_conf->heatr_dur * 1000;
+                break;
+            case BME69X_PARALLEL_MODE:
+                period += (uint32_t)heatr_conf->shared_heatr_dur * 1000;
+                break;
+            case BME69X_SEQUENTIAL_MODE:
+                if (heatr_conf->heatr_dur_prof != NULL)
+                {
+                    period += (uint32_t)heatr_conf->heatr_dur_prof[0] * 1000;
+                }
+
+                break;
+            default:
+                break;
+        }
+    }
+
+    return period;
+}
+
+int8_t bme69x_sched_cycle(struct bme69x_sched *sched,
+                          uint32_t cycle_us,
+                          bme69x_sched_cb_t cb,
+                          void *arg,
+                          struct bme69x_duty_stats *stats)
+{
+    struct bme69x_sched_entry *entry;
+    uint64_t start, now, wake, ready_us;
+    uint32_t meas_dur;
+    int8_t entry_rslt;
+    int8_t rslt = BME69X_OK;
+    uint8_t i;
+
+    if ((sched == NULL) || (stats == NULL))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    if (sched->n_entries == 0)
+    {
+        return BME69X_W_NO_NEW_DATA;
+    }
+
+    /* Wake window, the idle forced mode devices are triggered back to back */
+    start = sched_now_us();
+    ready_us = start;
+    for (i = 0; i < sched->n_entries; i++)
+    {
+        entry = sched->heap[i];
+        entry_rslt = BME69X_OK;
+        if ((entry->health.state != BME69X_HEALTH_OK) && (entry->health.retry_us > start))
+        {
+            /* Still backing off, the device costs the bus nothing this cycle */
+            continue;
+        }
+
+        if (entry->health.state == BME69X_HEALTH_QUARANTINED)
+        {
+            entry_rslt = account_entry(sched, entry, probe_entry(entry));
+        }
+        else if ((entry->op_mode == BME69X_FORCED_MODE) &&
+                 ((entry->deadline_us <= start) || (entry->health.state == BME69X_HEALTH_BACKOFF)))
+        {
+            entry_rslt = account_entry(sched, entry, arm_entry(entry, 0));
+        }
+
+        if ((entry_rslt < BME69X_OK) && (rslt == BME69X_OK))
+        {
+            rslt = entry_rslt;
+        }
+
+        if ((entry->op_mode == BME69X_FORCED_MODE) && (entry->health.state == BME69X_HEALTH_OK) &&
+            (entry->deadline_us > ready_us))
+        {
+            ready_us = entry->deadline_us;
+        }
+    }
+
+    now = sched_now_us();
+    stats->awake_us += now - start;
+
+    /* The host sleeps through the longest measurement */
+    wake = sleep_until(sched, ready_us, now);
+    stats->sleep_us += wake - now;
+
+    /* The data of all the devices is read back to back while the bus is up */
+    for (i = 0; i < sched->n_entries; i++)
+    {
+        entry = sched->heap[i];
+        entry->n_data = 0;
+
+        /* A continuous mode device in backoff is retried with the read itself */
+        if ((entry->health.state == BME69X_HEALTH_OK) ||
+            ((entry->health.state == BME69X_HEALTH_BACKOFF) && (entry->op_mode != BME69X_FORCED_MODE) &&
+             (entry->health.retry_us <= wake)))
+        {
+            entry->rslt = bme69x_get_data(entry->op_mode, entry->data, &entry->n_data, entry->dev);
+            estimate_mid(entry, dev_now_ns(entry->dev));
+            entry->rslt = account_entry(sched, entry, entry->rslt);
+            if ((entry->rslt < BME69X_OK) && (rslt == BME69X_OK))
+            {
+                rslt = entry->rslt;
+            }
+        }
+        else
+        {
+            entry->rslt = entry->health.last_rslt;
+        }
+
+        if ((entry->op_mode == BME69X_FORCED_MODE) && (entry->n_data > 0))
+        {
+            meas_dur = bme69x_get_meas_dur(BME69X_FORCED_MODE, entry->conf, entry->dev);
+            stats->meas_us += meas_dur;
+            stats->heat_us += entry->period_us - meas_dur;
+        }
+
+        stats->n_samples += entry->n_data;
+
+        if (cb != NULL)
+        {
+            cb(entry, arg);
+        }
+    }
+
+    heap_build(sched);
+
+    now = sched_now_us();
+    stats->awake_us += now - wake;
+
+    /* The rest of the cycle is slept, a cycle running late starts the next one right away */
+    wake = sleep_until(sched, start + cycle_us, now);
+    stats->sleep_us += wake - now;
+
+    stats->n_cycles++;
+    stats->sensor_us += (wake - start) * sched->n_entries;
+
+    return rslt;
+}
+
+void bme69x_duty_estimate(const struct bme69x_duty_stats *stats,
+                          const struct bme69x_duty_model *model,
+                          struct bme69x_duty_estimate *est)
+{
+    uint64_t total_us;
+    uint64_t sensor_sleep_us = 0;
+
+    if ((stats == NULL) || (model == NULL) || (est == NULL))
+    {
+        return;
+    }
+
+    total_us = stats->awake_us + stats->sleep_us;
+    if ((stats->meas_us + stats->heat_us) < stats->sensor_us)
+    {
+        sensor_sleep_us = stats->sensor_us - stats->meas_us - stats->heat_us;
+    }
+
+    est->host_nj = energy_nj(stats->awake_us, model->host_awake_nw) + energy_nj(stats->sleep_us, model->host_sleep_nw);
+    est->sensor_nj = energy_nj(stats->meas_us, model->sensor_meas_nw) +
+                     energy_nj(stats->heat_us, model->sensor_heat_nw) +
+                     energy_nj(sensor_sleep_us, model->sensor_sleep_nw);
+    est->duty_ppm = (total_us > 0) ? (uint32_t)((stats->awake_us * 1000000u) / total_us) : 0;
+    est->nj_per_sample = (stats->n_samples > 0) ? ((est->host_nj + est->sensor_nj) / stats->n_samples) : 0;
+    est->avg_nw = (total_us > 0) ? (((est->host_nj + est->sensor_nj) * 1000000u) / total_us) : 0;
+}
+
+uint8_t bme69x_health_update(struct bme69x_health *health,
+                             const struct bme69x_health_conf *conf,
+                             int8_t rslt,
+                             const struct bme69x_dev *dev,
+                             uint64_t now_us)
+{
+    bool fault;
+
+    if ((health == NULL) || (conf == NULL) || (dev == NULL))
+    {
+        return BME69X_HEALTH_OK;
+    }
+
+    fault = (rslt == BME69X_E_COM_FAIL) || (rslt == BME69X_E_DEV_NOT_FOUND) ||
+            ((rslt < BME69X_OK) && (dev->intf_rslt != BME69X_INTF_RET_SUCCESS));
+
+    health->n_access++;
+    health->err_permille = (uint16_t)(((uint32_t)health->err_permille * 7) / 8);
+
+    if (fault)
+    {
+        health->err_permille += 125;
+        health->n_faults++;
+        if (health->n_fail_run < UINT8_MAX)
+        {
+            health->n_fail_run++;
+        }
+
+        health->last_rslt = rslt;
+        health->last_intf_rslt = dev->intf_rslt;
+
+        if (health->backoff_us == 0)
+        {
+            health->backoff_us = conf->backoff_min_us;
+        }
+        else if (health->backoff_us < (conf->backoff_max_us / 2))
+        {
+            health->backoff_us *= 2;
+        }
+        else
+        {
+            health->backoff_us = conf->backoff_max_us;
+        }
+
+        health->retry_us = now_us + health->backoff_us;
+
+        if ((health->state != BME69X_HEALTH_QUARANTINED) && (health->n_fail_run >= conf->quarantine_after))
+        {
+            health->state = BME69X_HEALTH_QUARANTINED;
+            health->n_quarantines++;
+        }
+        else if (health->state == BME69X_HEALTH_OK)
+        {
+            health->state = BME69X_HEALTH_BACKOFF;
+        }
+    }
+    else
+    {
+        if (health->state != BME69X_HEALTH_OK)
+        {
+            health->state = BME69X_HEALTH_OK;
+            health->n_recoveries++;
+        }
+
+        health->n_fail_run = 0;
+        health->backoff_us = 0;
+    }
+
+    return health->state;
+}
+
+void bme69x_sched_init(struct bme69x_sched *sched)
+{
+    if (sched != NULL)
+    {
+        sched->n_entries = 0;
+        sched->health_conf.backoff_min_us = BME69X_HEALTH_BACKOFF_MIN_US;
+        sched->health_conf.backoff_max_us = BME69X_HEALTH_BACKOFF_MAX_US;
+        sched->health_conf.quarantine_after = BME69X_HEALTH_QUARANTINE_AFTER;
+    }
+}
+
+int8_t bme69x_sched_add(struct bme69x_sched *sched,
+                        struct bme69x_sched_entry *entry,
+                        struct bme69x_dev *dev,
+                        uint8_t op_mode,
+                        struct bme69x_conf *conf,
+                        const struct bme69x_heatr_conf *heatr_conf)
+{
+    int8_t rslt;
+
+    if ((sched == NULL) || (entry == NULL) || (dev == NULL) || (conf == NULL))
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    if (sched->n_entries >= BME69X_SCHED_MAX_ENTRIES)
+    {
+        return BME69X_E_INVALID_LENGTH;
+    }
+
+    entry->dev = dev;
+    entry->op_mode = op_mode;
+    entry->conf = conf;
+    entry->heatr_conf = heatr_conf;
+    entry->period_us = bme69x_sched_period(op_mode, conf, heatr_conf, dev);
+    entry->n_data = 0;
+    entry->rslt = BME69X_OK;
+    memset(&entry->health, 0, sizeof(entry->health));
+    memset(&entry->timebase, 0, sizeof(entry->timebase));
+
+    rslt = arm_entry(entry, sched_now_us());
+    if (rslt == BME69X_OK)
+    {
+        sched->heap[sched->n_entries] = entry;
+        heap_sift_up(sched, sched->n_entries);
+        sched->n_entries++;
+    }
+
+    return rslt;
+}
+
+int8_t bme69x_sched_step(struct bme69x_sched *sched, bme69x_sched_cb_t cb, void *arg)
+{
+    struct bme69x_sched_entry *entry;
+    uint64_t now;
+    int8_t arm_rslt;
+    int8_t rslt;
+
+    if (sched == NULL)
+    {
+        return BME69X_E_NULL_PTR;
+    }
+
+    if (sched->n_entries == 0)
+    {
+        return BME69X_W_NO_NEW_DATA;
+    }
+
+    /* Sleep only until the earliest device is ready */
+    entry = sched->heap[0];
+    now = sched_now_us();
+    if (entry->deadline_us > now)
+    {
+        entry->dev->delay_us((uint32_t)(entry->deadline_us - now), entry->dev->intf_ptr);
+    }
+
+    entry->n_data = 0;
+    if (entry->health.state == BME69X_HEALTH_QUARANTINED)
+    {
+        rslt = account_entry(sched, entry, probe_entry(entry));
+        entry->rslt = rslt;
+    }
+    else if ((entry->health.state == BME69X_HEALTH_BACKOFF) && (entry->op_mode == BME69X_FORCED_MODE))
+    {
+        /* The trigger or the read failed, the measurement is started again */
+        rslt = account_entry(sched, entry, arm_entry(entry, 0));
+        entry->rslt = rslt;
+    }
+    else
+    {
+        rslt = bme69x_get_data(entry->op_mode, entry->data, &entry->n_data, entry->dev);
+        estimate_mid(entry, dev_now_ns(entry->dev));
+        rslt = account_entry(sched, entry, rslt);
+        entry->rslt = rslt;
+
+        if (cb != NULL)
+        {
+            cb(entry, arg);
+        }
+
+        /* Re-arm from the read time, continuous modes keep their own pace. A failed read keeps its backoff. */
+        if ((entry->health.state == BME69X_HEALTH_OK) && (entry->op_mode == BME69X_FORCED_MODE))
+        {
+            arm_rslt = account_entry(sched, entry, arm_entry(entry, 0));
+            if (arm_rslt < BME69X_OK)
+            {
+                rslt = arm_rslt;
+            }
+        }
+        else if (entry->health.state == BME69X_HEALTH_OK)
+        {
+            entry->deadline_us += entry->period_us;
+            now = sched_now_us();
+            if (entry->deadline_us < now)
+            {
+                entry->deadline_us = now;
+            }
+        }
+    }
+
+    heap_sift_down(sched, 0);
+
+    return rslt;
+}
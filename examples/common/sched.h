@@ -0,0 +1,402 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef SCHED_H_
+#define SCHED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include "bme69x.h"
+
+/*! Maximum number of devices handled by one scheduler */
+#define BME69X_SCHED_MAX_ENTRIES  UINT8_C(32)
+
+/*! Typical power of a sensor measuring temperature, pressure and humidity, in nanowatts (0.7 mA at 1.8 V) */
+#define BME69X_DUTY_SENSOR_MEAS_NW   UINT32_C(1260000)
+
+/*! Typical power of a sensor heating its hot plate, in nanowatts (12 mA at 1.8 V) */
+#define BME69X_DUTY_SENSOR_HEAT_NW   UINT32_C(21600000)
+
+/*! Typical power of a sensor in sleep mode, in nanowatts (0.15 uA at 1.8 V) */
+#define BME69X_DUTY_SENSOR_SLEEP_NW  UINT32_C(270)
+
+/*! Health state of a device answering on its bus */
+#define BME69X_HEALTH_OK             UINT8_C(0)
+
+/*! Health state of a device whose last access failed, it is retried once its backoff expires */
+#define BME69X_HEALTH_BACKOFF        UINT8_C(1)
+
+/*! Health state of a device failing repeatedly, it is re-probed with bme69x_init once its backoff expires */
+#define BME69X_HEALTH_QUARANTINED    UINT8_C(2)
+
+/*! Default backoff after the first failure, in microseconds */
+#define BME69X_HEALTH_BACKOFF_MIN_US UINT32_C(50000)
+
+/*! Default longest backoff, in microseconds */
+#define BME69X_HEALTH_BACKOFF_MAX_US UINT32_C(30000000)
+
+/*! Default number of consecutive failures putting a device in quarantine */
+#define BME69X_HEALTH_QUARANTINE_AFTER UINT8_C(4)
+
+/*! Tolerance of the sensor timing against its nominal value, in parts per million */
+#define BME69X_SCHED_DRIFT_PPM       UINT32_C(20000)
+
+/*!
+ * @brief Backoff policy of a scheduler, set to the defaults by bme69x_sched_init
+ */
+struct bme69x_health_conf
+{
+    /*! Backoff after the first failure, doubled on every following one, in microseconds */
+    uint32_t backoff_min_us;
+
+    /*! Longest backoff, in microseconds */
+    uint32_t backoff_max_us;
+
+    /*! Number of consecutive failures putting a device in quarantine */
+    uint8_t quarantine_after;
+};
+
+/*!
+ * @brief Health of a device, fed with the result of every access to it. Only the
+ * communication failures count, see bme69x_health_update.
+ */
+struct bme69x_health
+{
+    /*! BME69X_HEALTH_OK, BME69X_HEALTH_BACKOFF or BME69X_HEALTH_QUARANTINED */
+    uint8_t state;
+
+    /*! Number of consecutive failures */
+    uint8_t n_fail_run;
+
+    /*! Moving average of the failure rate, in per mille, every access weighs 1/8 */
+    uint16_t err_permille;
+
+    /*! Current backoff, 0 while the device is healthy, in microseconds */
+    uint32_t backoff_us;
+
+    /*! Monotonic time before which the device is not accessed again, in microseconds */
+    uint64_t retry_us;
+
+    /*! Number of accesses */
+    uint32_t n_access;
+
+    /*! Number of failed accesses */
+    uint32_t n_faults;
+
+    /*! Number of times the device was put in quarantine */
+    uint32_t n_quarantines;
+
+    /*! Number of re-probes of the quarantined device */
+    uint32_t n_probes;
+
+    /*! Number of returns to BME69X_HEALTH_OK */
+    uint32_t n_recoveries;
+
+    /*! API result of the last failure */
+    int8_t last_rslt;
+
+    /*! Interface result of the last failure, bme69x_dev.intf_rslt */
+    BME69X_INTF_RET_TYPE last_intf_rslt;
+};
+
+/*!
+ * @brief Correlation of the measurement index of a parallel or sequential mode device with the host clock.
+ * The end of every measurement is laid on the nominal timing of the steps counted by the measurement
+ * index. As a field is only read after its measurement ended, the earliest read time seen pins it.
+ */
+struct bme69x_timebase
+{
+    /*! Host time of the end of the measurement at nominal sensor time 0, in nanoseconds */
+    int64_t offset_ns;
+
+    /*! Nominal sensor time at the end of the last measurement, in nanoseconds */
+    uint64_t sensor_ns;
+
+    /*! Measurement index of the last measurement */
+    uint8_t last_index;
+
+    /*! Set once a measurement was seen, cleared when the device is initialized again */
+    uint8_t valid;
+};
+
+/*!
+ * @brief Scheduled device. The scheduler keeps a pointer to it, so it has to
+ * stay valid while it is registered. The scheduling times, deadline_us, period_us and the
+ * health times, are in microseconds of the host CLOCK_MONOTONIC. The measurement times,
+ * trigger_ns, mid_ns and timebase, are in nanoseconds of bme69x_dev.get_time_ns when
+ * BME69X_FEAT_TIMESTAMP is selected, or of CLOCK_MONOTONIC otherwise.
+ */
+struct bme69x_sched_entry
+{
+    /*! Device structure */
+    struct bme69x_dev *dev;
+
+    /*! Operation mode the device runs in */
+    uint8_t op_mode;
+
+    /*! Sensor configuration, used to compute the measurement duration */
+    struct bme69x_conf *conf;
+
+    /*! Heater configuration, used to compute the heating duration */
+    const struct bme69x_heatr_conf *heatr_conf;
+
+    /*! Time from the trigger until the data is ready, in microseconds */
+    uint32_t period_us;
+
+    /*! Monotonic time at which the data is expected to be ready, in microseconds */
+    uint64_t deadline_us;
+
+    /*! Data read at the last deadline */
+    struct bme69x_data data[3];
+
+    /*! Number of new fields in data */
+    uint8_t n_data;
+
+    /*! Estimated midpoint of the measurement of every new field of data, from its start to the end of
+     * its gas conversion, in nanoseconds. The read completion is in bme69x_data.timestamp. */
+    uint64_t mid_ns[3];
+
+    /*! Time at which the last forced mode measurement was triggered, in nanoseconds */
+    uint64_t trigger_ns;
+
+    /*! Measurement timing of a parallel or sequential mode device */
+    struct bme69x_timebase timebase;
+
+    /*! Result of the last access to the device */
+    int8_t rslt;
+
+    /*! Health of the device, a failing device is backed off without delaying the others */
+    struct bme69x_health health;
+
+    /*! User data */
+    void *user;
+};
+
+/*!
+ * @brief Callback called for every device whose data has been read
+ *
+ * @param[in,out] entry : Entry holding the data that has been read
+ * @param[in,out] arg   : User argument given to bme69x_sched_step
+ */
+typedef void (*bme69x_sched_cb_t)(struct bme69x_sched_entry *entry, void *arg);
+
+/*!
+ * @brief Scheduler keeping a min-heap of the readiness deadlines of its devices
+ */
+struct bme69x_sched
+{
+    /*! Heap of the registered entries, ordered by deadline */
+    struct bme69x_sched_entry *heap[BME69X_SCHED_MAX_ENTRIES];
+
+    /*! Number of registered entries */
+    uint8_t n_entries;
+
+    /*! Backoff policy of the registered devices */
+    struct bme69x_health_conf health_conf;
+};
+
+/*!
+ * @brief Time accounting of the duty cycles run by bme69x_sched_cycle, zero-initialized by the caller
+ */
+struct bme69x_duty_stats
+{
+    /*! Number of cycles run */
+    uint32_t n_cycles;
+
+    /*! Number of fields read */
+    uint32_t n_samples;
+
+    /*! Time the host was awake triggering and reading the sensors, in microseconds */
+    uint64_t awake_us;
+
+    /*! Time the host slept, in microseconds */
+    uint64_t sleep_us;
+
+    /*! Measurement time of the forced mode sensors without heating, summed over the sensors, in microseconds */
+    uint64_t meas_us;
+
+    /*! Heating time of the forced mode sensors, summed over the sensors, in microseconds */
+    uint64_t heat_us;
+
+    /*! Time covered by the cycles, summed over the sensors, in microseconds */
+    uint64_t sensor_us;
+};
+
+/*!
+ * @brief Power figures the energy estimates are based on, in nanowatts. The host
+ * figures belong to the target board, see BME69X_DUTY_SENSOR_MEAS_NW and the
+ * following ones for the sensor.
+ */
+struct bme69x_duty_model
+{
+    /*! Power of the host while awake */
+    uint32_t host_awake_nw;
+
+    /*! Power of the host while asleep */
+    uint32_t host_sleep_nw;
+
+    /*! Power of a sensor measuring temperature, pressure, humidity and gas */
+    uint32_t sensor_meas_nw;
+
+    /*! Power of a sensor heating its hot plate */
+    uint32_t sensor_heat_nw;
+
+    /*! Power of a sensor in sleep mode */
+    uint32_t sensor_sleep_nw;
+};
+
+/*!
+ * @brief Duty-cycle and energy estimates of bme69x_duty_estimate
+ */
+struct bme69x_duty_estimate
+{
+    /*! Share of the time the host was awake, in parts per million */
+    uint32_t duty_ppm;
+
+    /*! Energy of the host, in nanojoules */
+    uint64_t host_nj;
+
+    /*! Energy of the sensors, in nanojoules */
+    uint64_t sensor_nj;
+
+    /*! Energy per sample read, in nanojoules, 0 without sample */
+    uint64_t nj_per_sample;
+
+    /*! Average power of the host and the sensors, in nanowatts */
+    uint64_t avg_nw;
+};
+
+/*!
+ *  @brief Initializes an empty scheduler, with the default backoff policy
+ *
+ *  @param[out] sched   : Scheduler
+ *
+ *  @return void.
+ */
+void bme69x_sched_init(struct bme69x_sched *sched);
+
+/*!
+ *  @brief Registers a configured device. Forced mode devices are triggered right away,
+ *  parallel and sequential mode devices are expected to be already running.
+ *
+ *  @param[in,out] sched        : Scheduler
+ *  @param[in,out] entry        : Entry to register
+ *  @param[in] dev              : Device structure
+ *  @param[in] op_mode          : Operation mode of the device
+ *  @param[in] conf             : Sensor configuration of the device
+ *  @param[in] heatr_conf       : Heater configuration of the device
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_sched_add(struct bme69x_sched *sched,
+                        struct bme69x_sched_entry *entry,
+                        struct bme69x_dev *dev,
+                        uint8_t op_mode,
+                        struct bme69x_conf *conf,
+                        const struct bme69x_heatr_conf *heatr_conf);
+
+/*!
+ *  @brief Waits for the earliest deadline, reads the data of that device and
+ *  re-arms it. Forced mode devices are triggered again right after the read.
+ *  A failed device gets the deadline of its backoff instead: at that deadline it
+ *  is triggered or read again, or re-probed and reconfigured once quarantined.
+ *  The callback is only called for the reads.
+ *
+ *  @param[in,out] sched    : Scheduler
+ *  @param[in] cb           : Callback called with the data, can be NULL
+ *  @param[in] arg          : User argument passed to the callback
+ *
+ *  @return Result of bme69x_get_data for the serviced device
+ *  @retval 0 -> Success
+ *  @retval > 0 -> Warning
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bme69x_sched_step(struct bme69x_sched *sched, bme69x_sched_cb_t cb, void *arg);
+
+/*!
+ *  @brief Runs one duty cycle of the scheduler. The idle forced mode devices are all
+ *  triggered in one wake window, the host sleeps until the last one is ready, then the
+ *  data of every device is read back to back and the host sleeps for the rest of the
+ *  cycle. A measurement still running, e.g. started by bme69x_sched_add, is waited for
+ *  rather than triggered again. Parallel and sequential mode devices are only read.
+ *  Devices in backoff are skipped until it expires, the callback gets them with no data
+ *  and the result of their last failure. Quarantined devices are re-probed in the wake window.
+ *
+ *  @param[in,out] sched    : Scheduler
+ *  @param[in] cycle_us     : Period of the cycles in microseconds, from wake window to wake window
+ *  @param[in] cb           : Callback called with the data of every device, can be NULL
+ *  @param[in] arg          : User argument passed to the callback
+ *  @param[in,out] stats    : Time accounting, accumulated over the cycles
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval > 0 -> Warning, BME69X_W_NO_NEW_DATA if no device is registered
+ *  @retval < 0 -> Failure, result of the first failed trigger, read or probe of the cycle
+ */
+int8_t bme69x_sched_cycle(struct bme69x_sched *sched,
+                          uint32_t cycle_us,
+                          bme69x_sched_cb_t cb,
+                          void *arg,
+                          struct bme69x_duty_stats *stats);
+
+/*!
+ *  @brief Estimates the duty cycle and the energy of the cycles accounted in stats
+ *
+ *  @param[in] stats        : Time accounting of bme69x_sched_cycle
+ *  @param[in] model        : Power figures of the host and the sensors
+ *  @param[out] est         : Estimates
+ *
+ *  @return void.
+ */
+void bme69x_duty_estimate(const struct bme69x_duty_stats *stats,
+                          const struct bme69x_duty_model *model,
+                          struct bme69x_duty_estimate *est);
+
+/*!
+ *  @brief Records the result of an access to a device. Communication failures, i.e.
+ *  BME69X_E_COM_FAIL, BME69X_E_DEV_NOT_FOUND or any failure with a non-zero
+ *  bme69x_dev.intf_rslt, put the device in backoff, doubling it on every consecutive
+ *  one, and in quarantine after health_conf.quarantine_after of them. Any other result
+ *  means that the device answered and brings it back to BME69X_HEALTH_OK.
+ *
+ *  @param[in,out] health   : Health of the device
+ *  @param[in] conf         : Backoff policy
+ *  @param[in] rslt         : Result of the access
+ *  @param[in] dev          : Device structure accessed
+ *  @param[in] now_us       : Monotonic time of the access, in microseconds
+ *
+ *  @return Health state after the access
+ */
+uint8_t bme69x_health_update(struct bme69x_health *health,
+                             const struct bme69x_health_conf *conf,
+                             int8_t rslt,
+                             const struct bme69x_dev *dev,
+                             uint64_t now_us);
+
+/*!
+ *  @brief Computes the time from the trigger until the data of a device is ready
+ *
+ *  @param[in] op_mode      : Operation mode of the device
+ *  @param[in] conf         : Sensor configuration
+ *  @param[in] heatr_conf   : Heater configuration
+ *  @param[in] dev          : Device structure
+ *
+ *  @return Duration in microseconds
+ */
+uint32_t bme69x_sched_period(uint8_t op_mode,
+                             struct bme69x_conf *conf,
+                             const struct bme69x_heatr_conf *heatr_conf,
+                             struct bme69x_dev *dev);
+
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* SCHED_H_ */
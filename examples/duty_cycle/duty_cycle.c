@@ -0,0 +1,233 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+
+#include "bme69x.h"
+#include "common.h"
+#include "sched.h"
+
+/***********************************************************************/
+/*                         Macros                                      */
+/***********************************************************************/
+
+/* Number of duty cycles to run */
+#define N_CYCLES       UINT16_C(20)
+
+/* Period of the cycles in microseconds */
+#define CYCLE_US       UINT32_C(3000000)
+
+/* Number of buses in the sensor map */
+#define N_BUSES        UINT8_C(2)
+
+/* Power of the host while awake and asleep in nanowatts, figures of the target board go here */
+#define HOST_AWAKE_NW  UINT32_C(15000000)
+#define HOST_SLEEP_NW  UINT32_C(10000)
+
+/***********************************************************************/
+/*                         Sensor map                                  */
+/***********************************************************************/
+
+struct sensor_map
+{
+    /* Index of the bus in the buses array */
+    uint8_t bus;
+
+    /* I2C address or SPI chip select */
+    uint8_t addr;
+};
+
+struct sensor
+{
+    struct bme69x_dev bme;
+    struct bme69x_sensor_ctx ctx;
+    struct bme69x_conf conf;
+    struct bme69x_heatr_conf heatr_conf;
+    struct bme69x_sched_entry entry;
+    uint16_t sample_count;
+};
+
+/* Bus 0 : I2C-1, bus 1 : SPI main */
+static const uint8_t bus_intf[N_BUSES] = { BME69X_I2C_INTF, BME69X_SPI_INTF };
+static const uint8_t bus_id[N_BUSES] = { 1, 0 };
+
+static const struct sensor_map sensor_map[] = {
+    { 0, BME69X_I2C_ADDR_HIGH }, { 0, BME69X_I2C_ADDR_LOW }, { 1, 0 }, { 1, 1 }
+};
+
+#define N_SENSORS      (sizeof(sensor_map) / sizeof(sensor_map[0]))
+
+static struct bme69x_bus buses[N_BUSES];
+static struct bme69x_sched sched;
+static struct sensor sensors[N_SENSORS];
+
+/***********************************************************************/
+/*                         Cycle callback                              */
+/***********************************************************************/
+
+/* Prints the data of a sensor read in the wake window */
+static void print_data(struct bme69x_sched_entry *entry, void *arg)
+{
+    struct sensor *s = (struct sensor *)entry->user;
+    const struct bme69x_data *data = &entry->data[0];
+
+    (void)arg;
+
+    if (entry->n_data == 0)
+    {
+        return;
+    }
+
+#ifdef BME69X_USE_FPU
+    printf("%u, %u, %lu, %lu, %.2f, %.2f, %.2f, %.2f, 0x%x\n",
+           (unsigned)(s - sensors),
+           s->sample_count,
+           (long unsigned int)(data->timestamp / 1000000),
+           (long unsigned int)(entry->mid_ns[0] / 1000000),
+           data->temperature,
+           data->pressure,
+           data->humidity,
+           data->gas_resistance,
+           data->status);
+#else
+    printf("%u, %u, %lu, %lu, %d, %lu, %lu, %lu, 0x%x\n",
+           (unsigned)(s - sensors),
+           s->sample_count,
+           (long unsigned int)(data->timestamp / 1000000),
+           (long unsigned int)(entry->mid_ns[0] / 1000000),
+           data->temperature,
+           (long unsigned int)data->pressure,
+           (long unsigned int)data->humidity,
+           (long unsigned int)data->gas_resistance,
+           data->status);
+#endif
+    s->sample_count++;
+}
+
+/* Brings up a sensor in forced mode once it is attached to its bus */
+static int8_t setup_sensor(struct sensor *s)
+{
+    int8_t rslt;
+
+    rslt = bme69x_init(&s->bme);
+    bme69x_check_rslt("bme69x_init", rslt);
+
+    if (rslt == BME69X_OK)
+    {
+        /* Timestamp the data with bme69x_dev.get_time_ns, the features are cleared by bme69x_init */
+        s->bme.features |= BME69X_FEAT_TIMESTAMP;
+
+        s->conf.filter = BME69X_FILTER_OFF;
+        s->conf.odr = BME69X_ODR_NONE;
+        s->conf.os_hum = BME69X_OS_1X;
+        s->conf.os_pres = BME69X_OS_1X;
+        s->conf.os_temp = BME69X_OS_1X;
+        rslt = bme69x_set_conf(&s->conf, &s->bme);
+        bme69x_check_rslt("bme69x_set_conf", rslt);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        s->heatr_conf.enable = BME69X_ENABLE;
+        s->heatr_conf.heatr_temp = 300;
+        s->heatr_conf.heatr_dur = 100;
+        rslt = bme69x_set_heatr_conf(BME69X_FORCED_MODE, &s->heatr_conf, &s->bme);
+        bme69x_check_rslt("bme69x_set_heatr_conf", rslt);
+    }
+
+    return rslt;
+}
+
+/***********************************************************************/
+/*                         Test code                                   */
+/***********************************************************************/
+
+int main(void)
+{
+    struct bme69x_duty_stats stats = { 0 };
+    struct bme69x_duty_estimate est;
+    struct bme69x_duty_model model;
+    int8_t rslt;
+    uint16_t n;
+    uint8_t i;
+
+    bme69x_sched_init(&sched);
+
+    for (i = 0; i < N_BUSES; i++)
+    {
+        rslt = bme69x_bus_open(&buses[i], bus_intf[i], bus_id[i]);
+        bme69x_check_rslt("bme69x_bus_open", rslt);
+    }
+
+    /* The sensors of all the buses share one scheduler, hence one wake window */
+    for (i = 0; i < N_SENSORS; i++)
+    {
+        struct sensor *s = &sensors[i];
+
+        s->sample_count = 1;
+        rslt = bme69x_sensor_attach(&s->ctx, &buses[sensor_map[i].bus], sensor_map[i].addr, &s->bme);
+        bme69x_check_rslt("bme69x_sensor_attach", rslt);
+
+        if (rslt == BME69X_OK)
+        {
+            rslt = setup_sensor(s);
+        }
+
+        if (rslt == BME69X_OK)
+        {
+            s->entry.user = s;
+            rslt = bme69x_sched_add(&sched, &s->entry, &s->bme, BME69X_FORCED_MODE, &s->conf, &s->heatr_conf);
+            bme69x_check_rslt("bme69x_sched_add", rslt);
+        }
+
+        if (rslt != BME69X_OK)
+        {
+            bme69x_sensor_detach(&s->ctx);
+        }
+    }
+
+    printf("Sensor, Sample, TimeStamp(ms), Midpoint(ms), Temperature(deg C), Pressure(Pa), Humidity(%%), Gas resistance(ohm), Status\n");
+
+    for (n = 0; n < N_CYCLES; n++)
+    {
+        rslt = bme69x_sched_cycle(&sched, CYCLE_US, print_data, NULL, &stats);
+        if (rslt != BME69X_OK)
+        {
+            bme69x_check_rslt("bme69x_sched_cycle", rslt);
+            if (rslt > BME69X_OK)
+            {
+                break;
+            }
+        }
+    }
+
+    model.host_awake_nw = HOST_AWAKE_NW;
+    model.host_sleep_nw = HOST_SLEEP_NW;
+    model.sensor_meas_nw = BME69X_DUTY_SENSOR_MEAS_NW;
+    model.sensor_heat_nw = BME69X_DUTY_SENSOR_HEAT_NW;
+    model.sensor_sleep_nw = BME69X_DUTY_SENSOR_SLEEP_NW;
+    bme69x_duty_estimate(&stats, &model, &est);
+
+    printf("Cycles %lu, samples %lu, host awake %lu us, asleep %lu us, duty cycle %.4f %%\n",
+           (long unsigned int)stats.n_cycles,
+           (long unsigned int)stats.n_samples,
+           (long unsigned int)stats.awake_us,
+           (long unsigned int)stats.sleep_us,
+           (double)est.duty_ppm / 10000.0);
+    printf("Energy host %.3f mJ, sensors %.3f mJ, %.3f mJ per sample, average power %.3f mW\n",
+           (double)est.host_nj / 1e6,
+           (double)est.sensor_nj / 1e6,
+           (double)est.nj_per_sample / 1e6,
+           (double)est.avg_nw / 1e6);
+
+    for (i = 0; i < N_BUSES; i++)
+    {
+        bme69x_bus_close(&buses[i]);
+    }
+
+    return 0;
+}
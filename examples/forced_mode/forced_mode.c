@@ -1,106 +1,114 @@
-/**
- * Copyright (C) 2025 Bosch Sensortec GmbH
- *
- * SPDX-License-Identifier: BSD-3-Clause
- *
- */
-
-#include <stdio.h>
-
-#include "bme69x.h"
-#include "common.h"
-
-/***********************************************************************/
-/*                         Macros                                      */
-/***********************************************************************/
-
-/* Macro for count of samples to be displayed */
-#define SAMPLE_COUNT  UINT16_C(300)
-
-/***********************************************************************/
-/*                         Test code                                   */
-/***********************************************************************/
-
-int main(void)
-{
-    struct bme69x_dev bme;
-    int8_t rslt;
-    struct bme69x_conf conf;
-    struct bme69x_heatr_conf heatr_conf;
-    struct bme69x_data data;
-    uint32_t del_period;
-    uint32_t time_ms = 0;
-    uint8_t n_fields;
-    uint16_t sample_count = 1;
-
-    /* Interface preference is updated as a parameter
-     * For I2C : BME69X_I2C_INTF
-     * For SPI : BME69X_SPI_INTF
-     */
-    rslt = bme69x_interface_init(&bme, BME69X_I2C_INTF);
-    bme69x_check_rslt("bme69x_interface_init", rslt);
-
-    rslt = bme69x_init(&bme);
-    bme69x_check_rslt("bme69x_init", rslt);
-
-    /* Check if rslt == BME69X_OK, report or handle if otherwise */
-    conf.filter = BME69X_FILTER_OFF;
-    conf.odr = BME69X_ODR_NONE;
-    conf.os_hum = BME69X_OS_16X;
-    conf.os_pres = BME69X_OS_16X;
-    conf.os_temp = BME69X_OS_16X;
-    rslt = bme69x_set_conf(&conf, &bme);
-    bme69x_check_rslt("bme69x_set_conf", rslt);
-
-    /* Check if rslt == BME69X_OK, report or handle if otherwise */
-    heatr_conf.enable = BME69X_ENABLE;
-    heatr_conf.heatr_temp = 300;
-    heatr_conf.heatr_dur = 100;
-    rslt = bme69x_set_heatr_conf(BME69X_FORCED_MODE, &heatr_conf, &bme);
-    bme69x_check_rslt("bme69x_set_heatr_conf", rslt);
-
-    printf("Sample, TimeStamp(ms), Temperature(deg C), Pressure(Pa), Humidity(%%), Gas resistance(ohm), Status\n");
-
-    while (sample_count <= SAMPLE_COUNT)  
-    {
-        rslt = bme69x_set_op_mode(BME69X_FORCED_MODE, &bme);
-        bme69x_check_rslt("bme69x_set_op_mode", rslt);
-
-        del_period = bme69x_get_meas_dur(BME69X_FORCED_MODE, &conf, &bme) + (heatr_conf.heatr_dur * 1000);
-        bme.delay_us(del_period, bme.intf_ptr);
-
-        time_ms = bme69x_get_millis();
-
-        /* Check if rslt == BME69X_OK, report or handle if otherwise */
-        rslt = bme69x_get_data(BME69X_FORCED_MODE, &data, &n_fields, &bme);
-        bme69x_check_rslt("bme69x_get_data", rslt);
-
-        if (n_fields)
-            {
-#ifdef BME69X_USE_FPU
-                printf("%u, %lu, %.2f, %.2f, %.2f, %.2f, 0x%x\n",
-                       sample_count,
-                       (long unsigned int)time_ms,
-                       data.temperature,
-                       data.pressure,
-                       data.humidity,
-                       data.gas_resistance,
-                       data.status);
-#else
-                printf("%u, %lu, %d, %ld, %ld, %ld, 0x%x\n",
-                       sample_count,
-                       (long unsigned int)time_ms,
-                       data.temperature,
-                       data.pressure,
-                       data.humidity,
-                       data.gas_resistance,
-                       data.status);
-#endif
-                sample_count++;
-        }
-    }
-
-    bme69x_pigpio_deinit();
-
-    return rslt;
-}
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+
+#include "bme69x.h"
+#include "common.h"
+
+/***********************************************************************/
+/*                         Macros                                      */
+/***********************************************************************/
+
+/* Macro for count of samples to be displayed */
+#define SAMPLE_COUNT  UINT16_C(300)
+
+/***********************************************************************/
+/*                         Test code                                   */
+/***********************************************************************/
+
+int main(void)
+{
+    struct bme69x_dev bme = { 0 };
+    int8_t rslt;
+    struct bme69x_conf conf;
+    struct bme69x_heatr_conf heatr_conf;
+    struct bme69x_data data;
+    uint8_t n_fields;
+    uint16_t sample_count = 1;
+
+    /* Interface preference is updated as a parameter
+     * For I2C : BME69X_I2C_INTF
+     * For SPI : BME69X_SPI_INTF
+     */
+    rslt = bme69x_interface_init(&bme, BME69X_I2C_INTF);
+    bme69x_check_rslt("bme69x_interface_init", rslt);
+
+    rslt = bme69x_init(&bme);
+    bme69x_check_rslt("bme69x_init", rslt);
+
+    /* Timestamp the data with bme69x_dev.get_time_ns, the features are cleared by bme69x_init */
+    bme.features |= BME69X_FEAT_TIMESTAMP;
+
+    /* Check if rslt == BME69X_OK, report or handle if otherwise */
+    conf.filter = BME69X_FILTER_OFF;
+    conf.odr = BME69X_ODR_NONE;
+    conf.os_hum = BME69X_OS_16X;
+    conf.os_pres = BME69X_OS_16X;
+    conf.os_temp = BME69X_OS_16X;
+    rslt = bme69x_set_conf(&conf, &bme);
+    bme69x_check_rslt("bme69x_set_conf", rslt);
+
+    /* Check if rslt == BME69X_OK, report or handle if otherwise */
+    heatr_conf.enable = BME69X_ENABLE;
+    heatr_conf.heatr_temp = 300;
+    heatr_conf.heatr_dur = 100;
+    rslt = bme69x_set_heatr_conf(BME69X_FORCED_MODE, &heatr_conf, &bme);
+    bme69x_check_rslt("bme69x_set_heatr_conf", rslt);
+
+    printf("Sample, TimeStamp(ms), Temperature(deg C), Pressure(Pa), Humidity(%%), Gas resistance(ohm), Status\n");
+
+    while (sample_count <= SAMPLE_COUNT)  
+    {
+        rslt = bme69x_set_op_mode(BME69X_FORCED_MODE, &bme);
+        bme69x_check_rslt("bme69x_set_op_mode", rslt);
+
+        /* Sleeps for the predicted measurement duration, then polls the status register */
+        rslt = bme69x_wait_data(BME69X_FORCED_MODE, &conf, &heatr_conf, &bme);
+        bme69x_check_rslt("bme69x_wait_data", rslt);
+
+        /* Check if rslt == BME69X_OK, report or handle if otherwise */
+        rslt = bme69x_get_data(BME69X_FORCED_MODE, &data, &n_fields, &bme);
+        bme69x_check_rslt("bme69x_get_data", rslt);
+
+        if (n_fields)
+            {
+#ifdef BME69X_USE_FPU
+                printf("%u, %lu, %.2f, %.2f, %.2f, %.2f, 0x%x\n",
+                       sample_count,
+                       (long unsigned int)(data.timestamp / 1000000),
+                       data.temperature,
+                       data.pressure,
+                       data.humidity,
+                       data.gas_resistance,
+                       data.status);
+#else
+                printf("%u, %lu, %d, %ld, %ld, %ld, 0x%x\n",
+                       sample_count,
+                       (long unsigned int)(data.timestamp / 1000000),
+                       data.temperature,
+                       data.pressure,
+                       data.humidity,
+                       data.gas_resistance,
+                       data.status);
+#endif
+                sample_count++;
+
+                /* Heater target follows the measured temperature, the register is only written when it changes */
+#ifdef BME69X_USE_FPU
+                rslt = bme69x_set_amb_temp((int8_t)data.temperature, BME69X_FORCED_MODE, &heatr_conf, &bme);
+#else
+                rslt = bme69x_set_amb_temp((int8_t)(data.temperature / 100), BME69X_FORCED_MODE, &heatr_conf, &bme);
+#endif
+                bme69x_check_rslt("bme69x_set_amb_temp", rslt);
+        }
+    }
+
+    bme69x_pigpio_deinit();
+
+    return rslt;
+}
@@ -0,0 +1,282 @@
+/**
+ * Copyright (C) 2025 Bosch Sensortec GmbH
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "bme69x.h"
+#include "common.h"
+#include "sched.h"
+
+/***********************************************************************/
+/*                         Macros                                      */
+/***********************************************************************/
+
+/* Macro for count of samples to be displayed per sensor */
+#define SAMPLE_COUNT  UINT16_C(100)
+
+/* Number of buses in the sensor map */
+#define N_BUSES       UINT8_C(2)
+
+/***********************************************************************/
+/*                         Sensor map                                  */
+/***********************************************************************/
+
+struct sensor_map
+{
+    /* Index of the bus in the buses array */
+    uint8_t bus;
+
+    /* I2C address or SPI chip select */
+    uint8_t addr;
+};
+
+struct sensor
+{
+    struct bme69x_dev bme;
+    struct bme69x_sensor_ctx ctx;
+    struct bme69x_conf conf;
+    struct bme69x_heatr_conf heatr_conf;
+    struct bme69x_sched_entry entry;
+    uint16_t sample_count;
+    bool ready;
+};
+
+/* Bus 0 : I2C-1, bus 1 : SPI main */
+static const uint8_t bus_intf[N_BUSES] = { BME69X_I2C_INTF, BME69X_SPI_INTF };
+static const uint8_t bus_id[N_BUSES] = { 1, 0 };
+
+static const struct sensor_map sensor_map[] = {
+    { 0, BME69X_I2C_ADDR_HIGH }, { 0, BME69X_I2C_ADDR_LOW }, { 1, 0 }, { 1, 1 }
+};
+
+#define N_SENSORS     (sizeof(sensor_map) / sizeof(sensor_map[0]))
+
+static struct bme69x_bus buses[N_BUSES];
+static struct bme69x_sched scheds[N_BUSES];
+static struct sensor sensors[N_SENSORS];
+static struct bme69x_selftest tests[N_SENSORS];
+
+/***********************************************************************/
+/*                         Bus poller                                  */
+/***********************************************************************/
+
+/* Prints the data of a sensor once the scheduler has read it */
+static void print_data(struct bme69x_sched_entry *entry, void *arg)
+{
+    struct sensor *s = (struct sensor *)entry->user;
+    const struct bme69x_data *data = &entry->data[0];
+
+    (void)arg;
+
+    if ((entry->n_data == 0) || (s->sample_count > SAMPLE_COUNT))
+    {
+        return;
+    }
+
+#ifdef BME69X_USE_FPU
+    printf("%u, %u, %lu, %lu, %.2f, %.2f, %.2f, %.2f, 0x%x\n",
+           (unsigned)(s - sensors),
+           s->sample_count,
+           (long unsigned int)(data->timestamp / 1000000),
+           (long unsigned int)(entry->mid_ns[0] / 1000000),
+           data->temperature,
+           data->pressure,
+           data->humidity,
+           data->gas_resistance,
+           data->status);
+#else
+    printf("%u, %u, %lu, %lu, %d, %lu, %lu, %lu, 0x%x\n",
+           (unsigned)(s - sensors),
+           s->sample_count,
+           (long unsigned int)(data->timestamp / 1000000),
+           (long unsigned int)(entry->mid_ns[0] / 1000000),
+           data->temperature,
+           (long unsigned int)data->pressure,
+           (long unsigned int)data->humidity,
+           (long unsigned int)data->gas_resistance,
+           data->status);
+#endif
+    s->sample_count++;
+}
+
+/* Services the sensor of the bus whose measurement completes first */
+static void poll_bus(struct bme69x_bus *bus, void *arg)
+{
+    struct bme69x_sched *sched = (struct bme69x_sched *)arg;
+
+    (void)bus;
+
+    if (bme69x_sched_step(sched, print_data, NULL) == BME69X_W_NO_NEW_DATA)
+    {
+        /* Nothing scheduled on this bus */
+        if (sched->n_entries == 0)
+        {
+            usleep(100000);
+        }
+    }
+}
+
+/* Brings up a sensor once it is attached to its bus */
+static int8_t setup_sensor(struct sensor *s)
+{
+    int8_t rslt;
+
+    rslt = bme69x_init(&s->bme);
+    bme69x_check_rslt("bme69x_init", rslt);
+
+    if (rslt == BME69X_OK)
+    {
+        /* Timestamp the data with bme69x_dev.get_time_ns, the features are cleared by bme69x_init */
+        s->bme.features |= BME69X_FEAT_TIMESTAMP;
+
+        s->conf.filter = BME69X_FILTER_OFF;
+        s->conf.odr = BME69X_ODR_NONE;
+        s->conf.os_hum = BME69X_OS_16X;
+        s->conf.os_pres = BME69X_OS_1X;
+        s->conf.os_temp = BME69X_OS_2X;
+        rslt = bme69x_set_conf(&s->conf, &s->bme);
+        bme69x_check_rslt("bme69x_set_conf", rslt);
+    }
+
+    if (rslt == BME69X_OK)
+    {
+        s->heatr_conf.enable = BME69X_ENABLE;
+        s->heatr_conf.heatr_temp = 300;
+        s->heatr_conf.heatr_dur = 100;
+        rslt = bme69x_set_heatr_conf(BME69X_FORCED_MODE, &s->heatr_conf, &s->bme);
+        bme69x_check_rslt("bme69x_set_heatr_conf", rslt);
+    }
+
+    return rslt;
+}
+
+/***********************************************************************/
+/*                         Test code                                   */
+/***********************************************************************/
+
+int main(void)
+{
+    const struct bme69x_dev *devs[N_SENSORS];
+    uint8_t idx[N_SENSORS];
+    uint8_t n_devs = 0;
+    int8_t rslt;
+    uint8_t i;
+    bool done;
+
+    for (i = 0; i < N_BUSES; i++)
+    {
+        rslt = bme69x_bus_open(&buses[i], bus_intf[i], bus_id[i]);
+        bme69x_check_rslt("bme69x_bus_open", rslt);
+        bme69x_sched_init(&scheds[i]);
+    }
+
+    for (i = 0; i < N_SENSORS; i++)
+    {
+        struct sensor *s = &sensors[i];
+
+        s->sample_count = 1;
+        rslt = bme69x_sensor_attach(&s->ctx, &buses[sensor_map[i].bus], sensor_map[i].addr, &s->bme);
+        bme69x_check_rslt("bme69x_sensor_attach", rslt);
+
+        if (rslt == BME69X_OK)
+        {
+            idx[n_devs] = i;
+            devs[n_devs++] = &s->bme;
+        }
+    }
+
+    /* The self-test measurements of all the sensors run at once */
+    if (n_devs > 0)
+    {
+        (void)bme69x_selftest_run(tests, devs, n_devs);
+    }
+
+    for (i = 0; i < n_devs; i++)
+    {
+        struct sensor *s = &sensors[idx[i]];
+
+        printf("Sensor %u self-test %s (%d), %u measurements\n",
+               (unsigned)idx[i],
+               (tests[i].rslt == BME69X_OK) ? "passed" : "failed",
+               tests[i].rslt,
+               tests[i].n_meas);
+
+        if (tests[i].rslt == BME69X_OK)
+        {
+            s->ready = (setup_sensor(s) == BME69X_OK);
+            if (s->ready)
+            {
+                /* All the sensors of a bus measure at once, each one is read as soon as it is ready */
+                s->entry.user = s;
+                rslt = bme69x_sched_add(&scheds[sensor_map[idx[i]].bus],
+                                        &s->entry,
+                                        &s->bme,
+                                        BME69X_FORCED_MODE,
+                                        &s->conf,
+                                        &s->heatr_conf);
+                bme69x_check_rslt("bme69x_sched_add", rslt);
+                s->ready = (rslt == BME69X_OK);
+            }
+        }
+
+        if (!s->ready)
+        {
+            bme69x_sensor_detach(&s->ctx);
+        }
+    }
+
+    printf("Sensor, Sample, TimeStamp(ms), Midpoint(ms), Temperature(deg C), Pressure(Pa), Humidity(%%), Gas resistance(ohm), Status\n");
+
+    /* One poller thread per bus, the sensors of different buses are sampled concurrently */
+    for (i = 0; i < N_BUSES; i++)
+    {
+        rslt = bme69x_bus_start(&buses[i], poll_bus, &scheds[i]);
+        bme69x_check_rslt("bme69x_bus_start", rslt);
+    }
+
+    /* A sensor dropping off its bus is backed off by its scheduler, the run does not wait for it while quarantined */
+    do
+    {
+        usleep(100000);
+        done = true;
+        for (i = 0; i < N_SENSORS; i++)
+        {
+            if (sensors[i].ready && (sensors[i].sample_count <= SAMPLE_COUNT) &&
+                (sensors[i].entry.health.state != BME69X_HEALTH_QUARANTINED))
+            {
+                done = false;
+            }
+        }
+    } while (!done);
+
+    for (i = 0; i < N_BUSES; i++)
+    {
+        bme69x_bus_close(&buses[i]);
+    }
+
+    for (i = 0; i < N_SENSORS; i++)
+    {
+        const struct bme69x_health *health = &sensors[i].entry.health;
+
+        if (sensors[i].ready)
+        {
+            printf("Sensor %u health %u, %lu faults in %lu accesses, %lu quarantines, %lu probes, %lu recoveries\n",
+                   (unsigned)i,
+                   health->state,
+                   (long unsigned int)health->n_faults,
+                   (long unsigned int)health->n_access,
+                   (long unsigned int)health->n_quarantines,
+                   (long unsigned int)health->n_probes,
+                   (long unsigned int)health->n_recoveries);
+        }
+    }
+
+    return 0;
+}